@@ -26,21 +26,35 @@ namespace cuco::benchmark::defaults {
 using KEY_TYPE_RANGE   = nvbench::type_list<nvbench::int32_t, nvbench::int64_t>;
 using VALUE_TYPE_RANGE = nvbench::type_list<nvbench::int32_t, nvbench::int64_t>;
 
-auto constexpr N             = 100'000'000;
-auto constexpr OCCUPANCY     = 0.5;
-auto constexpr MULTIPLICITY  = 8;
-auto constexpr MATCHING_RATE = 0.5;
-auto constexpr MAX_NOISE     = 3;
-auto constexpr SKEW          = 0.5;
-auto constexpr BATCH_SIZE    = 1'000'000;
-auto constexpr INITIAL_SIZE  = 50'000'000;
+auto constexpr N                  = 100'000'000;
+auto constexpr OCCUPANCY          = 0.5;
+auto constexpr MULTIPLICITY       = 8;
+auto constexpr MATCHING_RATE      = 0.5;
+auto constexpr MAX_NOISE          = 3;
+auto constexpr SKEW               = 0.5;
+auto constexpr ZIPF_ALPHA         = 0.99;
+auto constexpr HOTSET_FRACTION    = 0.01;
+auto constexpr HOTSET_PROBABILITY = 0.9;
+auto constexpr BATCH_SIZE         = 1'000'000;
+auto constexpr READ_RATIO         = 0.9;
+auto constexpr HOST_THREADS       = 1;
+auto constexpr NUM_CALLS          = 100;
+auto constexpr INITIAL_SIZE       = 50'000'000;
 
 auto const N_RANGE = nvbench::range(10'000'000, 100'000'000, 20'000'000);
 auto const N_RANGE_CACHE =
   std::vector<nvbench::int64_t>{8'000, 80'000, 800'000, 8'000'000, 80'000'000};
-auto const OCCUPANCY_RANGE     = nvbench::range(0.1, 0.9, 0.1);
-auto const MULTIPLICITY_RANGE  = std::vector<nvbench::int64_t>{1, 2, 4, 8, 16};
-auto const MATCHING_RATE_RANGE = nvbench::range(0.1, 1., 0.1);
-auto const SKEW_RANGE          = nvbench::range(0.1, 1., 0.1);
+auto const OCCUPANCY_RANGE          = nvbench::range(0.1, 0.9, 0.1);
+auto const MULTIPLICITY_RANGE       = std::vector<nvbench::int64_t>{1, 2, 4, 8, 16};
+auto const MATCHING_RATE_RANGE      = nvbench::range(0.1, 1., 0.1);
+auto const SKEW_RANGE               = nvbench::range(0.1, 1., 0.1);
+auto const ZIPF_ALPHA_RANGE         = std::vector<nvbench::float64_t>{0.5, 0.75, 0.99, 1.25, 1.5};
+auto const HOTSET_PROBABILITY_RANGE = nvbench::range(0.5, 1., 0.1);
+auto const BATCH_SIZE_RANGE =
+  std::vector<nvbench::int64_t>{1'000, 10'000, 100'000, 1'000'000};
+auto const READ_RATIO_RANGE   = std::vector<nvbench::float64_t>{0.5, 0.8, 0.9, 0.95, 0.99};
+auto const HOST_THREADS_RANGE = std::vector<nvbench::int64_t>{1, 2, 4, 8, 16};
+auto const SMALL_BATCH_SIZE_RANGE =
+  std::vector<nvbench::int64_t>{1, 10, 100, 1'000, 10'000, 100'000, 1'000'000};
 
 }  // namespace cuco::benchmark::defaults
@@ -94,6 +94,19 @@ NVBENCH_BENCH_TYPES(
                                        cuco::xxhash_64<nvbench::int32_t>,
                                        cuco::xxhash_64<nvbench::int64_t>,
                                        cuco::xxhash_64<large_key<32>>,
+                                       cuco::xxhash3_64<nvbench::int32_t>,
+                                       cuco::xxhash3_64<nvbench::int64_t>,
+                                       cuco::xxhash3_64<large_key<32>>,
+                                       cuco::rapidhash_64<nvbench::int32_t>,
+                                       cuco::rapidhash_64<nvbench::int64_t>,
+                                       cuco::rapidhash_64<large_key<32>>,
+                                       cuco::crc32c_32<nvbench::int32_t>,
+                                       cuco::crc32c_32<nvbench::int64_t>,
+                                       cuco::crc32c_32<large_key<32>>,
+                                       cuco::multiply_shift<nvbench::int32_t>,
+                                       cuco::multiply_shift<nvbench::int64_t>,
+                                       cuco::tabulation_32<nvbench::int32_t>,
+                                       cuco::tabulation_32<nvbench::int64_t>,
                                        cuco::murmurhash3_fmix_32<nvbench::int32_t>,
                                        cuco::murmurhash3_fmix_64<nvbench::int64_t>>))
   .set_name("hash_function_eval")
@@ -55,11 +55,19 @@ std::enable_if_t<(sizeof(Key) == sizeof(Value)), void> dynamic_map_find(
     static_cast<size_t>(initial_size), cuco::empty_key<Key>{-1}, cuco::empty_value<Value>{-1}};
   map.insert(pairs.begin(), pairs.end());
 
+  // Lower bound estimated from the overall load factor, a lookup may search several submaps
+  auto const load_factor = static_cast<double>(map.get_size()) / map.get_capacity();
+  auto const probes      = expected_probes(load_factor, legacy_step_slots, matching_rate);
+
   gen.dropout(keys.begin(), keys.end(), matching_rate);
 
   thrust::device_vector<Value> result(num_keys);
 
   state.add_element_count(num_keys);
+  add_bandwidth_summaries(state,
+                          num_keys,
+                          sizeof(Key) + probes * legacy_step_slots * sizeof(pair_type),
+                          sizeof(Value));
 
   state.exec(nvbench::exec_tag::sync, [&](nvbench::launch& launch) {
     map.find(keys.begin(), keys.end(), result.begin(), {}, {}, launch.get_stream());
@@ -90,3 +98,21 @@ NVBENCH_BENCH_TYPES(dynamic_map_find,
   .set_type_axes_names({"Key", "Value", "Distribution"})
   .set_max_noise(defaults::MAX_NOISE)
   .add_float64_axis("MatchingRate", defaults::MATCHING_RATE_RANGE);
+
+NVBENCH_BENCH_TYPES(dynamic_map_find,
+                    NVBENCH_TYPE_AXES(defaults::KEY_TYPE_RANGE,
+                                      defaults::VALUE_TYPE_RANGE,
+                                      nvbench::type_list<distribution::zipf>))
+  .set_name("dynamic_map_find_zipf_skew")
+  .set_type_axes_names({"Key", "Value", "Distribution"})
+  .set_max_noise(defaults::MAX_NOISE)
+  .add_float64_axis("ZipfAlpha", defaults::ZIPF_ALPHA_RANGE);
+
+NVBENCH_BENCH_TYPES(dynamic_map_find,
+                    NVBENCH_TYPE_AXES(defaults::KEY_TYPE_RANGE,
+                                      defaults::VALUE_TYPE_RANGE,
+                                      nvbench::type_list<distribution::hotset>))
+  .set_name("dynamic_map_find_hotset_skew")
+  .set_type_axes_names({"Key", "Value", "Distribution"})
+  .set_max_noise(defaults::MAX_NOISE)
+  .add_float64_axis("HotsetProbability", defaults::HOTSET_PROBABILITY_RANGE);
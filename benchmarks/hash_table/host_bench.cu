@@ -0,0 +1,347 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <defaults.hpp>
+#include <utils.hpp>
+
+#include <cuco/hash_functions.cuh>
+#include <cuco/utility/key_generator.hpp>
+
+#include <nvbench/nvbench.cuh>
+
+#include <thrust/execution_policy.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+using namespace cuco::benchmark;
+using namespace cuco::utility;
+
+/**
+ * @brief Flat open addressing baseline on the host.
+ *
+ * Linear probing over a single array of slots, where a slot is claimed by a CAS on its key like the
+ * device containers do, so that inserts from several threads are safe.
+ *
+ * @tparam Key Type of keys
+ * @tparam Value Type of values
+ * @tparam Hash Type of hash functor
+ */
+template <typename Key, typename Value, typename Hash = cuco::default_hash_function<Key>>
+class host_flat_map {
+ public:
+  /**
+   * @brief Constructs an empty map.
+   *
+   * @param capacity Number of slots
+   * @param empty_key_sentinel Key reserved to denote empty slots
+   */
+  host_flat_map(std::size_t capacity, Key empty_key_sentinel)
+    : keys_(capacity), values_(capacity), empty_key_sentinel_{empty_key_sentinel}
+  {
+    for (auto& key : keys_) {
+      key.store(empty_key_sentinel_, std::memory_order_relaxed);
+    }
+  }
+
+  /**
+   * @brief Inserts a key-value pair, unless the key is already present.
+   *
+   * @param key Key to insert
+   * @param value Value to insert
+   *
+   * @return `true` if the pair was inserted
+   */
+  bool insert(Key key, Value value) noexcept
+  {
+    for (auto idx = index(key);; idx = next(idx)) {
+      auto expected = empty_key_sentinel_;
+      if (keys_[idx].compare_exchange_strong(expected, key, std::memory_order_relaxed)) {
+        values_[idx] = value;
+        return true;
+      }
+      if (expected == key) { return false; }
+    }
+  }
+
+  /**
+   * @brief Finds the value of a key.
+   *
+   * @param key Key to search for
+   * @param empty_value_sentinel Value returned if the key is not present
+   *
+   * @return Value of the key if present, `empty_value_sentinel` otherwise
+   */
+  Value find(Key key, Value empty_value_sentinel) const noexcept
+  {
+    for (auto idx = index(key);; idx = next(idx)) {
+      auto const slot_key = keys_[idx].load(std::memory_order_relaxed);
+      if (slot_key == key) { return values_[idx]; }
+      if (slot_key == empty_key_sentinel_) { return empty_value_sentinel; }
+    }
+  }
+
+ private:
+  std::size_t index(Key key) const noexcept { return Hash{}(key) % keys_.size(); }
+
+  std::size_t next(std::size_t idx) const noexcept { return idx + 1 == keys_.size() ? 0 : idx + 1; }
+
+  std::vector<std::atomic<Key>> keys_;  ///< Keys of the slots
+  std::vector<Value> values_;           ///< Values of the slots
+  Key empty_key_sentinel_;              ///< Key denoting an empty slot
+};
+
+/// Benchmarks `std::unordered_map`
+struct std_unordered_map_backend {
+};
+/// Benchmarks the flat open addressing baseline `host_flat_map`
+struct flat_map_backend {
+};
+
+NVBENCH_DECLARE_TYPE_STRINGS(std_unordered_map_backend,
+                             "std_unordered_map",
+                             "std_unordered_map_backend");
+NVBENCH_DECLARE_TYPE_STRINGS(flat_map_backend, "flat_map", "flat_map_backend");
+
+/**
+ * @brief Splits `[0, n)` into contiguous chunks processed by `num_threads` host threads.
+ *
+ * @tparam Func Type of callable processing the chunk `[first, last)`
+ *
+ * @param n Number of elements
+ * @param num_threads Number of host threads
+ * @param func Callable processing a chunk, invoked as `func(thread_id, first, last)`
+ */
+template <typename Func>
+void parallel_for(std::size_t n, std::size_t num_threads, Func func)
+{
+  if (num_threads == 1) {
+    func(std::size_t{0}, std::size_t{0}, n);
+    return;
+  }
+  auto const chunk = (n + num_threads - 1) / num_threads;
+  std::vector<std::thread> threads;
+  for (std::size_t t = 0; t < num_threads; ++t) {
+    auto const first = std::min(n, t * chunk);
+    auto const last  = std::min(n, first + chunk);
+    threads.emplace_back(func, t, first, last);
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+}
+
+/**
+ * @brief A benchmark evaluating host-side insert performance of `std::unordered_map` and of a flat
+ * open addressing baseline
+ *
+ * @note `std::unordered_map` does not support concurrent inserts, only its single-threaded runs
+ * are measured.
+ */
+template <typename Key, typename Backend>
+void host_insert(nvbench::state& state, nvbench::type_list<Key, Backend>)
+{
+  auto const num_keys    = state.get_int64_or_default("NumInputs", defaults::N);
+  auto const occupancy   = state.get_float64_or_default("Occupancy", defaults::OCCUPANCY);
+  auto const num_threads = state.get_int64_or_default("Threads", defaults::HOST_THREADS);
+
+  if (std::is_same_v<Backend, std_unordered_map_backend> and num_threads > 1) {
+    state.skip("std::unordered_map does not support concurrent inserts.");
+    return;
+  }
+
+  std::size_t const size = num_keys / occupancy;
+
+  std::vector<Key> keys(num_keys);
+  key_generator gen;
+  gen.generate(distribution::unique{}, keys.begin(), keys.end(), thrust::host);
+
+  state.add_element_count(num_keys);
+
+  state.exec(nvbench::exec_tag::sync | nvbench::exec_tag::timer,
+             [&](nvbench::launch&, auto& timer) {
+               if constexpr (std::is_same_v<Backend, std_unordered_map_backend>) {
+                 std::unordered_map<Key, Key> map;
+                 map.max_load_factor(occupancy);
+                 map.reserve(num_keys);
+
+                 timer.start();
+                 for (auto const key : keys) {
+                   map.emplace(key, key);
+                 }
+                 timer.stop();
+               } else {
+                 host_flat_map<Key, Key> map{size, Key{-1}};
+
+                 timer.start();
+                 parallel_for(keys.size(), num_threads, [&](auto, auto first, auto last) {
+                   for (auto i = first; i < last; ++i) {
+                     map.insert(keys[i], keys[i]);
+                   }
+                 });
+                 timer.stop();
+               }
+             });
+}
+
+/**
+ * @brief A benchmark evaluating host-side lookup performance of `std::unordered_map` and of a flat
+ * open addressing baseline
+ */
+template <typename Key, typename Backend>
+void host_find(nvbench::state& state, nvbench::type_list<Key, Backend>)
+{
+  auto const num_keys      = state.get_int64_or_default("NumInputs", defaults::N);
+  auto const occupancy     = state.get_float64_or_default("Occupancy", defaults::OCCUPANCY);
+  auto const matching_rate = state.get_float64_or_default("MatchingRate", defaults::MATCHING_RATE);
+  auto const num_threads   = state.get_int64_or_default("Threads", defaults::HOST_THREADS);
+
+  std::size_t const size = num_keys / occupancy;
+
+  std::vector<Key> keys(num_keys);
+  key_generator gen;
+  gen.generate(distribution::unique{}, keys.begin(), keys.end(), thrust::host);
+
+  std::vector<Key> lookup_keys(keys);
+  gen.dropout(lookup_keys.begin(), lookup_keys.end(), matching_rate, thrust::host);
+
+  // Written by every lookup so that lookups cannot be optimized away
+  std::vector<std::size_t> num_found(num_threads);
+
+  auto const run = [&](auto const& map, auto& timer) {
+    timer.start();
+    parallel_for(lookup_keys.size(), num_threads, [&](auto thread_id, auto first, auto last) {
+      std::size_t found = 0;
+      for (auto i = first; i < last; ++i) {
+        if constexpr (std::is_same_v<Backend, std_unordered_map_backend>) {
+          found += map.count(lookup_keys[i]);
+        } else {
+          found += map.find(lookup_keys[i], Key{-1}) != Key{-1};
+        }
+      }
+      num_found[thread_id] = found;
+    });
+    timer.stop();
+  };
+
+  state.add_element_count(num_keys);
+
+  if constexpr (std::is_same_v<Backend, std_unordered_map_backend>) {
+    std::unordered_map<Key, Key> map;
+    map.max_load_factor(occupancy);
+    map.reserve(num_keys);
+    for (auto const key : keys) {
+      map.emplace(key, key);
+    }
+    state.exec(nvbench::exec_tag::sync | nvbench::exec_tag::timer,
+               [&](nvbench::launch&, auto& timer) { run(map, timer); });
+  } else {
+    host_flat_map<Key, Key> map{size, Key{-1}};
+    for (auto const key : keys) {
+      map.insert(key, key);
+    }
+    state.exec(nvbench::exec_tag::sync | nvbench::exec_tag::timer,
+               [&](nvbench::launch&, auto& timer) { run(map, timer); });
+  }
+}
+
+/**
+ * @brief A benchmark evaluating host-side performance of the hash functors
+ */
+template <typename Hash>
+void host_hash_eval(nvbench::state& state, nvbench::type_list<Hash>)
+{
+  auto const num_keys    = state.get_int64_or_default("NumInputs", defaults::N);
+  auto const num_threads = state.get_int64_or_default("Threads", defaults::HOST_THREADS);
+
+  // Written by every run so that the hash computations cannot be optimized away
+  std::vector<typename Hash::result_type> hash_values(num_threads);
+
+  state.add_element_count(num_keys);
+
+  state.exec(nvbench::exec_tag::sync | nvbench::exec_tag::timer,
+             [&](nvbench::launch&, auto& timer) {
+               timer.start();
+               parallel_for(num_keys, num_threads, [&](auto thread_id, auto first, auto last) {
+                 Hash const hash{};
+                 typename Hash::result_type agg = 0;
+                 for (auto i = first; i < last; ++i) {
+                   agg += hash(static_cast<typename Hash::argument_type>(i));
+                 }
+                 hash_values[thread_id] = agg;
+               });
+               timer.stop();
+             });
+}
+
+NVBENCH_BENCH_TYPES(host_insert,
+                    NVBENCH_TYPE_AXES(defaults::KEY_TYPE_RANGE,
+                                      nvbench::type_list<std_unordered_map_backend,
+                                                         flat_map_backend>))
+  .set_name("host_insert_unique_capacity")
+  .set_type_axes_names({"Key", "Backend"})
+  .set_max_noise(defaults::MAX_NOISE)
+  .add_int64_axis("NumInputs", defaults::N_RANGE_CACHE)
+  .add_int64_axis("Threads", defaults::HOST_THREADS_RANGE);
+
+NVBENCH_BENCH_TYPES(host_insert,
+                    NVBENCH_TYPE_AXES(defaults::KEY_TYPE_RANGE,
+                                      nvbench::type_list<std_unordered_map_backend,
+                                                         flat_map_backend>))
+  .set_name("host_insert_unique_occupancy")
+  .set_type_axes_names({"Key", "Backend"})
+  .set_max_noise(defaults::MAX_NOISE)
+  .add_float64_axis("Occupancy", defaults::OCCUPANCY_RANGE);
+
+NVBENCH_BENCH_TYPES(host_find,
+                    NVBENCH_TYPE_AXES(defaults::KEY_TYPE_RANGE,
+                                      nvbench::type_list<std_unordered_map_backend,
+                                                         flat_map_backend>))
+  .set_name("host_find_unique_capacity")
+  .set_type_axes_names({"Key", "Backend"})
+  .set_max_noise(defaults::MAX_NOISE)
+  .add_int64_axis("NumInputs", defaults::N_RANGE_CACHE)
+  .add_int64_axis("Threads", defaults::HOST_THREADS_RANGE);
+
+NVBENCH_BENCH_TYPES(host_find,
+                    NVBENCH_TYPE_AXES(defaults::KEY_TYPE_RANGE,
+                                      nvbench::type_list<std_unordered_map_backend,
+                                                         flat_map_backend>))
+  .set_name("host_find_unique_occupancy")
+  .set_type_axes_names({"Key", "Backend"})
+  .set_max_noise(defaults::MAX_NOISE)
+  .add_float64_axis("Occupancy", defaults::OCCUPANCY_RANGE);
+
+NVBENCH_BENCH_TYPES(
+  host_hash_eval,
+  NVBENCH_TYPE_AXES(nvbench::type_list<cuco::murmurhash3_32<nvbench::int32_t>,
+                                       cuco::murmurhash3_32<nvbench::int64_t>,
+                                       cuco::xxhash_32<nvbench::int32_t>,
+                                       cuco::xxhash_32<nvbench::int64_t>,
+                                       cuco::xxhash_64<nvbench::int32_t>,
+                                       cuco::xxhash_64<nvbench::int64_t>,
+                                       cuco::murmurhash3_fmix_32<nvbench::int32_t>,
+                                       cuco::murmurhash3_fmix_64<nvbench::int64_t>>))
+  .set_name("host_hash_function_eval")
+  .set_type_axes_names({"Hash"})
+  .set_max_noise(defaults::MAX_NOISE)
+  .add_int64_axis("Threads", defaults::HOST_THREADS_RANGE);
@@ -56,11 +56,17 @@ std::enable_if_t<(sizeof(Key) == sizeof(Value)), void> static_map_contains(
   cuco::static_map<Key, Value> map{size, cuco::empty_key<Key>{-1}, cuco::empty_value<Value>{-1}};
   map.insert(pairs.begin(), pairs.end());
 
+  auto const probes = expected_probes(map.get_load_factor(), legacy_step_slots, matching_rate);
+
   gen.dropout(keys.begin(), keys.end(), matching_rate);
 
   thrust::device_vector<bool> result(num_keys);
 
   state.add_element_count(num_keys);
+  add_bandwidth_summaries(state,
+                          num_keys,
+                          sizeof(Key) + probes * legacy_step_slots * sizeof(pair_type),
+                          sizeof(bool));
 
   state.exec(nvbench::exec_tag::sync, [&](nvbench::launch& launch) {
     map.contains(keys.begin(), keys.end(), result.begin(), {}, {}, launch.get_stream());
@@ -91,3 +97,21 @@ NVBENCH_BENCH_TYPES(static_map_contains,
   .set_type_axes_names({"Key", "Value", "Distribution"})
   .set_max_noise(defaults::MAX_NOISE)
   .add_float64_axis("MatchingRate", defaults::MATCHING_RATE_RANGE);
+
+NVBENCH_BENCH_TYPES(static_map_contains,
+                    NVBENCH_TYPE_AXES(defaults::KEY_TYPE_RANGE,
+                                      defaults::VALUE_TYPE_RANGE,
+                                      nvbench::type_list<distribution::zipf>))
+  .set_name("static_map_contains_zipf_skew")
+  .set_type_axes_names({"Key", "Value", "Distribution"})
+  .set_max_noise(defaults::MAX_NOISE)
+  .add_float64_axis("ZipfAlpha", defaults::ZIPF_ALPHA_RANGE);
+
+NVBENCH_BENCH_TYPES(static_map_contains,
+                    NVBENCH_TYPE_AXES(defaults::KEY_TYPE_RANGE,
+                                      defaults::VALUE_TYPE_RANGE,
+                                      nvbench::type_list<distribution::hotset>))
+  .set_name("static_map_contains_hotset_skew")
+  .set_type_axes_names({"Key", "Value", "Distribution"})
+  .set_max_noise(defaults::MAX_NOISE)
+  .add_float64_axis("HotsetProbability", defaults::HOTSET_PROBABILITY_RANGE);
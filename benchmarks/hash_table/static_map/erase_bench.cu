@@ -52,9 +52,22 @@ std::enable_if_t<(sizeof(Key) == sizeof(Value)), void> static_map_erase(
   thrust::transform(
     keys.begin(), keys.end(), pairs.begin(), [] __device__(auto i) { return pair_type(i, {}); });
 
+  // Measured on a container filled outside of the benchmark loop. Each erased key overwrites its
+  // slot key with the erased sentinel.
+  auto const load_factor = [&]() {
+    cuco::static_map<Key, Value> map{size, cuco::empty_key<Key>{-1}, cuco::empty_value<Value>{-1}};
+    map.insert(pairs.begin(), pairs.end());
+    return static_cast<double>(map.get_load_factor());
+  }();
+  auto const probes = expected_probes(load_factor, legacy_step_slots, matching_rate);
+
   gen.dropout(keys.begin(), keys.end(), matching_rate);
 
   state.add_element_count(num_keys);
+  add_bandwidth_summaries(state,
+                          num_keys,
+                          sizeof(Key) + probes * legacy_step_slots * sizeof(pair_type),
+                          matching_rate * sizeof(Key));
 
   state.exec(
     nvbench::exec_tag::sync | nvbench::exec_tag::timer, [&](nvbench::launch& launch, auto& timer) {
@@ -93,3 +106,21 @@ NVBENCH_BENCH_TYPES(static_map_erase,
   .set_type_axes_names({"Key", "Value", "Distribution"})
   .set_max_noise(defaults::MAX_NOISE)
   .add_float64_axis("MatchingRate", defaults::MATCHING_RATE_RANGE);
+
+NVBENCH_BENCH_TYPES(static_map_erase,
+                    NVBENCH_TYPE_AXES(defaults::KEY_TYPE_RANGE,
+                                      defaults::VALUE_TYPE_RANGE,
+                                      nvbench::type_list<distribution::zipf>))
+  .set_name("static_map_erase_zipf_skew")
+  .set_type_axes_names({"Key", "Value", "Distribution"})
+  .set_max_noise(defaults::MAX_NOISE)
+  .add_float64_axis("ZipfAlpha", defaults::ZIPF_ALPHA_RANGE);
+
+NVBENCH_BENCH_TYPES(static_map_erase,
+                    NVBENCH_TYPE_AXES(defaults::KEY_TYPE_RANGE,
+                                      defaults::VALUE_TYPE_RANGE,
+                                      nvbench::type_list<distribution::hotset>))
+  .set_name("static_map_erase_hotset_skew")
+  .set_type_axes_names({"Key", "Value", "Distribution"})
+  .set_max_noise(defaults::MAX_NOISE)
+  .add_float64_axis("HotsetProbability", defaults::HOTSET_PROBABILITY_RANGE);
@@ -25,6 +25,8 @@
 #include <thrust/device_vector.h>
 #include <thrust/transform.h>
 
+#include <utility>
+
 using namespace cuco::benchmark;
 using namespace cuco::utility;
 
@@ -52,7 +54,20 @@ std::enable_if_t<(sizeof(Key) == sizeof(Value)), void> static_map_insert(
     return pair_type(key, {});
   });
 
+  // Measured on a container filled outside of the benchmark loop. Each pair probes as many steps as
+  // a lookup finding its key, and each newly inserted pair writes its slot.
+  auto const [load_factor, num_inserted] = [&]() {
+    cuco::static_map<Key, Value> map{size, cuco::empty_key<Key>{-1}, cuco::empty_value<Value>{-1}};
+    map.insert(pairs.begin(), pairs.end());
+    return std::pair{static_cast<double>(map.get_load_factor()), map.get_size()};
+  }();
+  auto const probes = expected_probes(load_factor, legacy_step_slots, 1.);
+
   state.add_element_count(num_keys);
+  add_bandwidth_summaries(state,
+                          num_keys,
+                          sizeof(pair_type) + probes * legacy_step_slots * sizeof(pair_type),
+                          static_cast<double>(num_inserted) / num_keys * sizeof(pair_type));
 
   state.exec(
     nvbench::exec_tag::sync | nvbench::exec_tag::timer, [&](nvbench::launch& launch, auto& timer) {
@@ -98,3 +113,21 @@ NVBENCH_BENCH_TYPES(static_map_insert,
   .set_type_axes_names({"Key", "Value", "Distribution"})
   .set_max_noise(defaults::MAX_NOISE)
   .add_float64_axis("Skew", defaults::SKEW_RANGE);
+
+NVBENCH_BENCH_TYPES(static_map_insert,
+                    NVBENCH_TYPE_AXES(defaults::KEY_TYPE_RANGE,
+                                      defaults::VALUE_TYPE_RANGE,
+                                      nvbench::type_list<distribution::zipf>))
+  .set_name("static_map_insert_zipf_skew")
+  .set_type_axes_names({"Key", "Value", "Distribution"})
+  .set_max_noise(defaults::MAX_NOISE)
+  .add_float64_axis("ZipfAlpha", defaults::ZIPF_ALPHA_RANGE);
+
+NVBENCH_BENCH_TYPES(static_map_insert,
+                    NVBENCH_TYPE_AXES(defaults::KEY_TYPE_RANGE,
+                                      defaults::VALUE_TYPE_RANGE,
+                                      nvbench::type_list<distribution::hotset>))
+  .set_name("static_map_insert_hotset_skew")
+  .set_type_axes_names({"Key", "Value", "Distribution"})
+  .set_max_noise(defaults::MAX_NOISE)
+  .add_float64_axis("HotsetProbability", defaults::HOTSET_PROBABILITY_RANGE);
@@ -0,0 +1,226 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <defaults.hpp>
+#include <utils.hpp>
+
+#include <cuco/static_map.cuh>
+#include <cuco/utility/key_generator.hpp>
+
+#include <nvbench/nvbench.cuh>
+
+#include <thrust/device_vector.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform.h>
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+using namespace cuco::benchmark;
+using namespace cuco::utility;
+
+/**
+ * @brief A benchmark evaluating `cuco::experimental::static_map` performance when lookups run
+ * concurrently with inserts on the same map
+ *
+ * @note Half of the keys are inserted before the measurement. The other half is split into lookups
+ * and inserts of new keys according to `ReadRatio`. Inserts are issued in batches on one stream
+ * and lookups on another stream from a separate host thread, so that both kernels and launches
+ * overlap.
+ */
+template <typename Key, typename Value, typename Dist>
+std::enable_if_t<(sizeof(Key) == sizeof(Value)), void> static_map_mixed_workload(
+  nvbench::state& state, nvbench::type_list<Key, Value, Dist>)
+{
+  using pair_type = cuco::pair<Key, Value>;
+
+  auto const num_keys   = state.get_int64_or_default("NumInputs", defaults::N);
+  auto const occupancy  = state.get_float64_or_default("Occupancy", defaults::OCCUPANCY);
+  auto const read_ratio = state.get_float64_or_default("ReadRatio", defaults::READ_RATIO);
+  auto const hit_rate   = state.get_float64_or_default("HitRate", defaults::MATCHING_RATE);
+  auto const batch_size = state.get_int64_or_default("BatchSize", defaults::BATCH_SIZE);
+
+  std::size_t const size        = num_keys / occupancy;
+  std::size_t const num_preload = num_keys / 2;
+  std::size_t const num_ops     = num_keys - num_preload;
+  std::size_t const num_reads   = num_ops * read_ratio;
+  std::size_t const num_writes  = num_ops - num_reads;
+
+  // Preloaded keys are [0, num_preload), inserted keys are [num_preload, num_keys)
+  thrust::device_vector<pair_type> preload_pairs(num_preload);
+  thrust::transform(thrust::counting_iterator<Key>(0),
+                    thrust::counting_iterator<Key>(num_preload),
+                    preload_pairs.begin(),
+                    [] __device__(Key key) { return pair_type(key, {}); });
+
+  key_generator gen;
+
+  thrust::device_vector<Key> write_keys(num_writes);
+  gen.generate(dist_from_state<Dist>(state), write_keys.begin(), write_keys.end());
+  thrust::device_vector<pair_type> write_pairs(num_writes);
+  thrust::transform(write_keys.begin(),
+                    write_keys.end(),
+                    write_pairs.begin(),
+                    [offset = static_cast<Key>(num_preload)] __device__(Key key) {
+                      return pair_type(key + offset, {});
+                    });
+
+  thrust::device_vector<Key> read_keys(num_reads);
+  gen.generate(dist_from_state<Dist>(state), read_keys.begin(), read_keys.end());
+  gen.dropout(read_keys.begin(), read_keys.end(), hit_rate);
+  // Hits are remapped onto preloaded keys, misses out of the range of all preloaded and inserted
+  // keys
+  thrust::transform(read_keys.begin(),
+                    read_keys.end(),
+                    read_keys.begin(),
+                    [num_reads   = static_cast<Key>(num_reads),
+                     num_preload = static_cast<Key>(num_preload),
+                     num_keys    = static_cast<Key>(num_keys)] __device__(Key key) {
+                      if (key < num_reads) { return static_cast<Key>(key % num_preload); }
+                      return key < num_keys ? static_cast<Key>(key + num_keys) : key;
+                    });
+  thrust::device_vector<Value> found(num_reads);
+
+  auto const num_write_batches = (num_writes + batch_size - 1) / batch_size;
+  auto const num_read_batches  = (num_reads + batch_size - 1) / batch_size;
+
+  cudaStream_t read_stream;
+  CUCO_CUDA_TRY(cudaStreamCreateWithFlags(&read_stream, cudaStreamNonBlocking));
+  cudaEvent_t fork;
+  cudaEvent_t join;
+  CUCO_CUDA_TRY(cudaEventCreateWithFlags(&fork, cudaEventDisableTiming));
+  CUCO_CUDA_TRY(cudaEventCreateWithFlags(&join, cudaEventDisableTiming));
+  std::vector<cudaEvent_t> write_events(num_write_batches + 1);
+  std::vector<cudaEvent_t> read_events(num_read_batches + 1);
+  for (auto& event : write_events) {
+    CUCO_CUDA_TRY(cudaEventCreate(&event));
+  }
+  for (auto& event : read_events) {
+    CUCO_CUDA_TRY(cudaEventCreate(&event));
+  }
+
+  std::vector<double> write_latencies(num_write_batches);
+  std::vector<double> read_latencies(num_read_batches);
+  auto const elapsed = [](std::vector<cudaEvent_t> const& events, std::vector<double>& latencies) {
+    for (std::size_t i = 0; i < latencies.size(); ++i) {
+      float milliseconds;
+      CUCO_CUDA_TRY(cudaEventElapsedTime(&milliseconds, events[i], events[i + 1]));
+      latencies[i] = milliseconds / 1'000.;
+    }
+  };
+
+  state.add_element_count(num_ops);
+
+  state.exec(
+    nvbench::exec_tag::sync | nvbench::exec_tag::timer, [&](nvbench::launch& launch, auto& timer) {
+      auto const write_stream = launch.get_stream();
+
+      cuco::experimental::static_map<Key, Value> map{
+        size, cuco::empty_key<Key>{-1}, cuco::empty_value<Value>{-1}};
+      map.insert(preload_pairs.begin(), preload_pairs.end(), {write_stream});
+
+      timer.start();
+      CUCO_CUDA_TRY(cudaEventRecord(fork, write_stream));
+      CUCO_CUDA_TRY(cudaStreamWaitEvent(read_stream, fork));
+
+      std::thread reader{[&]() {
+        CUCO_CUDA_TRY(cudaEventRecord(read_events.front(), read_stream));
+        for (std::size_t i = 0; i < num_read_batches; ++i) {
+          auto const first = i * batch_size;
+          auto const last  = std::min<std::size_t>(first + batch_size, num_reads);
+          map.find_async(read_keys.begin() + first,
+                         read_keys.begin() + last,
+                         found.begin() + first,
+                         {read_stream});
+          CUCO_CUDA_TRY(cudaEventRecord(read_events[i + 1], read_stream));
+        }
+        CUCO_CUDA_TRY(cudaEventRecord(join, read_stream));
+      }};
+
+      CUCO_CUDA_TRY(cudaEventRecord(write_events.front(), write_stream));
+      for (std::size_t i = 0; i < num_write_batches; ++i) {
+        auto const first = i * batch_size;
+        auto const last  = std::min<std::size_t>(first + batch_size, num_writes);
+        map.insert_async(write_pairs.begin() + first, write_pairs.begin() + last, {write_stream});
+        CUCO_CUDA_TRY(cudaEventRecord(write_events[i + 1], write_stream));
+      }
+
+      reader.join();
+      CUCO_CUDA_TRY(cudaStreamWaitEvent(write_stream, join));
+      timer.stop();
+
+      CUCO_CUDA_TRY(cudaStreamSynchronize(write_stream));
+      elapsed(write_events, write_latencies);
+      elapsed(read_events, read_latencies);
+    });
+
+  add_latency_summaries(state, "Write", std::move(write_latencies));
+  add_latency_summaries(state, "Read", std::move(read_latencies));
+
+  for (auto const event : write_events) {
+    CUCO_CUDA_TRY(cudaEventDestroy(event));
+  }
+  for (auto const event : read_events) {
+    CUCO_CUDA_TRY(cudaEventDestroy(event));
+  }
+  CUCO_CUDA_TRY(cudaEventDestroy(fork));
+  CUCO_CUDA_TRY(cudaEventDestroy(join));
+  CUCO_CUDA_TRY(cudaStreamDestroy(read_stream));
+}
+
+template <typename Key, typename Value, typename Dist>
+std::enable_if_t<(sizeof(Key) != sizeof(Value)), void> static_map_mixed_workload(
+  nvbench::state& state, nvbench::type_list<Key, Value, Dist>)
+{
+  state.skip("Key should be the same type as Value.");
+}
+
+NVBENCH_BENCH_TYPES(static_map_mixed_workload,
+                    NVBENCH_TYPE_AXES(defaults::KEY_TYPE_RANGE,
+                                      defaults::VALUE_TYPE_RANGE,
+                                      nvbench::type_list<distribution::unique>))
+  .set_name("static_map_mixed_workload_unique_read_ratio")
+  .set_type_axes_names({"Key", "Value", "Distribution"})
+  .set_max_noise(defaults::MAX_NOISE)
+  .add_float64_axis("ReadRatio", defaults::READ_RATIO_RANGE);
+
+NVBENCH_BENCH_TYPES(static_map_mixed_workload,
+                    NVBENCH_TYPE_AXES(defaults::KEY_TYPE_RANGE,
+                                      defaults::VALUE_TYPE_RANGE,
+                                      nvbench::type_list<distribution::unique>))
+  .set_name("static_map_mixed_workload_unique_hit_rate")
+  .set_type_axes_names({"Key", "Value", "Distribution"})
+  .set_max_noise(defaults::MAX_NOISE)
+  .add_float64_axis("HitRate", defaults::MATCHING_RATE_RANGE);
+
+NVBENCH_BENCH_TYPES(static_map_mixed_workload,
+                    NVBENCH_TYPE_AXES(defaults::KEY_TYPE_RANGE,
+                                      defaults::VALUE_TYPE_RANGE,
+                                      nvbench::type_list<distribution::zipf>))
+  .set_name("static_map_mixed_workload_zipf_skew")
+  .set_type_axes_names({"Key", "Value", "Distribution"})
+  .set_max_noise(defaults::MAX_NOISE)
+  .add_float64_axis("ZipfAlpha", defaults::ZIPF_ALPHA_RANGE);
+
+NVBENCH_BENCH_TYPES(static_map_mixed_workload,
+                    NVBENCH_TYPE_AXES(defaults::KEY_TYPE_RANGE,
+                                      defaults::VALUE_TYPE_RANGE,
+                                      nvbench::type_list<distribution::hotset>))
+  .set_name("static_map_mixed_workload_hotset_skew")
+  .set_type_axes_names({"Key", "Value", "Distribution"})
+  .set_max_noise(defaults::MAX_NOISE)
+  .add_float64_axis("HotsetProbability", defaults::HOTSET_PROBABILITY_RANGE);
@@ -48,12 +48,20 @@ void static_set_find(nvbench::state& state, nvbench::type_list<Key, Dist>)
   cuco::experimental::static_set<Key> set{size, cuco::empty_key<Key>{-1}};
   set.insert(keys.begin(), keys.end());
 
+  // Each probing step loads `cg_size` windows of `window_size` slots
+  auto const analysis   = set.analyze();
+  auto const step_bytes = analysis.cg_size * analysis.window_size * sizeof(Key);
+
   // TODO: would crash if not passing nullptr, why?
   gen.dropout(keys.begin(), keys.end(), matching_rate, nullptr);
 
   thrust::device_vector<Key> result(num_keys);
 
   state.add_element_count(num_keys);
+  add_bandwidth_summaries(state,
+                          num_keys,
+                          sizeof(Key) + expected_probes(analysis, matching_rate) * step_bytes,
+                          sizeof(Key));
 
   state.exec(nvbench::exec_tag::sync, [&](nvbench::launch& launch) {
     set.find(keys.begin(), keys.end(), result.begin(), {launch.get_stream()});
@@ -82,3 +90,19 @@ NVBENCH_BENCH_TYPES(static_set_find,
   .set_name("static_set_find_unique_capacity")
   .set_type_axes_names({"Key", "Distribution"})
   .add_int64_axis("NumInputs", defaults::N_RANGE_CACHE);
+
+NVBENCH_BENCH_TYPES(static_set_find,
+                    NVBENCH_TYPE_AXES(defaults::KEY_TYPE_RANGE,
+                                      nvbench::type_list<distribution::zipf>))
+  .set_name("static_set_find_zipf_skew")
+  .set_type_axes_names({"Key", "Distribution"})
+  .set_max_noise(defaults::MAX_NOISE)
+  .add_float64_axis("ZipfAlpha", defaults::ZIPF_ALPHA_RANGE);
+
+NVBENCH_BENCH_TYPES(static_set_find,
+                    NVBENCH_TYPE_AXES(defaults::KEY_TYPE_RANGE,
+                                      nvbench::type_list<distribution::hotset>))
+  .set_name("static_set_find_hotset_skew")
+  .set_type_axes_names({"Key", "Distribution"})
+  .set_max_noise(defaults::MAX_NOISE)
+  .add_float64_axis("HotsetProbability", defaults::HOTSET_PROBABILITY_RANGE);
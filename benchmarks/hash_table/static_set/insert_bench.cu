@@ -43,7 +43,20 @@ void static_set_insert(nvbench::state& state, nvbench::type_list<Key, Dist>)
   key_generator gen;
   gen.generate(dist_from_state<Dist>(state), keys.begin(), keys.end());
 
+  // Measured on a container filled outside of the benchmark loop. Each key probes as many steps as
+  // a lookup finding it, and each newly inserted key writes its slot.
+  auto const analysis = [&]() {
+    cuco::experimental::static_set<Key> set{size, cuco::empty_key<Key>{-1}};
+    set.insert(keys.begin(), keys.end());
+    return set.analyze();
+  }();
+  auto const step_bytes = analysis.cg_size * analysis.window_size * sizeof(Key);
+
   state.add_element_count(num_keys);
+  add_bandwidth_summaries(state,
+                          num_keys,
+                          sizeof(Key) + analysis.expected_probes_hit * step_bytes,
+                          static_cast<double>(analysis.size) / num_keys * sizeof(Key));
 
   state.exec(nvbench::exec_tag::sync | nvbench::exec_tag::timer,
              [&](nvbench::launch& launch, auto& timer) {
@@ -79,3 +92,19 @@ NVBENCH_BENCH_TYPES(static_set_insert,
   .set_type_axes_names({"Key", "Distribution"})
   .set_max_noise(defaults::MAX_NOISE)
   .add_float64_axis("Skew", defaults::SKEW_RANGE);
+
+NVBENCH_BENCH_TYPES(static_set_insert,
+                    NVBENCH_TYPE_AXES(defaults::KEY_TYPE_RANGE,
+                                      nvbench::type_list<distribution::zipf>))
+  .set_name("static_set_insert_zipf_skew")
+  .set_type_axes_names({"Key", "Distribution"})
+  .set_max_noise(defaults::MAX_NOISE)
+  .add_float64_axis("ZipfAlpha", defaults::ZIPF_ALPHA_RANGE);
+
+NVBENCH_BENCH_TYPES(static_set_insert,
+                    NVBENCH_TYPE_AXES(defaults::KEY_TYPE_RANGE,
+                                      nvbench::type_list<distribution::hotset>))
+  .set_name("static_set_insert_hotset_skew")
+  .set_type_axes_names({"Key", "Distribution"})
+  .set_max_noise(defaults::MAX_NOISE)
+  .add_float64_axis("HotsetProbability", defaults::HOTSET_PROBABILITY_RANGE);
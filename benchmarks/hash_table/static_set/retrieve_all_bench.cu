@@ -49,6 +49,11 @@ void static_set_retrieve_all(nvbench::state& state, nvbench::type_list<Key, Dist
   thrust::device_vector<Key> result(num_keys);
 
   state.add_element_count(num_keys);
+  // Every slot is scanned once and every key of the container is written out
+  add_bandwidth_summaries(state,
+                          num_keys,
+                          static_cast<double>(set.capacity()) / num_keys * sizeof(Key),
+                          static_cast<double>(set.size()) / num_keys * sizeof(Key));
   state.exec(nvbench::exec_tag::sync, [&](nvbench::launch& launch) {
     auto end = set.retrieve_all(result.begin(), {launch.get_stream()});
   });
@@ -61,3 +66,19 @@ NVBENCH_BENCH_TYPES(static_set_retrieve_all,
   .set_type_axes_names({"Key", "Distribution"})
   .set_max_noise(defaults::MAX_NOISE)
   .add_float64_axis("Occupancy", defaults::OCCUPANCY_RANGE);
+
+NVBENCH_BENCH_TYPES(static_set_retrieve_all,
+                    NVBENCH_TYPE_AXES(defaults::KEY_TYPE_RANGE,
+                                      nvbench::type_list<distribution::zipf>))
+  .set_name("static_set_retrieve_all_zipf_skew")
+  .set_type_axes_names({"Key", "Distribution"})
+  .set_max_noise(defaults::MAX_NOISE)
+  .add_float64_axis("ZipfAlpha", defaults::ZIPF_ALPHA_RANGE);
+
+NVBENCH_BENCH_TYPES(static_set_retrieve_all,
+                    NVBENCH_TYPE_AXES(defaults::KEY_TYPE_RANGE,
+                                      nvbench::type_list<distribution::hotset>))
+  .set_name("static_set_retrieve_all_hotset_skew")
+  .set_type_axes_names({"Key", "Distribution"})
+  .set_max_noise(defaults::MAX_NOISE)
+  .add_float64_axis("HotsetProbability", defaults::HOTSET_PROBABILITY_RANGE);
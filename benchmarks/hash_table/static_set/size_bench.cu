@@ -49,6 +49,10 @@ void static_set_size(nvbench::state& state, nvbench::type_list<Key, Dist>)
 
   set.insert(keys.begin(), keys.end());
 
+  // Every slot is scanned once
+  add_bandwidth_summaries(
+    state, num_keys, static_cast<double>(set.capacity()) / num_keys * sizeof(Key), 0.);
+
   state.exec(nvbench::exec_tag::sync,
              [&](nvbench::launch& launch) { auto const size = set.size({launch.get_stream()}); });
 }
@@ -60,3 +64,19 @@ NVBENCH_BENCH_TYPES(static_set_size,
   .set_type_axes_names({"Key", "Distribution"})
   .set_max_noise(defaults::MAX_NOISE)
   .add_float64_axis("Occupancy", defaults::OCCUPANCY_RANGE);
+
+NVBENCH_BENCH_TYPES(static_set_size,
+                    NVBENCH_TYPE_AXES(defaults::KEY_TYPE_RANGE,
+                                      nvbench::type_list<distribution::zipf>))
+  .set_name("static_set_size_zipf_skew")
+  .set_type_axes_names({"Key", "Distribution"})
+  .set_max_noise(defaults::MAX_NOISE)
+  .add_float64_axis("ZipfAlpha", defaults::ZIPF_ALPHA_RANGE);
+
+NVBENCH_BENCH_TYPES(static_set_size,
+                    NVBENCH_TYPE_AXES(defaults::KEY_TYPE_RANGE,
+                                      nvbench::type_list<distribution::hotset>))
+  .set_name("static_set_size_hotset_skew")
+  .set_type_axes_names({"Key", "Distribution"})
+  .set_max_noise(defaults::MAX_NOISE)
+  .add_float64_axis("HotsetProbability", defaults::HOTSET_PROBABILITY_RANGE);
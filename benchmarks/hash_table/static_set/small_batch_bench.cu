@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <defaults.hpp>
+#include <utils.hpp>
+
+#include <cuco/static_set.cuh>
+#include <cuco/utility/key_generator.hpp>
+
+#include <nvbench/nvbench.cuh>
+
+#include <thrust/device_vector.h>
+
+#include <chrono>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+using namespace cuco::benchmark;
+using namespace cuco::utility;
+
+/// Calls `insert`
+struct insert_op {
+};
+/// Calls `contains`
+struct contains_op {
+};
+/// Calls `find`
+struct find_op {
+};
+/// Calls `size`
+struct size_op {
+};
+
+NVBENCH_DECLARE_TYPE_STRINGS(insert_op, "insert", "insert_op");
+NVBENCH_DECLARE_TYPE_STRINGS(contains_op, "contains", "contains_op");
+NVBENCH_DECLARE_TYPE_STRINGS(find_op, "find", "find_op");
+NVBENCH_DECLARE_TYPE_STRINGS(size_op, "size", "size_op");
+
+/**
+ * @brief A benchmark evaluating the per-call latency of `cuco::static_set` operations on small
+ * batches
+ *
+ * @note Each measurement issues `NumCalls` calls of `BatchSize` keys. The latency of a synchronous
+ * call is its host wall-clock time, including temporary allocations and stream synchronization.
+ * The latency of an asynchronous call is the device time between the events recorded before and
+ * after it.
+ */
+template <typename Key, typename Op>
+void static_set_small_batch(nvbench::state& state, nvbench::type_list<Key, Op>)
+{
+  auto const batch_size = state.get_int64_or_default("BatchSize", defaults::BATCH_SIZE);
+  auto const num_calls  = state.get_int64_or_default("NumCalls", defaults::NUM_CALLS);
+  auto const occupancy  = state.get_float64_or_default("Occupancy", defaults::OCCUPANCY);
+  auto const is_async   = state.get_string_or_default("Mode", "sync") == "async";
+
+  if (std::is_same_v<Op, size_op> and is_async) {
+    state.skip("size has no asynchronous variant.");
+    return;
+  }
+
+  auto const num_keys    = static_cast<std::size_t>(batch_size * num_calls);
+  std::size_t const size = num_keys / occupancy;
+
+  thrust::device_vector<Key> keys(num_keys);
+
+  key_generator gen;
+  gen.generate(distribution::unique{}, keys.begin(), keys.end());
+
+  thrust::device_vector<Key> found(batch_size);
+  thrust::device_vector<bool> contained(batch_size);
+
+  std::vector<cudaEvent_t> events(num_calls + 1);
+  for (auto& event : events) {
+    CUCO_CUDA_TRY(cudaEventCreate(&event));
+  }
+  std::vector<double> latencies(num_calls);
+
+  state.add_element_count(num_keys);
+
+  state.exec(
+    nvbench::exec_tag::sync | nvbench::exec_tag::timer, [&](nvbench::launch& launch, auto& timer) {
+      auto const stream = launch.get_stream();
+
+      cuco::experimental::static_set<Key> set{size, cuco::empty_key<Key>{-1}, {}, {}, {}, {stream}};
+      if constexpr (not std::is_same_v<Op, insert_op>) {
+        set.insert(keys.begin(), keys.end(), {stream});
+      }
+
+      auto const call = [&](std::size_t i) {
+        auto const first = keys.begin() + i * batch_size;
+        auto const last  = first + batch_size;
+        if constexpr (std::is_same_v<Op, insert_op>) {
+          if (is_async) {
+            set.insert_async(first, last, {stream});
+          } else {
+            set.insert(first, last, {stream});
+          }
+        } else if constexpr (std::is_same_v<Op, contains_op>) {
+          if (is_async) {
+            set.contains_async(first, last, contained.begin(), {stream});
+          } else {
+            set.contains(first, last, contained.begin(), {stream});
+          }
+        } else if constexpr (std::is_same_v<Op, find_op>) {
+          if (is_async) {
+            set.find_async(first, last, found.begin(), {stream});
+          } else {
+            set.find(first, last, found.begin(), {stream});
+          }
+        } else {
+          [[maybe_unused]] auto const num_filled = set.size({stream});
+        }
+      };
+
+      timer.start();
+      if (is_async) {
+        CUCO_CUDA_TRY(cudaEventRecord(events.front(), stream));
+        for (std::size_t i = 0; i < latencies.size(); ++i) {
+          call(i);
+          CUCO_CUDA_TRY(cudaEventRecord(events[i + 1], stream));
+        }
+      } else {
+        for (std::size_t i = 0; i < latencies.size(); ++i) {
+          auto const start = std::chrono::steady_clock::now();
+          call(i);
+          auto const elapsed = std::chrono::steady_clock::now() - start;
+          latencies[i]       = std::chrono::duration<double>(elapsed).count();
+        }
+      }
+      timer.stop();
+
+      if (is_async) {
+        CUCO_CUDA_TRY(cudaEventSynchronize(events.back()));
+        for (std::size_t i = 0; i < latencies.size(); ++i) {
+          float milliseconds;
+          CUCO_CUDA_TRY(cudaEventElapsedTime(&milliseconds, events[i], events[i + 1]));
+          latencies[i] = milliseconds / 1'000.;
+        }
+      }
+    });
+
+  add_latency_summaries(state, "Call", std::move(latencies));
+
+  for (auto const event : events) {
+    CUCO_CUDA_TRY(cudaEventDestroy(event));
+  }
+}
+
+NVBENCH_BENCH_TYPES(static_set_small_batch,
+                    NVBENCH_TYPE_AXES(defaults::KEY_TYPE_RANGE,
+                                      nvbench::type_list<insert_op, contains_op, find_op, size_op>))
+  .set_name("static_set_small_batch_latency")
+  .set_type_axes_names({"Key", "Op"})
+  .set_max_noise(defaults::MAX_NOISE)
+  .add_int64_axis("BatchSize", defaults::SMALL_BATCH_SIZE_RANGE)
+  .add_string_axis("Mode", {"sync", "async"});
@@ -0,0 +1,277 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <defaults.hpp>
+#include <trace.hpp>
+#include <utils.hpp>
+
+#include <cuco/dynamic_map.cuh>
+#include <cuco/static_map.cuh>
+#include <cuco/static_set.cuh>
+
+#include <nvbench/nvbench.cuh>
+
+#include <thrust/device_vector.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+using namespace cuco::benchmark;
+
+/// Replays the trace against `cuco::experimental::static_set`
+struct static_set_backend {
+};
+/// Replays the trace against `cuco::static_map`
+struct static_map_backend {
+};
+/// Replays the trace against `cuco::dynamic_map`
+struct dynamic_map_backend {
+};
+/// Replays the trace against `std::unordered_map` on the host
+struct host_backend {
+};
+
+NVBENCH_DECLARE_TYPE_STRINGS(static_set_backend, "static_set", "static_set_backend");
+NVBENCH_DECLARE_TYPE_STRINGS(static_map_backend, "static_map", "static_map_backend");
+NVBENCH_DECLARE_TYPE_STRINGS(dynamic_map_backend, "dynamic_map", "dynamic_map_backend");
+NVBENCH_DECLARE_TYPE_STRINGS(host_backend, "host", "host_backend");
+
+/**
+ * @brief Replays all batches of a trace on the device, recording the latency of each batch.
+ *
+ * @tparam MakeContainer Type of callable creating an empty container
+ * @tparam RunBatch Type of callable replaying a batch against the container
+ *
+ * @param state Benchmark state
+ * @param batches Batches of the trace
+ * @param latencies Per-batch latencies in seconds of the last replay
+ * @param make_container Callable creating an empty container
+ * @param run_batch Callable replaying a batch against the container on the given stream
+ */
+template <typename MakeContainer, typename RunBatch>
+void replay_on_device(nvbench::state& state,
+                      std::vector<trace::batch> const& batches,
+                      std::vector<double>& latencies,
+                      MakeContainer make_container,
+                      RunBatch run_batch)
+{
+  std::vector<cudaEvent_t> events(batches.size() + 1);
+  for (auto& event : events) {
+    CUCO_CUDA_TRY(cudaEventCreate(&event));
+  }
+
+  state.exec(
+    nvbench::exec_tag::sync | nvbench::exec_tag::timer, [&](nvbench::launch& launch, auto& timer) {
+      auto const stream = launch.get_stream();
+      auto container    = make_container();
+
+      timer.start();
+      CUCO_CUDA_TRY(cudaEventRecord(events.front(), stream));
+      for (std::size_t i = 0; i < batches.size(); ++i) {
+        run_batch(container, batches[i], stream);
+        CUCO_CUDA_TRY(cudaEventRecord(events[i + 1], stream));
+      }
+      timer.stop();
+
+      CUCO_CUDA_TRY(cudaEventSynchronize(events.back()));
+      for (std::size_t i = 0; i < batches.size(); ++i) {
+        float milliseconds;
+        CUCO_CUDA_TRY(cudaEventElapsedTime(&milliseconds, events[i], events[i + 1]));
+        latencies[i] = milliseconds / 1'000.;
+      }
+    });
+
+  for (auto const event : events) {
+    CUCO_CUDA_TRY(cudaEventDestroy(event));
+  }
+}
+
+/**
+ * @brief A benchmark replaying a binary trace of operations captured from a real workload
+ *
+ * @note The trace is given by the `CUCO_BENCH_TRACE` environment variable or by the `Trace` axis.
+ * See `trace.hpp` for the trace format.
+ */
+template <typename Key, typename Value, typename Backend>
+std::enable_if_t<(sizeof(Key) == sizeof(Value)), void> trace_replay(
+  nvbench::state& state, nvbench::type_list<Key, Value, Backend>)
+{
+  using pair_type = cuco::pair<Key, Value>;
+
+  auto const path = state.get_string_or_default("Trace", trace::default_path());
+  if (path.empty()) {
+    state.skip("No trace given, set CUCO_BENCH_TRACE or pass -a Trace=<path>.");
+    return;
+  }
+  auto const batch_size = state.get_int64_or_default("BatchSize", defaults::BATCH_SIZE);
+  auto const occupancy  = state.get_float64_or_default("Occupancy", defaults::OCCUPANCY);
+
+  trace::mapped_file const file{path};
+  auto const batches = trace::make_batches(file.begin(), file.end(), batch_size);
+
+  auto const has_op = [&](trace::op type) {
+    return std::any_of(
+      batches.begin(), batches.end(), [type](auto const& batch) { return batch.type == type; });
+  };
+  if constexpr (std::is_same_v<Backend, static_set_backend>) {
+    if (has_op(trace::op::ERASE)) {
+      state.skip("static_set does not support erase.");
+      return;
+    }
+  }
+
+  // Sized for the worst case where every inserted key is distinct
+  auto const num_inserts = std::count_if(
+    file.begin(), file.end(), [](auto const& record) { return record.type == trace::op::INSERT; });
+  std::size_t const size = std::max<std::size_t>(num_inserts, 1) / occupancy;
+
+  std::vector<Key> h_keys(file.size());
+  std::vector<Value> h_values(file.size());
+  std::transform(file.begin(), file.end(), h_keys.begin(), [](auto const& record) {
+    return static_cast<Key>(record.key);
+  });
+  std::transform(file.begin(), file.end(), h_values.begin(), [](auto const& record) {
+    return static_cast<Value>(record.value);
+  });
+
+  state.add_element_count(file.size());
+  std::vector<double> latencies(batches.size());
+
+  if constexpr (std::is_same_v<Backend, host_backend>) {
+    // Written by every replay so that lookups cannot be optimized away
+    std::size_t num_found = 0;
+    state.exec(nvbench::exec_tag::sync | nvbench::exec_tag::timer,
+               [&](nvbench::launch&, auto& timer) {
+                 std::unordered_map<Key, Value> map;
+                 map.reserve(num_inserts);
+                 num_found = 0;
+
+                 timer.start();
+                 for (std::size_t i = 0; i < batches.size(); ++i) {
+                   auto const start = std::chrono::steady_clock::now();
+                   auto const first = batches[i].offset;
+                   auto const last  = first + batches[i].size;
+                   for (auto j = first; j < last; ++j) {
+                     switch (batches[i].type) {
+                       case trace::op::INSERT: map.emplace(h_keys[j], h_values[j]); break;
+                       case trace::op::FIND:
+                       case trace::op::CONTAINS: num_found += map.count(h_keys[j]); break;
+                       case trace::op::ERASE: map.erase(h_keys[j]); break;
+                     }
+                   }
+                   auto const elapsed = std::chrono::steady_clock::now() - start;
+                   latencies[i]       = std::chrono::duration<double>(elapsed).count();
+                 }
+                 timer.stop();
+               });
+  } else {
+    thrust::device_vector<Key> keys(h_keys);
+    std::vector<pair_type> h_pairs(file.size());
+    std::transform(h_keys.begin(),
+                   h_keys.end(),
+                   h_values.begin(),
+                   h_pairs.begin(),
+                   [](auto key, auto value) { return pair_type{key, value}; });
+    thrust::device_vector<pair_type> pairs(h_pairs);
+
+    std::size_t max_batch = 0;
+    for (auto const& batch : batches) {
+      max_batch = std::max(max_batch, batch.size);
+    }
+    thrust::device_vector<Key> found_keys(max_batch);
+    thrust::device_vector<Value> found_values(max_batch);
+    thrust::device_vector<bool> contained(max_batch);
+
+    if constexpr (std::is_same_v<Backend, static_set_backend>) {
+      replay_on_device(
+        state,
+        batches,
+        latencies,
+        [&]() { return cuco::experimental::static_set<Key>{size, cuco::empty_key<Key>{-1}}; },
+        [&](auto& set, trace::batch const& batch, cudaStream_t stream) {
+          auto const first = keys.begin() + batch.offset;
+          auto const last  = first + batch.size;
+          switch (batch.type) {
+            case trace::op::INSERT: set.insert(first, last, {stream}); break;
+            case trace::op::FIND: set.find(first, last, found_keys.begin(), {stream}); break;
+            case trace::op::CONTAINS: set.contains(first, last, contained.begin(), {stream}); break;
+            case trace::op::ERASE: break;
+          }
+        });
+    } else {
+      replay_on_device(
+        state,
+        batches,
+        latencies,
+        [&]() {
+          using map_type = std::conditional_t<std::is_same_v<Backend, static_map_backend>,
+                                              cuco::static_map<Key, Value>,
+                                              cuco::dynamic_map<Key, Value>>;
+          return map_type{size,
+                          cuco::empty_key<Key>{-1},
+                          cuco::empty_value<Value>{-1},
+                          cuco::erased_key<Key>{-2}};
+        },
+        [&](auto& map, trace::batch const& batch, cudaStream_t stream) {
+          auto const first = keys.begin() + batch.offset;
+          auto const last  = first + batch.size;
+          switch (batch.type) {
+            case trace::op::INSERT:
+              map.insert(pairs.begin() + batch.offset,
+                         pairs.begin() + batch.offset + batch.size,
+                         {},
+                         {},
+                         stream);
+              break;
+            case trace::op::FIND:
+              map.find(first, last, found_values.begin(), {}, {}, stream);
+              break;
+            case trace::op::CONTAINS:
+              map.contains(first, last, contained.begin(), {}, {}, stream);
+              break;
+            case trace::op::ERASE: map.erase(first, last, {}, {}, stream); break;
+          }
+        });
+    }
+  }
+
+  add_latency_summaries(state, "Batch", std::move(latencies));
+}
+
+template <typename Key, typename Value, typename Backend>
+std::enable_if_t<(sizeof(Key) != sizeof(Value)), void> trace_replay(
+  nvbench::state& state, nvbench::type_list<Key, Value, Backend>)
+{
+  state.skip("Key should be the same type as Value.");
+}
+
+NVBENCH_BENCH_TYPES(trace_replay,
+                    NVBENCH_TYPE_AXES(defaults::KEY_TYPE_RANGE,
+                                      defaults::VALUE_TYPE_RANGE,
+                                      nvbench::type_list<static_set_backend,
+                                                         static_map_backend,
+                                                         dynamic_map_backend,
+                                                         host_backend>))
+  .set_name("trace_replay")
+  .set_type_axes_names({"Key", "Value", "Backend"})
+  .set_max_noise(defaults::MAX_NOISE)
+  .add_string_axis("Trace", {trace::default_path()})
+  .add_int64_axis("BatchSize", defaults::BATCH_SIZE_RANGE);
@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cuco/detail/error.hpp>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+namespace cuco::benchmark::trace {
+
+/**
+ * @brief Operation types of a trace record.
+ */
+enum class op : uint8_t {
+  INSERT   = 0,  ///< Inserts `(key, value)`
+  FIND     = 1,  ///< Looks up the value of `key`
+  CONTAINS = 2,  ///< Checks if `key` is present
+  ERASE    = 3   ///< Erases `key`
+};
+
+/**
+ * @brief Binary layout of a trace record.
+ *
+ * A trace file is a plain array of records in native byte order, without header. The key and value
+ * are narrowed to the benchmarked key and value types. The values `-1` and `-2` of the benchmarked
+ * key type are reserved for the empty and erased sentinels.
+ */
+struct record {
+  op type;             ///< Operation type
+  uint8_t padding[7];  ///< Reserved, must be zero
+  uint64_t key;        ///< Key of the operation
+  uint64_t value;      ///< Value of the operation, only meaningful for `op::INSERT`
+};
+
+static_assert(sizeof(record) == 24, "Unexpected trace record layout");
+
+/**
+ * @brief Read-only memory mapping of a trace file.
+ */
+class mapped_file {
+ public:
+  /**
+   * @brief Maps the given trace file in memory.
+   *
+   * @param path Path of the trace file
+   *
+   * @throw If the file cannot be opened or mapped, or if its size is not a multiple of the record
+   * size
+   */
+  explicit mapped_file(std::string const& path)
+  {
+    fd_ = ::open(path.c_str(), O_RDONLY);
+    CUCO_EXPECTS(fd_ != -1, "Failed to open the trace file");
+
+    struct stat info;
+    CUCO_EXPECTS(::fstat(fd_, &info) == 0, "Failed to read the size of the trace file");
+    bytes_ = static_cast<std::size_t>(info.st_size);
+    CUCO_EXPECTS(bytes_ % sizeof(record) == 0, "Trace file is not an array of trace records");
+
+    if (bytes_ > 0) {
+      data_ = ::mmap(nullptr, bytes_, PROT_READ, MAP_PRIVATE, fd_, 0);
+      CUCO_EXPECTS(data_ != MAP_FAILED, "Failed to map the trace file");
+      ::madvise(data_, bytes_, MADV_SEQUENTIAL);
+    }
+  }
+
+  mapped_file(mapped_file const&) = delete;
+  mapped_file& operator=(mapped_file const&) = delete;
+
+  ~mapped_file()
+  {
+    if (data_ != nullptr) { ::munmap(data_, bytes_); }
+    if (fd_ != -1) { ::close(fd_); }
+  }
+
+  /**
+   * @brief Gets the first record of the trace.
+   *
+   * @return Pointer to the first record
+   */
+  [[nodiscard]] record const* begin() const noexcept { return static_cast<record const*>(data_); }
+
+  /**
+   * @brief Gets the past-the-end record of the trace.
+   *
+   * @return Pointer past the last record
+   */
+  [[nodiscard]] record const* end() const noexcept { return begin() + size(); }
+
+  /**
+   * @brief Gets the number of records of the trace.
+   *
+   * @return Number of records
+   */
+  [[nodiscard]] std::size_t size() const noexcept { return bytes_ / sizeof(record); }
+
+ private:
+  int fd_{-1};            ///< File descriptor of the trace
+  void* data_{nullptr};   ///< Mapped records
+  std::size_t bytes_{0};  ///< Size of the mapping in bytes
+};
+
+/**
+ * @brief Range of consecutive records of the same operation type, replayed by a single bulk call.
+ */
+struct batch {
+  op type;             ///< Operation type of the batch
+  std::size_t offset;  ///< Index of the first record of the batch
+  std::size_t size;    ///< Number of records of the batch
+};
+
+/**
+ * @brief Splits a trace into batches of at most `batch_size` consecutive records of the same
+ * operation type, preserving the order of the trace.
+ *
+ * @param first First record of the trace
+ * @param last Past-the-end record of the trace
+ * @param batch_size Maximum number of records per batch
+ *
+ * @return Batches of the trace
+ */
+inline std::vector<batch> make_batches(record const* first,
+                                       record const* last,
+                                       std::size_t batch_size)
+{
+  std::vector<batch> batches;
+  for (auto it = first; it != last; ++it) {
+    auto const offset = static_cast<std::size_t>(it - first);
+    if (batches.empty() or batches.back().type != it->type or batches.back().size == batch_size) {
+      batches.push_back(batch{it->type, offset, 0});
+    }
+    ++batches.back().size;
+  }
+  return batches;
+}
+
+/**
+ * @brief Gets the trace file to replay, given by the `CUCO_BENCH_TRACE` environment variable.
+ *
+ * @note The `Trace` axis overrides it from the command line, e.g., `-a Trace=/path/to/trace`.
+ *
+ * @return Path of the trace file, empty if none is set
+ */
+inline std::string default_path()
+{
+  auto const path = std::getenv("CUCO_BENCH_TRACE");
+  return path == nullptr ? std::string{} : std::string{path};
+}
+
+}  // namespace cuco::benchmark::trace
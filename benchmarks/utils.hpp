@@ -16,11 +16,20 @@
 
 #pragma once
 
+#include <cuco/capacity_plan.cuh>
 #include <cuco/detail/error.hpp>
+#include <cuco/table_analysis.hpp>
 #include <cuco/utility/key_generator.hpp>
 
 #include <nvbench/nvbench.cuh>
 
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
 namespace cuco::benchmark {
 
 template <typename Dist>
@@ -34,11 +43,120 @@ auto dist_from_state(nvbench::state const& state)
   } else if constexpr (std::is_same_v<Dist, cuco::utility::distribution::gaussian>) {
     auto const skew = state.get_float64_or_default("Skew", defaults::SKEW);
     return Dist{skew};
+  } else if constexpr (std::is_same_v<Dist, cuco::utility::distribution::zipf>) {
+    auto const alpha = state.get_float64_or_default("ZipfAlpha", defaults::ZIPF_ALPHA);
+    return Dist{alpha};
+  } else if constexpr (std::is_same_v<Dist, cuco::utility::distribution::hotset>) {
+    auto const fraction = state.get_float64_or_default("HotsetFraction", defaults::HOTSET_FRACTION);
+    auto const probability =
+      state.get_float64_or_default("HotsetProbability", defaults::HOTSET_PROBABILITY);
+    return Dist{fraction, probability};
   } else {
     CUCO_FAIL("Unexpected distribution type");
   }
 }
 
+/// Number of slots loaded per probing step by the bulk operations of `cuco::static_map` and
+/// `cuco::dynamic_map`
+inline constexpr int32_t legacy_step_slots = 4;
+
+/**
+ * @brief Reports the median, 90th and 99th percentiles and the maximum of the given latencies as
+ * benchmark summaries.
+ *
+ * @param state Benchmark state to report to
+ * @param name Name of the measured operation, e.g., "Batch"
+ * @param latencies Latencies in seconds
+ */
+inline void add_latency_summaries(nvbench::state& state,
+                                  std::string const& name,
+                                  std::vector<double> latencies)
+{
+  if (latencies.empty()) { return; }
+  std::sort(latencies.begin(), latencies.end());
+
+  auto const add_summary = [&](std::string const& stat, double value) {
+    auto& summary = state.add_summary("cuco/latency/" + name + "/" + stat);
+    summary.set_string("name", name + " " + stat);
+    summary.set_string("description", stat + " latency of a " + name + " operation");
+    summary.set_string("hint", "duration");
+    summary.set_float64("value", value);
+  };
+  for (auto const percentile : {50, 90, 99}) {
+    auto const rank = static_cast<std::size_t>(
+      std::ceil(percentile / 100. * static_cast<double>(latencies.size())));
+    add_summary("p" + std::to_string(percentile), latencies[std::max(rank, std::size_t{1}) - 1]);
+  }
+  add_summary("max", latencies.back());
+}
+
+/**
+ * @brief Mean number of probing steps of a lookup, measured on the given container.
+ *
+ * @param analysis Health report of the container
+ * @param matching_rate Fraction of lookups finding their key
+ *
+ * @return Mean number of probing steps per lookup
+ */
+inline double expected_probes(cuco::experimental::table_analysis const& analysis,
+                              double matching_rate)
+{
+  return matching_rate * analysis.expected_probes_hit +
+         (1. - matching_rate) * analysis.expected_probes_miss;
+}
+
+/**
+ * @brief Mean number of probing steps of a lookup, estimated from the load factor of a linear
+ * probing container that cannot be analyzed.
+ *
+ * @param load_factor Load factor of the container
+ * @param step_slots Number of slots loaded per probing step
+ * @param matching_rate Fraction of lookups finding their key
+ *
+ * @return Mean number of probing steps per lookup
+ */
+inline double expected_probes(double load_factor, int32_t step_slots, double matching_rate)
+{
+  using cuco::experimental::probing_model;
+  namespace detail = cuco::experimental::detail;
+
+  auto const hit  = detail::expected_probes_hit(load_factor, step_slots, probing_model::LINEAR);
+  auto const miss = detail::expected_probes_miss(load_factor, step_slots, probing_model::LINEAR);
+  return matching_rate * hit + (1. - matching_rate) * miss;
+}
+
+/**
+ * @brief Reports the global memory traffic of a bulk operation.
+ *
+ * nvbench derives the achieved bandwidth and its fraction of the device peak bandwidth from it,
+ * which shows how far the operation is from the memory roofline. The bytes read and written per
+ * operation are reported as summaries too.
+ *
+ * @param state Benchmark state to report to
+ * @param num_ops Number of operations, i.e., the element count of the benchmark
+ * @param read_bytes Bytes read per operation
+ * @param written_bytes Bytes written per operation
+ */
+inline void add_bandwidth_summaries(nvbench::state& state,
+                                    std::size_t num_ops,
+                                    double read_bytes,
+                                    double written_bytes)
+{
+  state.add_global_memory_reads<nvbench::int8_t>(static_cast<std::size_t>(read_bytes * num_ops),
+                                                 "BytesRead");
+  state.add_global_memory_writes<nvbench::int8_t>(
+    static_cast<std::size_t>(written_bytes * num_ops), "BytesWritten");
+
+  auto const add_summary = [&](std::string const& name, std::string const& stat, double value) {
+    auto& summary = state.add_summary("cuco/bytes_per_op/" + stat);
+    summary.set_string("name", name + "/Op");
+    summary.set_string("description", "Bytes " + stat + " per operation");
+    summary.set_float64("value", value);
+  };
+  add_summary("BytesRead", "read", read_bytes);
+  add_summary("BytesWritten", "written", written_bytes);
+}
+
 }  // namespace cuco::benchmark
 
 NVBENCH_DECLARE_TYPE_STRINGS(cuco::utility::distribution::unique, "UNIQUE", "distribution::unique");
@@ -48,3 +166,7 @@ NVBENCH_DECLARE_TYPE_STRINGS(cuco::utility::distribution::uniform,
 NVBENCH_DECLARE_TYPE_STRINGS(cuco::utility::distribution::gaussian,
                              "GAUSSIAN",
                              "distribution::gaussian");
+NVBENCH_DECLARE_TYPE_STRINGS(cuco::utility::distribution::zipf, "ZIPF", "distribution::zipf");
+NVBENCH_DECLARE_TYPE_STRINGS(cuco::utility::distribution::hotset,
+                             "HOTSET",
+                             "distribution::hotset");
@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cuco/extent.cuh>
+#include <cuco/probing_scheme.cuh>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace cuco {
+namespace experimental {
+
+/**
+ * @brief Probing models used to predict the cost of lookups.
+ */
+enum class probing_model : int32_t {
+  LINEAR,  ///< Consecutive probing steps, as done by `cuco::experimental::linear_probing`
+  UNIFORM  ///< Independent probing steps, as done by `cuco::experimental::double_hashing`
+};
+
+/**
+ * @brief Predicted memory footprint and probing cost of an open addressing container.
+ *
+ * Probe counts are measured in probing steps, i.e., in the number of times a thread (or a CG of
+ * `cg_size` threads) loads `cg_size * window_size` slots. With one slot per probing step, they
+ * are the classical asymptotic estimates of Knuth (linear probing) and of uniform hashing (double
+ * hashing). With larger probing steps, they are approximations that assume the slots visited by a
+ * probing step are filled independently of each other.
+ */
+struct capacity_plan {
+  int32_t cg_size;              ///< Number of threads (and windows) per probing step
+  int32_t window_size;          ///< Number of slots per window
+  probing_model model;          ///< Probing model of the predictions
+  std::size_t num_windows;      ///< Actual window extent, after rounding to a valid size
+  std::size_t capacity;         ///< Actual number of slots
+  std::size_t bytes;            ///< Bytes allocated for the slots
+  double load_factor;           ///< Load factor once all expected keys are inserted
+  double expected_probes_hit;   ///< Expected number of probing steps of a successful lookup
+  double expected_probes_miss;  ///< Expected number of probing steps of an unsuccessful lookup
+};
+
+/**
+ * @brief Predicts the memory footprint and probing cost of a container type before allocating it.
+ *
+ * @note The capacity is computed with `make_window_extent`, i.e., exactly as the container
+ * constructor would compute it for a requested capacity of `expected_keys / target_load`.
+ *
+ * @tparam Container Container type to plan for, e.g., `cuco::experimental::static_set<...>`
+ *
+ * @param expected_keys Number of keys expected to be inserted
+ * @param target_load Desired load factor, in `(0, 1]`
+ *
+ * @throw If `target_load` is not in `(0, 1]`
+ * @throw If the resulting capacity is invalid
+ *
+ * @return Capacity plan of the container
+ */
+template <typename Container>
+[[nodiscard]] capacity_plan plan(std::size_t expected_keys, double target_load);
+
+/**
+ * @brief Predicts the memory footprint and probing cost of a configuration before allocating it.
+ *
+ * @param expected_keys Number of keys expected to be inserted
+ * @param target_load Desired load factor, in `(0, 1]`
+ * @param cg_size Number of threads per probing step
+ * @param window_size Number of slots per window
+ * @param slot_bytes Size of a slot in bytes, i.e., `sizeof(Container::value_type)`
+ * @param model Probing model of the container
+ *
+ * @throw If `target_load` is not in `(0, 1]`
+ * @throw If the resulting capacity is invalid
+ *
+ * @return Capacity plan of the configuration
+ */
+[[nodiscard]] capacity_plan plan(std::size_t expected_keys,
+                                 double target_load,
+                                 int32_t cg_size,
+                                 int32_t window_size,
+                                 std::size_t slot_bytes,
+                                 probing_model model);
+
+/**
+ * @brief Finds the configuration that uses the least memory while keeping unsuccessful lookups
+ * within the given probe budget.
+ *
+ * The search covers CG sizes and window sizes of 1, 2, 4 and 8 and, for each of them, the highest
+ * load factor meeting the budget. Ties in memory are broken in favor of the smaller CG size, then
+ * of the smaller window size.
+ *
+ * @note The budget bounds `expected_probes_miss`, which is never smaller than
+ * `expected_probes_hit`.
+ *
+ * @param expected_keys Number of keys expected to be inserted
+ * @param max_expected_probes Largest acceptable expected number of probing steps, larger than 1
+ * @param slot_bytes Size of a slot in bytes, i.e., `sizeof(Container::value_type)`
+ * @param model Probing model of the container
+ *
+ * @throw If `max_expected_probes` is not larger than 1
+ *
+ * @return Capacity plan of the configuration with the smallest memory footprint
+ */
+[[nodiscard]] capacity_plan min_memory_plan(std::size_t expected_keys,
+                                            double max_expected_probes,
+                                            std::size_t slot_bytes,
+                                            probing_model model);
+
+}  // namespace experimental
+}  // namespace cuco
+
+#include <cuco/detail/capacity_plan/capacity_plan.inl>
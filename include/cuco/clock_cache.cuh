@@ -0,0 +1,439 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cuco/clock_cache_ref.cuh>
+#include <cuco/detail/__config>
+#include <cuco/detail/open_addressing_impl.cuh>
+#include <cuco/detail/storage/storage.cuh>
+#include <cuco/hash_functions.cuh>
+#include <cuco/pair.cuh>
+#include <cuco/sentinel.cuh>
+#include <cuco/utility/allocator.hpp>
+#include <cuco/utility/traits.hpp>
+
+#include <thrust/functional.h>
+
+#include <cuda/std/atomic>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace cuco {
+namespace experimental {
+/**
+ * @brief A GPU-accelerated, fixed-capacity cache of key-value pairs with unique keys that evicts
+ * cold keys using a CLOCK (second chance) replacement policy.
+ *
+ * The `clock_cache` is a set-associative cache built on the window storage of the open addressing
+ * containers: the first window of the probing sequence of a key is its home window and the key can
+ * only be stored in one of the slots of that window. Every slot carries a reference flag that is
+ * set when the key is inserted and whenever it is hit.
+ *
+ * - `find` and `find_or_insert` mark hit keys as referenced. `contains` does not.
+ * - Inserting a new key into a full window sweeps the window from its clock hand, clears the
+ *   reference flag of every referenced slot it passes and evicts the first unreferenced one. If all
+ *   slots were referenced, the sweep is repeated. The hand of every window persists across
+ *   insertions, so that each sweep resumes after the previous victim.
+ * - `find_or_insert` reports which keys missed the cache so that the caller can fetch their
+ *   payloads from a slower tier, e.g., when caching the rows of an embedding table that does not
+ *   fit in device memory.
+ *
+ * Since the probing sequence never leaves the home window, inserts always succeed without growing
+ * the container and lookups probe exactly one window. Larger windows, e.g.,
+ * `cuco::experimental::aow_storage<8>`, increase the associativity of the cache.
+ *
+ * @note The reference flag shares the 8-byte payload word with the mapped value, thus the mapped
+ * type can be at most 4 bytes large.
+ * @note cuCollections data stuctures always place the slot keys on the left-hand side when invoking
+ * the key comparison predicate, i.e., `pred(slot_key, query_key)`. Order-sensitive `KeyEqual`
+ * should be used with caution.
+ *
+ * @throw If the size of the given key type is larger than 8 bytes
+ * @throw If the size of the given payload type is larger than 4 bytes
+ * @throw If the given key type doesn't have unique object representations, i.e.,
+ * `cuco::bitwise_comparable_v<Key> == false`
+ * @throw If the given mapped type doesn't have unique object representations, i.e.,
+ * `cuco::bitwise_comparable_v<T> == false`
+ * @throw If the probing scheme type is not inherited from `cuco::detail::probing_scheme_base`
+ * @throw If the probing scheme is a cooperative probing scheme, i.e., `ProbingScheme::cg_size > 1`
+ *
+ * @tparam Key Type used for keys. Requires `cuco::is_bitwise_comparable_v<Key>`
+ * @tparam T Type of the mapped values. Requires `cuco::is_bitwise_comparable_v<T>`
+ * @tparam Extent Data structure size type
+ * @tparam Scope The scope in which operations will be performed by individual threads.
+ * @tparam KeyEqual Binary callable type used to compare two keys for equality
+ * @tparam ProbingScheme Probing scheme used to determine the home window of a key (see
+ * `include/cuco/probing_scheme.cuh` for choices)
+ * @tparam Allocator Type of allocator used for device storage
+ * @tparam Storage Slot window storage type
+ */
+template <class Key,
+          class T,
+          class Extent             = cuco::experimental::extent<std::size_t>,
+          cuda::thread_scope Scope = cuda::thread_scope_device,
+          class KeyEqual           = thrust::equal_to<Key>,
+          class ProbingScheme =
+            cuco::experimental::linear_probing<1,  // CG size
+                                               cuco::default_hash_function<Key>>,
+          class Allocator = cuco::cuda_allocator<cuco::pair<Key, T>>,
+          class Storage   = cuco::experimental::aow_storage<8>>
+class clock_cache {
+  static_assert(sizeof(Key) <= 8, "Container does not support key types larger than 8 bytes.");
+
+  static_assert(sizeof(T) <= 4, "Container does not support payload types larger than 4 bytes.");
+
+  static_assert(cuco::is_bitwise_comparable_v<T>,
+                "Mapped type must have unique object representations or have been explicitly "
+                "declared as safe for bitwise comparison via specialization of "
+                "cuco::is_bitwise_comparable_v<T>.");
+
+ public:
+  using flag_type = std::uint32_t;  ///< Type of the per-slot reference flag
+
+ private:
+  using payload_type = cuco::pair<T, flag_type>;
+  using slot_type    = cuco::pair<Key, payload_type>;
+  using impl_type    = detail::open_addressing_impl<Key,
+                                                    slot_type,
+                                                    Extent,
+                                                    Scope,
+                                                    KeyEqual,
+                                                    ProbingScheme,
+                                                    Allocator,
+                                                    Storage>;
+  /// Storage of the clock hand of every window
+  using hand_storage_type = detail::storage<cuco::experimental::aow_storage<1>,
+                                            std::uint32_t,
+                                            cuco::experimental::extent<std::size_t>,
+                                            Allocator>;
+
+ public:
+  static constexpr auto cg_size      = impl_type::cg_size;       ///< CG size used for probing
+  static constexpr auto window_size  = impl_type::window_size;   ///< Window size used for probing
+  static constexpr auto thread_scope = impl_type::thread_scope;  ///< CUDA thread scope
+
+  using key_type       = typename impl_type::key_type;        ///< Key type
+  using mapped_type    = T;                                   ///< Payload type
+  using value_type     = cuco::pair<key_type, mapped_type>;   ///< Key-value pair type
+  using extent_type    = typename impl_type::extent_type;     ///< Extent type
+  using size_type      = typename impl_type::size_type;       ///< Size type
+  using key_equal      = typename impl_type::key_equal;       ///< Key equality comparator type
+  using allocator_type = typename impl_type::allocator_type;  ///< Allocator type
+  /// Non-owning window storage ref type
+  using storage_ref_type    = typename impl_type::storage_ref_type;
+  using probing_scheme_type = typename impl_type::probing_scheme_type;  ///< Probing scheme type
+
+  template <typename... Operators>
+  using ref_type =
+    cuco::experimental::clock_cache_ref<key_type,
+                                        mapped_type,
+                                        thread_scope,
+                                        key_equal,
+                                        probing_scheme_type,
+                                        storage_ref_type,
+                                        Operators...>;  ///< Non-owning container ref type
+
+  clock_cache(clock_cache const&) = delete;
+  clock_cache& operator=(clock_cache const&) = delete;
+
+  clock_cache(clock_cache&&) = default;  ///< Move constructor
+
+  /**
+   * @brief Replaces the contents of the container with another container.
+   *
+   * @return Reference of the current cache object
+   */
+  clock_cache& operator=(clock_cache&&) = default;
+  ~clock_cache()                        = default;
+
+  /**
+   * @brief Constructs a fixed-capacity clock cache with the specified capacity, sentinel values and
+   * CUDA stream.
+   *
+   * The actual cache capacity depends on the given `capacity`, the probing scheme and the window
+   * size and it is computed via the `make_window_extent` factory. Once the home window of a key is
+   * full, inserting the key evicts another key of the same window.
+   *
+   * @note Any `*_sentinel`s are reserved and behavior is undefined when attempting to insert
+   * this sentinel value.
+   * @note If a non-default CUDA stream is provided, the caller is responsible for synchronizing the
+   * stream before the object is first used.
+   *
+   * @param capacity The requested lower-bound cache size
+   * @param empty_key_sentinel The reserved key value for empty slots
+   * @param empty_value_sentinel The reserved mapped value for empty slots
+   * @param pred Key equality binary predicate
+   * @param probing_scheme Probing scheme
+   * @param alloc Allocator used for allocating device storage
+   * @param stream CUDA stream used to initialize the cache
+   */
+  clock_cache(Extent capacity,
+              empty_key<Key> empty_key_sentinel,
+              empty_value<T> empty_value_sentinel,
+              KeyEqual const& pred                = {},
+              ProbingScheme const& probing_scheme = {},
+              Allocator const& alloc              = {},
+              cuda_stream_ref stream              = {});
+
+  /**
+   * @brief Erases all elements from the container. After this call, `size()` returns zero.
+   * Invalidates any references, pointers, or iterators referring to contained elements.
+   *
+   * @param stream CUDA stream this operation is executed in
+   */
+  void clear(cuda_stream_ref stream = {}) noexcept;
+
+  /**
+   * @brief Asynchronously erases all elements from the container. After this call, `size()` returns
+   * zero. Invalidates any references, pointers, or iterators referring to contained elements.
+   *
+   * @param stream CUDA stream this operation is executed in
+   */
+  void clear_async(cuda_stream_ref stream = {}) noexcept;
+
+  /**
+   * @brief Inserts all key-value pairs in the range `[first, last)`, evicting cold keys when
+   * needed, and returns the number of successful insertions.
+   *
+   * @note A pair whose key is already cached is not inserted and marks the cached key as
+   * referenced.
+   * @note This function synchronizes the given stream. For asynchronous execution use
+   * `insert_async`.
+   *
+   * @tparam InputIt Device accessible random access input iterator where
+   * <tt>std::is_convertible<std::iterator_traits<InputIt>::value_type,
+   * clock_cache<K, V>::value_type></tt> is `true`
+   *
+   * @param first Beginning of the sequence of key-value pairs
+   * @param last End of the sequence of key-value pairs
+   * @param stream CUDA stream used for insert
+   *
+   * @return Number of successful insertions
+   */
+  template <typename InputIt>
+  size_type insert(InputIt first, InputIt last, cuda_stream_ref stream = {});
+
+  /**
+   * @brief Asynchonously inserts all key-value pairs in the range `[first, last)`, evicting cold
+   * keys when needed.
+   *
+   * @tparam InputIt Device accessible random access input iterator where
+   * <tt>std::is_convertible<std::iterator_traits<InputIt>::value_type,
+   * clock_cache<K, V>::value_type></tt> is `true`
+   *
+   * @param first Beginning of the sequence of key-value pairs
+   * @param last End of the sequence of key-value pairs
+   * @param stream CUDA stream used for insert
+   */
+  template <typename InputIt>
+  void insert_async(InputIt first, InputIt last, cuda_stream_ref stream = {}) noexcept;
+
+  /**
+   * @brief Indicates whether the keys in the range `[first, last)` are cached.
+   *
+   * @note Unlike `find`, this function does not mark the keys as referenced.
+   * @note This function synchronizes the given stream. For asynchronous execution use
+   * `contains_async`.
+   *
+   * @tparam InputIt Device accessible input iterator
+   * @tparam OutputIt Device accessible output iterator assignable from `bool`
+   *
+   * @param first Beginning of the sequence of keys
+   * @param last End of the sequence of keys
+   * @param output_begin Beginning of the sequence of booleans for the presence of each key
+   * @param stream Stream used for executing the kernels
+   */
+  template <typename InputIt, typename OutputIt>
+  void contains(InputIt first,
+                InputIt last,
+                OutputIt output_begin,
+                cuda_stream_ref stream = {}) const;
+
+  /**
+   * @brief Asynchronously indicates whether the keys in the range `[first, last)` are cached.
+   *
+   * @note Unlike `find_async`, this function does not mark the keys as referenced.
+   *
+   * @tparam InputIt Device accessible input iterator
+   * @tparam OutputIt Device accessible output iterator assignable from `bool`
+   *
+   * @param first Beginning of the sequence of keys
+   * @param last End of the sequence of keys
+   * @param output_begin Beginning of the sequence of booleans for the presence of each key
+   * @param stream Stream used for executing the kernels
+   */
+  template <typename InputIt, typename OutputIt>
+  void contains_async(InputIt first,
+                      InputIt last,
+                      OutputIt output_begin,
+                      cuda_stream_ref stream = {}) const noexcept;
+
+  /**
+   * @brief For all keys in the range `[first, last)`, finds a payload with its key equivalent to
+   * the query key and marks the key as referenced.
+   *
+   * @note This function synchronizes the given stream. For asynchronous execution use
+   * `find_async`.
+   * @note If the key `*(first + i)` is cached, copies its payload to `(output_begin + i)`. Else,
+   * copies the empty value sentinel.
+   *
+   * @tparam InputIt Device accessible input iterator
+   * @tparam OutputIt Device accessible output iterator assignable from the cache's `mapped_type`
+   *
+   * @param first Beginning of the sequence of keys
+   * @param last End of the sequence of keys
+   * @param output_begin Beginning of the sequence of payloads retrieved for each key
+   * @param stream Stream used for executing the kernels
+   */
+  template <typename InputIt, typename OutputIt>
+  void find(InputIt first, InputIt last, OutputIt output_begin, cuda_stream_ref stream = {});
+
+  /**
+   * @brief For all keys in the range `[first, last)`, asynchronously finds a payload with its key
+   * equivalent to the query key and marks the key as referenced.
+   *
+   * @note If the key `*(first + i)` is cached, copies its payload to `(output_begin + i)`. Else,
+   * copies the empty value sentinel.
+   *
+   * @tparam InputIt Device accessible input iterator
+   * @tparam OutputIt Device accessible output iterator assignable from the cache's `mapped_type`
+   *
+   * @param first Beginning of the sequence of keys
+   * @param last End of the sequence of keys
+   * @param output_begin Beginning of the sequence of payloads retrieved for each key
+   * @param stream Stream used for executing the kernels
+   */
+  template <typename InputIt, typename OutputIt>
+  void find_async(InputIt first,
+                  InputIt last,
+                  OutputIt output_begin,
+                  cuda_stream_ref stream = {}) noexcept;
+
+  /**
+   * @brief Looks up all key-value pairs in the range `[first, last)` and inserts the ones whose
+   * key misses the cache, evicting cold keys when needed. Returns the number of misses.
+   *
+   * @note For every pair `*(first + i)`, writes `false` to `(miss_begin + i)` and copies the
+   * cached payload to `(output_begin + i)` if its key is cached. Otherwise, inserts the pair,
+   * writes `true` to `(miss_begin + i)` and copies the payload of the pair to `(output_begin + i)`.
+   * The caller is expected to fetch the missing entries, e.g., by treating the payload as a row
+   * index into a device buffer and filling the rows of the misses.
+   * @note If multiple pairs in `[first, last)` share the same key, exactly one of them is reported
+   * as a miss.
+   * @note This function synchronizes the given stream. For asynchronous execution use
+   * `find_or_insert_async`.
+   *
+   * @tparam InputIt Device accessible random access input iterator where
+   * <tt>std::is_convertible<std::iterator_traits<InputIt>::value_type,
+   * clock_cache<K, V>::value_type></tt> is `true`
+   * @tparam OutputIt Device accessible output iterator assignable from the cache's `mapped_type`
+   * @tparam MissIt Device accessible output iterator assignable from `bool`
+   *
+   * @param first Beginning of the sequence of key-value pairs
+   * @param last End of the sequence of key-value pairs
+   * @param output_begin Beginning of the sequence of payloads retrieved for each pair
+   * @param miss_begin Beginning of the sequence of booleans indicating whether each key missed
+   * @param stream Stream used for executing the kernels
+   *
+   * @return Number of keys that missed the cache
+   */
+  template <typename InputIt, typename OutputIt, typename MissIt>
+  size_type find_or_insert(InputIt first,
+                           InputIt last,
+                           OutputIt output_begin,
+                           MissIt miss_begin,
+                           cuda_stream_ref stream = {});
+
+  /**
+   * @brief Asynchronously looks up all key-value pairs in the range `[first, last)` and inserts
+   * the ones whose key misses the cache, evicting cold keys when needed.
+   *
+   * @note See `find_or_insert` for the content written to `output_begin` and `miss_begin`.
+   *
+   * @tparam InputIt Device accessible random access input iterator where
+   * <tt>std::is_convertible<std::iterator_traits<InputIt>::value_type,
+   * clock_cache<K, V>::value_type></tt> is `true`
+   * @tparam OutputIt Device accessible output iterator assignable from the cache's `mapped_type`
+   * @tparam MissIt Device accessible output iterator assignable from `bool`
+   *
+   * @param first Beginning of the sequence of key-value pairs
+   * @param last End of the sequence of key-value pairs
+   * @param output_begin Beginning of the sequence of payloads retrieved for each pair
+   * @param miss_begin Beginning of the sequence of booleans indicating whether each key missed
+   * @param stream Stream used for executing the kernels
+   */
+  template <typename InputIt, typename OutputIt, typename MissIt>
+  void find_or_insert_async(InputIt first,
+                            InputIt last,
+                            OutputIt output_begin,
+                            MissIt miss_begin,
+                            cuda_stream_ref stream = {}) noexcept;
+
+  /**
+   * @brief Gets the number of elements in the container.
+   *
+   * @note This function synchronizes the given stream.
+   *
+   * @param stream CUDA stream used to get the number of inserted elements
+   * @return The number of elements in the container
+   */
+  [[nodiscard]] size_type size(cuda_stream_ref stream = {}) const noexcept;
+
+  /**
+   * @brief Gets the maximum number of elements the cache can hold.
+   *
+   * @return The maximum number of elements the cache can hold
+   */
+  [[nodiscard]] constexpr auto capacity() const noexcept;
+
+  /**
+   * @brief Gets the sentinel value used to represent an empty key slot.
+   *
+   * @return The sentinel value used to represent an empty key slot
+   */
+  [[nodiscard]] constexpr key_type empty_key_sentinel() const noexcept;
+
+  /**
+   * @brief Gets the sentinel value used to represent an empty value slot.
+   *
+   * @return The sentinel value used to represent an empty value slot
+   */
+  [[nodiscard]] constexpr mapped_type empty_value_sentinel() const noexcept;
+
+  /**
+   * @brief Get device ref with operators.
+   *
+   * @tparam Operators Set of `cuco::op` to be provided by the ref
+   *
+   * @param ops List of operators, e.g., `cuco::insert`
+   *
+   * @return Device ref of the current `clock_cache` object
+   */
+  template <typename... Operators>
+  [[nodiscard]] auto ref(Operators... ops) const noexcept;
+
+ private:
+  std::unique_ptr<impl_type> impl_;           ///< Open addressing implementation
+  mapped_type empty_value_sentinel_;          ///< Sentinel value that indicates an empty payload
+  std::unique_ptr<hand_storage_type> hands_;  ///< Clock hand of every window
+};
+}  // namespace experimental
+}  // namespace cuco
+
+#include <cuco/detail/clock_cache/clock_cache.inl>
@@ -0,0 +1,271 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cuco/detail/equal_wrapper.cuh>
+#include <cuco/operator.hpp>
+#include <cuco/pair.cuh>
+#include <cuco/sentinel.cuh>
+
+#include <thrust/pair.h>
+
+#include <cuda/std/atomic>
+
+#include <cstdint>
+
+namespace cuco {
+namespace experimental {
+
+/**
+ * @brief Device non-owning "ref" type of `cuco::experimental::clock_cache` that can be used in
+ * device code to perform `insert`, `insert_and_find`, `contains` and `find` operations.
+ *
+ * A key can only be stored in its home window, i.e., the first window of its probing sequence.
+ * Every slot carries a reference flag that is set whenever the slot is hit by `find`,
+ * `insert_and_find` or `insert`. Every window has a clock hand. Inserting a new key into a full
+ * window advances the hand of the window slot by slot, clearing the reference flag of every
+ * referenced slot it passes, and evicts the first unreferenced slot (CLOCK replacement with one
+ * clock per window). The hand persists across insertions, so the next sweep resumes after the
+ * last victim.
+ *
+ * @note Concurrent modify and lookup will be supported if both kinds of operators are specified
+ * during the ref construction.
+ * @note cuCollections data stuctures always place the slot keys on the left-hand
+ * side when invoking the key comparison predicate.
+ * @note Ref types are trivially-copyable and are intended to be passed by value.
+ *
+ * @throw If the size of the given key type is larger than 8 bytes
+ * @throw If the size of the given payload type is larger than 4 bytes
+ * @throw If the given key type doesn't have unique object representations, i.e.,
+ * `cuco::bitwise_comparable_v<Key> == false`
+ * @throw If the given mapped type doesn't have unique object representations, i.e.,
+ * `cuco::bitwise_comparable_v<T> == false`
+ * @throw If the probing scheme is a cooperative probing scheme, i.e., `ProbingScheme::cg_size > 1`
+ *
+ * @tparam Key Type used for keys. Requires `cuco::is_bitwise_comparable_v<Key>` returning true
+ * @tparam T Type used for mapped values. Requires `cuco::is_bitwise_comparable_v<T>` returning true
+ * @tparam Scope The scope in which operations will be performed by individual threads.
+ * @tparam KeyEqual Binary callable type used to compare two keys for equality
+ * @tparam ProbingScheme Probing scheme used to determine the home window of a key
+ * @tparam StorageRef Storage ref type
+ * @tparam Operators Device operator options defined in `include/cuco/operator.hpp`
+ */
+template <typename Key,
+          typename T,
+          cuda::thread_scope Scope,
+          typename KeyEqual,
+          typename ProbingScheme,
+          typename StorageRef,
+          typename... Operators>
+class clock_cache_ref
+  : public detail::operator_impl<
+      Operators,
+      clock_cache_ref<Key, T, Scope, KeyEqual, ProbingScheme, StorageRef, Operators...>>... {
+  static_assert(sizeof(Key) <= 8, "Container does not support key types larger than 8 bytes.");
+
+  static_assert(sizeof(T) <= 4, "Container does not support payload types larger than 4 bytes.");
+
+  static_assert(
+    cuco::is_bitwise_comparable_v<Key>,
+    "Key type must have unique object representations or have been explicitly declared as safe for "
+    "bitwise comparison via specialization of cuco::is_bitwise_comparable_v<Key>.");
+
+  static_assert(cuco::is_bitwise_comparable_v<T>,
+                "Mapped type must have unique object representations or have been explicitly "
+                "declared as safe for bitwise comparison via specialization of "
+                "cuco::is_bitwise_comparable_v<T>.");
+
+  static_assert(ProbingScheme::cg_size == 1,
+                "Container only supports non-cooperative probing schemes.");
+
+ public:
+  using key_type            = Key;                                     ///< Key type
+  using mapped_type         = T;                                       ///< Mapped type
+  using value_type          = cuco::pair<key_type, mapped_type>;       ///< Key-value pair type
+  using probing_scheme_type = ProbingScheme;                           ///< Type of probing scheme
+  using storage_ref_type    = StorageRef;                              ///< Type of storage ref
+  using window_type         = typename storage_ref_type::window_type;  ///< Window type
+  using slot_type           = typename storage_ref_type::value_type;   ///< Storage element type
+  using payload_type        = typename slot_type::second_type;         ///< Flagged payload type
+  using flag_type           = typename payload_type::second_type;      ///< Reference flag type
+  using extent_type         = typename storage_ref_type::extent_type;  ///< Extent type
+  using size_type           = typename storage_ref_type::size_type;    ///< Probing scheme size type
+  using key_equal           = KeyEqual;  ///< Type of key equality binary callable
+  using iterator            = typename storage_ref_type::iterator;   ///< Slot iterator type
+  using const_iterator = typename storage_ref_type::const_iterator;  ///< Const slot iterator type
+
+  static constexpr auto cg_size = probing_scheme_type::cg_size;  ///< Cooperative group size
+  static constexpr auto window_size =
+    storage_ref_type::window_size;  ///< Number of elements handled per window
+
+  /**
+   * @brief Constructs clock_cache_ref.
+   *
+   * @param empty_key_sentinel Sentinel indicating empty key
+   * @param empty_value_sentinel Sentinel indicating empty payload
+   * @param predicate Key equality binary callable
+   * @param probing_scheme Probing scheme
+   * @param storage_ref Non-owning ref of slot storage
+   * @param hands Pointer to the clock hand of every window
+   */
+  __host__ __device__ explicit constexpr clock_cache_ref(
+    cuco::empty_key<key_type> empty_key_sentinel,
+    cuco::empty_value<mapped_type> empty_value_sentinel,
+    key_equal const& predicate,
+    probing_scheme_type const& probing_scheme,
+    storage_ref_type storage_ref,
+    std::uint32_t* hands) noexcept;
+
+  /**
+   * @brief Gets the maximum number of elements the container can hold.
+   *
+   * @return The maximum number of elements the container can hold
+   */
+  [[nodiscard]] __host__ __device__ constexpr auto capacity() const noexcept;
+
+  /**
+   * @brief Gets the sentinel value used to represent an empty key slot.
+   *
+   * @return The sentinel value used to represent an empty key slot
+   */
+  [[nodiscard]] __host__ __device__ constexpr key_type empty_key_sentinel() const noexcept;
+
+  /**
+   * @brief Gets the sentinel value used to represent an empty value slot.
+   *
+   * @return The sentinel value used to represent an empty value slot
+   */
+  [[nodiscard]] __host__ __device__ constexpr mapped_type empty_value_sentinel() const noexcept;
+
+ private:
+  /**
+   * @brief Indicates whether the payload of the given slot is still being written by an insertion.
+   *
+   * @param slot The slot content
+   *
+   * @return `true` if the payload of the slot is not readable yet
+   */
+  [[nodiscard]] __device__ constexpr bool is_pending(slot_type const& slot) const noexcept;
+
+  /**
+   * @brief Finds the readable slot holding a key equivalent to `key` in the home window of `key`.
+   *
+   * @tparam ProbeKey Probe key type
+   *
+   * @param key The key to search for
+   *
+   * @return Pointer to the matching slot or `nullptr` if the key is not present
+   */
+  template <typename ProbeKey>
+  [[nodiscard]] __device__ slot_type* find_slot(ProbeKey const& key) const noexcept;
+
+  /**
+   * @brief Inserts an element into its home window, evicting an unreferenced element if the window
+   * is full.
+   *
+   * @param value The element to insert
+   *
+   * @return A pair consisting of a pointer to the slot holding the key and a bool indicating
+   * whether the insertion took place
+   */
+  __device__ thrust::pair<slot_type*, bool> insert_slot(value_type const& value) noexcept;
+
+  /**
+   * @brief Resolves concurrent insertions of the same key into different slots of a window.
+   *
+   * @note Among all slots of the window claimed for the key, the one with the lowest index is kept.
+   * If a claim with a higher index is seen, waits until it is either published or released.
+   *
+   * @param window_ptr Pointer to the first slot of the window
+   * @param intra_window_index Index of the slot claimed by this thread within the window
+   * @param key The key being inserted
+   *
+   * @return `true` if the claimed slot is the one to keep
+   */
+  [[nodiscard]] __device__ bool is_first_claim(slot_type const* window_ptr,
+                                               int32_t intra_window_index,
+                                               key_type const& key) const noexcept;
+
+  /**
+   * @brief Sets the reference flag of the given slot unless its payload is pending.
+   *
+   * @param slot Pointer to the slot in memory
+   */
+  __device__ void mark_referenced(slot_type* slot) noexcept;
+
+  /**
+   * @brief Atomically advances the clock hand of the given window by one slot.
+   *
+   * @param window_idx Index of the window
+   *
+   * @return Index of the slot the hand pointed to within the window
+   */
+  [[nodiscard]] __device__ int32_t advance_hand(size_type window_idx) noexcept;
+
+  /**
+   * @brief Compares the content of the address `address` (old value) with the `expected` value and,
+   * only if they are the same, sets the content of `address` to `desired`.
+   *
+   * @tparam U Address content type
+   *
+   * @param address The target address
+   * @param expected The value expected to be found at the target address
+   * @param desired The value to store at the target address if it is as expected
+   *
+   * @return The old value located at address `address`
+   */
+  template <typename U>
+  __device__ constexpr auto compare_and_swap(U* address, U expected, U desired);
+
+  /**
+   * @brief Loads the content of the given `address` bypassing any non-coherent cache.
+   *
+   * @tparam U Address content type
+   *
+   * @param address The target address
+   *
+   * @return The content located at address `address`
+   */
+  template <typename U>
+  [[nodiscard]] __device__ constexpr U atomic_load(U const* address) const noexcept;
+
+  /**
+   * @brief Atomically stores `value` at the given `address`.
+   *
+   * @tparam U Address content type
+   *
+   * @param address The target address
+   * @param value The value to store
+   */
+  template <typename U>
+  __device__ constexpr void atomic_store(U* address, U value);
+
+  detail::equal_wrapper<key_type, key_equal> predicate_;  ///< Key equality binary callable
+  mapped_type empty_value_sentinel_;                      ///< Empty value sentinel
+  probing_scheme_type probing_scheme_;                    ///< Probing scheme
+  storage_ref_type storage_ref_;                          ///< Slot storage ref
+  std::uint32_t* hands_;                                  ///< Clock hand of every window
+
+  // Mixins need to be friends with this class in order to access private members
+  template <typename Op, typename Ref>
+  friend class detail::operator_impl;
+};
+
+}  // namespace experimental
+}  // namespace cuco
+
+#include <cuco/detail/clock_cache/clock_cache_ref.inl>
@@ -0,0 +1,296 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cuco/counting_bloom_filter_ref.cuh>
+#include <cuco/cuda_stream_ref.hpp>
+#include <cuco/detail/__config>
+#include <cuco/detail/storage/storage.cuh>
+#include <cuco/extent.cuh>
+#include <cuco/hash_functions.cuh>
+#include <cuco/storage.cuh>
+#include <cuco/utility/allocator.hpp>
+
+#include <cuda/atomic>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace cuco {
+namespace experimental {
+/**
+ * @brief A GPU-accelerated counting Bloom filter supporting the removal of keys.
+ *
+ * The filter is an array of blocks, each of which is a 64-byte cache line holding 128 4-bit
+ * counters. A key is mapped to a single block and to `num_hashes` distinct counters within that
+ * block, so that each operation touches exactly one cache line.
+ *
+ * - `add` increments the counters of a key.
+ * - `remove` decrements the counters of a key.
+ * - `contains` reports whether all counters of a key are non-zero.
+ *
+ * Counters saturate: once a counter reaches 15, it is neither incremented nor decremented anymore.
+ * Saturation can therefore only cause false positives, never false negatives.
+ *
+ * @note `contains` never reports false negatives for added keys as long as no key is removed more
+ * often than it has been added. Removing a key that has not been added may introduce false
+ * negatives.
+ * @note The lookup operations are not guaranteed to observe concurrent `add` or `remove`
+ * operations issued on other streams.
+ * @note The hash function is expected to produce 64-bit hash values: the upper 32 bits select the
+ * block, and the lower and upper 32-bit halves seed the double hashing within the block. A 128-bit
+ * hash function, e.g., `cuco::xxhash_128`, selects the block with its lower half and seeds the
+ * double hashing with its upper half instead. Narrower hash values, e.g., of a 32-bit hash
+ * function, are remixed into 64 bits first.
+ *
+ * @tparam Key Type of the keys
+ * @tparam Extent Type of extent denoting the number of blocks
+ * @tparam Scope The scope in which operations will be performed by individual threads
+ * @tparam Hash Unary callable type used to hash the keys
+ * @tparam Allocator Type of allocator used for device storage
+ */
+template <class Key,
+          class Extent             = cuco::experimental::extent<std::size_t>,
+          cuda::thread_scope Scope = cuda::thread_scope_device,
+          class Hash               = cuco::xxhash_64<Key>,
+          class Allocator          = cuco::cuda_allocator<std::byte>>
+class counting_bloom_filter {
+ public:
+  using word_type = std::uint32_t;  ///< Type of the words the counters are packed into
+
+  static constexpr int32_t words_per_block = 16;     ///< Number of words in each 64-byte block
+  static constexpr auto thread_scope       = Scope;  ///< CUDA thread scope
+
+  /// Storage type of the counter blocks
+  using storage_type =
+    detail::storage<cuco::experimental::aow_storage<words_per_block>, word_type, Extent, Allocator>;
+
+  using key_type         = Key;                                     ///< Key type
+  using extent_type      = Extent;                                  ///< Extent type
+  using size_type        = typename extent_type::value_type;        ///< Size type
+  using hasher           = Hash;                                    ///< Hash function type
+  using allocator_type   = typename storage_type::allocator_type;   ///< Allocator type
+  using storage_ref_type = typename storage_type::ref_type;         ///< Storage ref type
+  using block_type       = typename storage_ref_type::window_type;  ///< Counter block type
+
+  /// Non-owning device ref type
+  using ref_type = counting_bloom_filter_ref<key_type, thread_scope, hasher, storage_ref_type>;
+
+  counting_bloom_filter(counting_bloom_filter const&) = delete;
+  counting_bloom_filter& operator=(counting_bloom_filter const&) = delete;
+
+  counting_bloom_filter(counting_bloom_filter&&) = default;  ///< Move constructor
+
+  /**
+   * @brief Replaces the contents of the filter with another filter.
+   *
+   * @return Reference of the current filter object
+   */
+  counting_bloom_filter& operator=(counting_bloom_filter&&) = default;
+  ~counting_bloom_filter()                                 = default;
+
+  /**
+   * @brief Constructs an empty counting Bloom filter with `num_blocks` blocks.
+   *
+   * @note The total number of counters is `num_blocks * 128`.
+   *
+   * @throw If `num_hashes` is not in the range `[1, 128]`
+   *
+   * @param num_blocks Number of 64-byte blocks of the filter
+   * @param num_hashes Number of counters each key is mapped to
+   * @param hash Hash function used to hash the keys
+   * @param alloc Allocator used for allocating device storage
+   * @param stream CUDA stream used to initialize the filter
+   */
+  constexpr counting_bloom_filter(Extent num_blocks,
+                                  int32_t num_hashes,
+                                  Hash const& hash       = {},
+                                  Allocator const& alloc = {},
+                                  cuda_stream_ref stream = {});
+
+  /**
+   * @brief Resets all counters to zero.
+   *
+   * @param stream CUDA stream this operation is executed in
+   */
+  void clear(cuda_stream_ref stream = {}) noexcept;
+
+  /**
+   * @brief Asynchronously resets all counters to zero.
+   *
+   * @param stream CUDA stream this operation is executed in
+   */
+  void clear_async(cuda_stream_ref stream = {}) noexcept;
+
+  /**
+   * @brief Adds all keys in the range `[first, last)`.
+   *
+   * @note This function synchronizes the given stream. For asynchronous execution use `add_async`.
+   *
+   * @tparam InputIt Device accessible random access input iterator where
+   * <tt>std::is_convertible<std::iterator_traits<InputIt>::value_type,
+   * counting_bloom_filter<K>::key_type></tt> is `true`
+   *
+   * @param first Beginning of the sequence of keys
+   * @param last End of the sequence of keys
+   * @param stream CUDA stream used for add
+   */
+  template <typename InputIt>
+  void add(InputIt first, InputIt last, cuda_stream_ref stream = {});
+
+  /**
+   * @brief Asynchronously adds all keys in the range `[first, last)`.
+   *
+   * @tparam InputIt Device accessible random access input iterator where
+   * <tt>std::is_convertible<std::iterator_traits<InputIt>::value_type,
+   * counting_bloom_filter<K>::key_type></tt> is `true`
+   *
+   * @param first Beginning of the sequence of keys
+   * @param last End of the sequence of keys
+   * @param stream CUDA stream used for add
+   */
+  template <typename InputIt>
+  void add_async(InputIt first, InputIt last, cuda_stream_ref stream = {}) noexcept;
+
+  /**
+   * @brief Removes all keys in the range `[first, last)`.
+   *
+   * @note This function synchronizes the given stream. For asynchronous execution use
+   * `remove_async`.
+   * @note Only keys that have been added should be removed, otherwise false negatives may occur.
+   *
+   * @tparam InputIt Device accessible random access input iterator where
+   * <tt>std::is_convertible<std::iterator_traits<InputIt>::value_type,
+   * counting_bloom_filter<K>::key_type></tt> is `true`
+   *
+   * @param first Beginning of the sequence of keys
+   * @param last End of the sequence of keys
+   * @param stream CUDA stream used for remove
+   */
+  template <typename InputIt>
+  void remove(InputIt first, InputIt last, cuda_stream_ref stream = {});
+
+  /**
+   * @brief Asynchronously removes all keys in the range `[first, last)`.
+   *
+   * @note Only keys that have been added should be removed, otherwise false negatives may occur.
+   *
+   * @tparam InputIt Device accessible random access input iterator where
+   * <tt>std::is_convertible<std::iterator_traits<InputIt>::value_type,
+   * counting_bloom_filter<K>::key_type></tt> is `true`
+   *
+   * @param first Beginning of the sequence of keys
+   * @param last End of the sequence of keys
+   * @param stream CUDA stream used for remove
+   */
+  template <typename InputIt>
+  void remove_async(InputIt first, InputIt last, cuda_stream_ref stream = {}) noexcept;
+
+  /**
+   * @brief Indicates whether the keys in the range `[first, last)` may be contained in the filter.
+   *
+   * @note This function synchronizes the given stream. For asynchronous execution use
+   * `contains_async`.
+   *
+   * @tparam InputIt Device accessible input iterator
+   * @tparam OutputIt Device accessible output iterator assignable from `bool`
+   *
+   * @param first Beginning of the sequence of keys
+   * @param last End of the sequence of keys
+   * @param output_begin Beginning of the sequence of booleans for the presence of each key
+   * @param stream Stream used for executing the kernels
+   */
+  template <typename InputIt, typename OutputIt>
+  void contains(InputIt first,
+                InputIt last,
+                OutputIt output_begin,
+                cuda_stream_ref stream = {}) const;
+
+  /**
+   * @brief Asynchronously indicates whether the keys in the range `[first, last)` may be contained
+   * in the filter.
+   *
+   * @tparam InputIt Device accessible input iterator
+   * @tparam OutputIt Device accessible output iterator assignable from `bool`
+   *
+   * @param first Beginning of the sequence of keys
+   * @param last End of the sequence of keys
+   * @param output_begin Beginning of the sequence of booleans for the presence of each key
+   * @param stream Stream used for executing the kernels
+   */
+  template <typename InputIt, typename OutputIt>
+  void contains_async(InputIt first,
+                      InputIt last,
+                      OutputIt output_begin,
+                      cuda_stream_ref stream = {}) const noexcept;
+
+  /**
+   * @brief Gets the number of blocks of the filter.
+   *
+   * @return The number of blocks of the filter
+   */
+  [[nodiscard]] constexpr auto num_blocks() const noexcept { return storage_->num_windows(); }
+
+  /**
+   * @brief Gets the number of counters each key is mapped to.
+   *
+   * @return The number of counters each key is mapped to
+   */
+  [[nodiscard]] constexpr int32_t num_hashes() const noexcept { return num_hashes_; }
+
+  /**
+   * @brief Gets the function used to hash the keys.
+   *
+   * @return The function used to hash the keys
+   */
+  [[nodiscard]] constexpr hasher hash_function() const noexcept { return hash_; }
+
+  /**
+   * @brief Gets the allocator.
+   *
+   * @return The allocator
+   */
+  [[nodiscard]] constexpr allocator_type allocator() const noexcept
+  {
+    return storage_->allocator();
+  }
+
+  /**
+   * @brief Gets the counter blocks.
+   *
+   * @return Device pointer to the first counter block
+   */
+  [[nodiscard]] constexpr block_type* data() const noexcept { return storage_->data(); }
+
+  /**
+   * @brief Gets a non-owning device ref of the filter.
+   *
+   * @return A device ref of the current filter
+   */
+  [[nodiscard]] constexpr ref_type ref() const noexcept;
+
+ private:
+  int32_t num_hashes_;                     ///< Number of counters each key is mapped to
+  hasher hash_;                            ///< Hash function
+  std::unique_ptr<storage_type> storage_;  ///< Counter block storage
+};
+
+}  // namespace experimental
+}  // namespace cuco
+
+#include <cuco/detail/counting_bloom_filter/counting_bloom_filter.inl>
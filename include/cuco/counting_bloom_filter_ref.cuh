@@ -0,0 +1,191 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cuda/atomic>
+#include <cuda/std/array>
+
+#include <cstdint>
+
+namespace cuco {
+namespace experimental {
+
+/**
+ * @brief Device non-owning "ref" type of `cuco::experimental::counting_bloom_filter` that can be
+ * used in device code to perform `add`, `remove` and `contains` operations.
+ *
+ * A key is hashed once. The upper 32 bits of the hash value select the block of the key. The
+ * lower and upper 32-bit halves then seed the first counter and the step of the double hashing
+ * sequence that selects `num_hashes` distinct counters within the block. If `Hash` returns a
+ * 128-bit hash as two 64-bit halves, e.g., `cuco::xxhash_128`, the block is selected by the upper
+ * 32 bits of the lower half and the counters are seeded by the upper half, so that the block and
+ * the counters of a key are independent. Hash values narrower than 64 bits, e.g., of
+ * `cuco::murmurhash3_32`, are first remixed into 64 bits.
+ *
+ * @note Ref types are trivially-copyable and are intended to be passed by value.
+ *
+ * @tparam Key Type of the keys
+ * @tparam Scope The scope in which operations will be performed by individual threads
+ * @tparam Hash Unary callable type used to hash the keys
+ * @tparam StorageRef Storage ref type of the counter blocks
+ */
+template <typename Key, cuda::thread_scope Scope, typename Hash, typename StorageRef>
+class counting_bloom_filter_ref {
+ public:
+  using key_type         = Key;                                     ///< Key type
+  using hasher           = Hash;                                    ///< Hash function type
+  using storage_ref_type = StorageRef;                              ///< Type of storage ref
+  using word_type        = typename storage_ref_type::value_type;   ///< Counter word type
+  using block_type       = typename storage_ref_type::window_type;  ///< Counter block type
+  using size_type        = typename storage_ref_type::size_type;    ///< Size type
+
+  static constexpr auto thread_scope    = Scope;  ///< CUDA thread scope
+  static constexpr int32_t counter_bits = 4;      ///< Number of bits of each counter
+  /// Value at which a counter saturates
+  static constexpr word_type counter_max = (word_type{1} << counter_bits) - 1;
+  /// Number of counters in each word
+  static constexpr int32_t counters_per_word = sizeof(word_type) * 8 / counter_bits;
+  /// Number of counters in each block
+  static constexpr int32_t counters_per_block = storage_ref_type::window_size * counters_per_word;
+
+  /**
+   * @brief Constructs counting_bloom_filter_ref.
+   *
+   * @param num_hashes Number of counters each key is mapped to
+   * @param hash Hash function used to hash the keys
+   * @param storage_ref Non-owning ref of the counter block storage
+   */
+  __host__ __device__ explicit constexpr counting_bloom_filter_ref(
+    int32_t num_hashes, hasher const& hash, storage_ref_type storage_ref) noexcept;
+
+  /**
+   * @brief Increments the counters of the given key.
+   *
+   * @tparam ProbeKey Input key type which is convertible to 'key_type'
+   *
+   * @param key The key to add
+   */
+  template <typename ProbeKey>
+  __device__ void add(ProbeKey const& key) noexcept;
+
+  /**
+   * @brief Decrements the counters of the given key.
+   *
+   * @note Saturated counters are not decremented.
+   *
+   * @tparam ProbeKey Input key type which is convertible to 'key_type'
+   *
+   * @param key The key to remove
+   */
+  template <typename ProbeKey>
+  __device__ void remove(ProbeKey const& key) noexcept;
+
+  /**
+   * @brief Indicates whether the given key may have been added to the filter.
+   *
+   * @tparam ProbeKey Input key type which is convertible to 'key_type'
+   *
+   * @param key The key to search for
+   *
+   * @return `true` if all counters of the key are non-zero
+   */
+  template <typename ProbeKey>
+  [[nodiscard]] __device__ bool contains(ProbeKey const& key) const noexcept;
+
+  /**
+   * @brief Gets the number of blocks of the filter.
+   *
+   * @return The number of blocks of the filter
+   */
+  [[nodiscard]] __host__ __device__ constexpr size_type num_blocks() const noexcept;
+
+  /**
+   * @brief Gets the number of counters each key is mapped to.
+   *
+   * @return The number of counters each key is mapped to
+   */
+  [[nodiscard]] __host__ __device__ constexpr int32_t num_hashes() const noexcept;
+
+ private:
+  /**
+   * @brief Hashes the given key into the values selecting its block and seeding its counters.
+   *
+   * @tparam ProbeKey Input key type which is convertible to 'key_type'
+   *
+   * @param key The key to hash
+   *
+   * @return The block hash value followed by the counter hash value
+   */
+  template <typename ProbeKey>
+  [[nodiscard]] __device__ constexpr cuda::std::array<std::uint64_t, 2> hash_key(
+    ProbeKey const& key) const noexcept;
+
+  /**
+   * @brief Computes the index of the block the given hash value is mapped to.
+   *
+   * @param hash_value Hash value of a key
+   *
+   * @return The block index
+   */
+  [[nodiscard]] __device__ constexpr size_type block_index(std::uint64_t hash_value) const noexcept;
+
+  /**
+   * @brief Computes the position of the `i`-th counter of a key within its block.
+   *
+   * @note The step is odd, thus the first `counters_per_block` positions are pairwise distinct.
+   *
+   * @param hash_value Counter hash value of a key
+   * @param i Index of the counter
+   *
+   * @return The counter position
+   */
+  [[nodiscard]] __device__ constexpr int32_t counter_index(std::uint64_t hash_value,
+                                                           int32_t i) const noexcept;
+
+  /**
+   * @brief Atomically adds `delta` to the counter located at bit offset `shift` of the given word
+   * unless the counter is saturated or the result would leave the range `[0, counter_max]`.
+   *
+   * @param address Pointer to the word holding the counter
+   * @param shift Bit offset of the counter within the word
+   * @param delta Either `1` or `-1`
+   */
+  __device__ void update_counter(word_type* address, int32_t shift, int32_t delta) noexcept;
+
+  /**
+   * @brief Compares the content of the address `address` (old value) with the `expected` value and,
+   * only if they are the same, sets the content of `address` to `desired`.
+   *
+   * @param address The target address
+   * @param expected The value expected to be found at the target address
+   * @param desired The value to store at the target address if it is as expected
+   *
+   * @return The old value located at address `address`
+   */
+  __device__ word_type compare_and_swap(word_type* address,
+                                        word_type expected,
+                                        word_type desired) noexcept;
+
+  int32_t num_hashes_;            ///< Number of counters each key is mapped to
+  hasher hash_;                   ///< Hash function
+  storage_ref_type storage_ref_;  ///< Counter block storage ref
+};
+
+}  // namespace experimental
+}  // namespace cuco
+
+#include <cuco/detail/counting_bloom_filter/counting_bloom_filter_ref.inl>
@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cuco/utility/traits.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace cuco {
+namespace detail {
+
+/**
+ * @brief Indicates whether keys of type `T` are canonicalized before hashing and comparison.
+ *
+ * @tparam T Key type
+ */
+template <typename T>
+inline constexpr bool is_canonicalized_v = std::is_same_v<T, float> or std::is_same_v<T, double>;
+
+/**
+ * @brief Indicates whether keys of type `T` are supported by the legacy containers, i.e.,
+ * `cuco::static_map`, `cuco::static_multimap` and `cuco::dynamic_map`.
+ *
+ * The legacy containers compare keys bitwise and do not canonicalize them, so floating-point keys
+ * are only supported by the experimental containers.
+ *
+ * @tparam T Key type
+ */
+template <typename T>
+inline constexpr bool is_legacy_key_v = cuco::is_bitwise_comparable_v<T> and
+                                        not is_canonicalized_v<T>;
+
+/**
+ * @brief Returns the given key unchanged.
+ *
+ * Keys that are not floating-point values have a single representation per value, so they are
+ * passed through by reference and canonicalization costs nothing.
+ *
+ * @tparam T Key type
+ *
+ * @param key Key to canonicalize
+ * @return `key` itself
+ */
+template <typename T>
+__host__ __device__ constexpr T const& canonicalize(T const& key) noexcept
+{
+  return key;
+}
+
+/**
+ * @brief Returns the canonical representation of the given `float` key.
+ *
+ * `-0.0f` is mapped to `+0.0f` and every NaN to the default quiet NaN, so that keys which compare
+ * equal, as well as all NaNs, have identical object representations. Other values are unchanged.
+ *
+ * @param key Key to canonicalize
+ * @return Canonical representation of `key`
+ */
+__host__ __device__ inline float canonicalize(float key) noexcept
+{
+  std::uint32_t bits;
+  memcpy(&bits, &key, sizeof(bits));
+  auto const magnitude = bits & 0x7fffffffu;
+  if (magnitude == 0u) {
+    bits = 0u;
+  } else if (magnitude > 0x7f800000u) {
+    bits = 0x7fc00000u;
+  }
+  memcpy(&key, &bits, sizeof(bits));
+  return key;
+}
+
+/**
+ * @brief Returns the canonical representation of the given `double` key.
+ *
+ * `-0.0` is mapped to `+0.0` and every NaN to the default quiet NaN, so that keys which compare
+ * equal, as well as all NaNs, have identical object representations. Other values are unchanged.
+ *
+ * @param key Key to canonicalize
+ * @return Canonical representation of `key`
+ */
+__host__ __device__ inline double canonicalize(double key) noexcept
+{
+  std::uint64_t bits;
+  memcpy(&bits, &key, sizeof(bits));
+  auto const magnitude = bits & 0x7fffffffffffffffull;
+  if (magnitude == 0ull) {
+    bits = 0ull;
+  } else if (magnitude > 0x7ff0000000000000ull) {
+    bits = 0x7ff8000000000000ull;
+  }
+  memcpy(&key, &bits, sizeof(bits));
+  return key;
+}
+
+}  // namespace detail
+}  // namespace cuco
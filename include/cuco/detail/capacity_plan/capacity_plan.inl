@@ -0,0 +1,201 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cuco/detail/error.hpp>
+#include <cuco/detail/prime.hpp>
+#include <cuco/detail/utils.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+namespace cuco {
+namespace experimental {
+namespace detail {
+
+/**
+ * @brief Computes the capacity a container must be constructed with to reach the target load.
+ *
+ * @param expected_keys Number of keys expected to be inserted
+ * @param target_load Desired load factor, in `(0, 1]`
+ *
+ * @return Requested capacity
+ */
+inline std::size_t requested_capacity(std::size_t expected_keys, double target_load)
+{
+  CUCO_EXPECTS(target_load > 0. and target_load <= 1., "Invalid target load factor");
+  return static_cast<std::size_t>(std::ceil(static_cast<double>(expected_keys) / target_load));
+}
+
+/**
+ * @brief Run-time counterpart of `make_window_extent<CGSize, WindowSize>(size)`.
+ *
+ * @param size Requested capacity
+ * @param cg_size Number of threads per probing step
+ * @param window_size Number of slots per window
+ *
+ * @return Resulting valid window extent
+ */
+inline std::size_t window_extent_size(std::size_t size, int32_t cg_size, int32_t window_size)
+{
+  auto const step_slots = static_cast<std::size_t>(cg_size * window_size);
+  auto const num_steps  = static_cast<uint64_t>(SDIV(std::max(size, std::size_t{1}), step_slots));
+  CUCO_EXPECTS(num_steps <= cuco::detail::max_prime, "Invalid input extent");
+
+  auto const prime = cuco::detail::prime_lower_bound(num_steps);
+  return static_cast<std::size_t>(prime * cg_size);
+}
+
+/**
+ * @brief Expected number of probing steps of an unsuccessful lookup.
+ *
+ * @param load Load factor
+ * @param step_slots Number of slots loaded per probing step
+ * @param model Probing model
+ *
+ * @return Expected number of probing steps
+ */
+inline double expected_probes_miss(double load, int32_t step_slots, probing_model model)
+{
+  if (model == probing_model::LINEAR) {
+    auto const slots = 0.5 * (1. + 1. / ((1. - load) * (1. - load)));
+    return 1. + (slots - 1.) / step_slots;
+  }
+  return 1. / (1. - std::pow(load, step_slots));
+}
+
+/**
+ * @brief Expected number of probing steps of a successful lookup.
+ *
+ * @param load Load factor
+ * @param step_slots Number of slots loaded per probing step
+ * @param model Probing model
+ *
+ * @return Expected number of probing steps
+ */
+inline double expected_probes_hit(double load, int32_t step_slots, probing_model model)
+{
+  if (load <= 0.) { return 1.; }
+  if (model == probing_model::LINEAR) {
+    auto const slots = 0.5 * (1. + 1. / (1. - load));
+    return 1. + (slots - 1.) / step_slots;
+  }
+
+  // Finding a key costs as many probing steps as the miss that inserted it, averaged over the
+  // load factors seen while filling the container (Simpson's rule)
+  constexpr int32_t num_intervals = 64;
+  auto const width                = load / num_intervals;
+
+  auto sum = expected_probes_miss(0., step_slots, model) +
+             expected_probes_miss(load, step_slots, model);
+  for (int32_t i = 1; i < num_intervals; ++i) {
+    sum += (i % 2 == 0 ? 2. : 4.) * expected_probes_miss(i * width, step_slots, model);
+  }
+  return sum * width / 3. / load;
+}
+
+}  // namespace detail
+
+template <typename Container>
+capacity_plan plan(std::size_t expected_keys, double target_load)
+{
+  auto const model = detail::is_linear_probing<typename Container::probing_scheme_type>::value
+                       ? probing_model::LINEAR
+                       : probing_model::UNIFORM;
+
+  auto const num_windows =
+    make_window_extent<Container>(detail::requested_capacity(expected_keys, target_load));
+  auto const capacity    = num_windows * Container::window_size;
+  auto const load_factor = static_cast<double>(expected_keys) / capacity;
+  auto const step_slots  = Container::cg_size * Container::window_size;
+
+  return capacity_plan{Container::cg_size,
+                       Container::window_size,
+                       model,
+                       num_windows,
+                       capacity,
+                       capacity * sizeof(typename Container::value_type),
+                       load_factor,
+                       detail::expected_probes_hit(load_factor, step_slots, model),
+                       detail::expected_probes_miss(load_factor, step_slots, model)};
+}
+
+inline capacity_plan plan(std::size_t expected_keys,
+                          double target_load,
+                          int32_t cg_size,
+                          int32_t window_size,
+                          std::size_t slot_bytes,
+                          probing_model model)
+{
+  CUCO_EXPECTS(cg_size > 0 and window_size > 0, "Invalid probing step size");
+  auto const num_windows = detail::window_extent_size(
+    detail::requested_capacity(expected_keys, target_load), cg_size, window_size);
+  auto const capacity    = num_windows * window_size;
+  auto const load_factor = static_cast<double>(expected_keys) / capacity;
+  auto const step_slots  = cg_size * window_size;
+
+  return capacity_plan{cg_size,
+                       window_size,
+                       model,
+                       num_windows,
+                       capacity,
+                       capacity * slot_bytes,
+                       load_factor,
+                       detail::expected_probes_hit(load_factor, step_slots, model),
+                       detail::expected_probes_miss(load_factor, step_slots, model)};
+}
+
+inline capacity_plan min_memory_plan(std::size_t expected_keys,
+                                     double max_expected_probes,
+                                     std::size_t slot_bytes,
+                                     probing_model model)
+{
+  CUCO_EXPECTS(max_expected_probes > 1., "Invalid probe budget");
+
+  capacity_plan best{};
+  auto is_first = true;
+  for (int32_t cg_size = 1; cg_size <= 8; cg_size *= 2) {
+    for (int32_t window_size = 1; window_size <= 8; window_size *= 2) {
+      // The expected cost of a miss grows with the load factor: bisect the highest one in budget
+      auto lo = 0.;
+      auto hi = 1.;
+      for (int32_t i = 0; i < 64; ++i) {
+        auto const mid = 0.5 * (lo + hi);
+        if (detail::expected_probes_miss(mid, cg_size * window_size, model) <=
+            max_expected_probes) {
+          lo = mid;
+        } else {
+          hi = mid;
+        }
+      }
+      if (lo <= 0.) { continue; }
+
+      auto const candidate = plan(expected_keys, lo, cg_size, window_size, slot_bytes, model);
+      if (is_first or candidate.bytes < best.bytes) {
+        best     = candidate;
+        is_first = false;
+      }
+    }
+  }
+  CUCO_EXPECTS(not is_first, "Invalid probe budget");
+  return best;
+}
+
+}  // namespace experimental
+}  // namespace cuco
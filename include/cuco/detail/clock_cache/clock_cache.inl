@@ -0,0 +1,343 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cuco/clock_cache_ref.cuh>
+#include <cuco/cuda_stream_ref.hpp>
+#include <cuco/detail/clock_cache/functors.cuh>
+#include <cuco/detail/clock_cache/kernels.cuh>
+#include <cuco/detail/storage/counter_storage.cuh>
+#include <cuco/detail/tuning.cuh>
+#include <cuco/detail/utils.hpp>
+#include <cuco/operator.hpp>
+
+#include <cstddef>
+
+namespace cuco {
+namespace experimental {
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+clock_cache<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::clock_cache(
+  Extent capacity,
+  empty_key<Key> empty_key_sentinel,
+  empty_value<T> empty_value_sentinel,
+  KeyEqual const& pred,
+  ProbingScheme const& probing_scheme,
+  Allocator const& alloc,
+  cuda_stream_ref stream)
+  : impl_{std::make_unique<impl_type>(
+      capacity,
+      empty_key_sentinel,
+      slot_type{empty_key_sentinel, payload_type{empty_value_sentinel, flag_type{0}}},
+      pred,
+      probing_scheme,
+      alloc,
+      stream)},
+    empty_value_sentinel_{empty_value_sentinel},
+    hands_{std::make_unique<hand_storage_type>(
+      cuco::experimental::extent<std::size_t>{
+        static_cast<std::size_t>(impl_->storage_ref().num_windows())},
+      alloc)}
+{
+  hands_->initialize(0, stream);
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+void clock_cache<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::clear(
+  cuda_stream_ref stream) noexcept
+{
+  hands_->initialize(0, stream);
+  impl_->clear(stream);
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+void clock_cache<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::clear_async(
+  cuda_stream_ref stream) noexcept
+{
+  hands_->initialize(0, stream);
+  impl_->clear_async(stream);
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+template <typename InputIt>
+clock_cache<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::size_type
+clock_cache<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::insert(
+  InputIt first, InputIt last, cuda_stream_ref stream)
+{
+  return impl_->insert(first, last, ref(op::insert), stream);
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+template <typename InputIt>
+void clock_cache<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::insert_async(
+  InputIt first, InputIt last, cuda_stream_ref stream) noexcept
+{
+  impl_->insert_async(first, last, ref(op::insert), stream);
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+template <typename InputIt, typename OutputIt>
+void clock_cache<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::contains(
+  InputIt first, InputIt last, OutputIt output_begin, cuda_stream_ref stream) const
+{
+  contains_async(first, last, output_begin, stream);
+  stream.synchronize();
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+template <typename InputIt, typename OutputIt>
+void clock_cache<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+  contains_async(InputIt first,
+                 InputIt last,
+                 OutputIt output_begin,
+                 cuda_stream_ref stream) const noexcept
+{
+  impl_->contains_async(first, last, output_begin, ref(op::contains), stream);
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+template <typename InputIt, typename OutputIt>
+void clock_cache<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::find(
+  InputIt first, InputIt last, OutputIt output_begin, cuda_stream_ref stream)
+{
+  find_async(first, last, output_begin, stream);
+  stream.synchronize();
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+template <typename InputIt, typename OutputIt>
+void clock_cache<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::find_async(
+  InputIt first, InputIt last, OutputIt output_begin, cuda_stream_ref stream) noexcept
+{
+  auto const num_keys = cuco::detail::distance(first, last);
+  if (num_keys == 0) { return; }
+
+  auto const grid_size =
+    (num_keys + detail::CUCO_DEFAULT_STRIDE * detail::CUCO_DEFAULT_BLOCK_SIZE - 1) /
+    (detail::CUCO_DEFAULT_STRIDE * detail::CUCO_DEFAULT_BLOCK_SIZE);
+
+  clock_cache_ns::detail::find<detail::CUCO_DEFAULT_BLOCK_SIZE>
+    <<<grid_size, detail::CUCO_DEFAULT_BLOCK_SIZE, 0, stream>>>(
+      first, num_keys, output_begin, ref(op::find));
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+template <typename InputIt, typename OutputIt, typename MissIt>
+clock_cache<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::size_type
+clock_cache<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::find_or_insert(
+  InputIt first, InputIt last, OutputIt output_begin, MissIt miss_begin, cuda_stream_ref stream)
+{
+  auto const num = cuco::detail::distance(first, last);
+  if (num == 0) { return 0; }
+
+  auto counter =
+    detail::counter_storage<size_type, thread_scope, allocator_type>{impl_->allocator()};
+  counter.reset(stream);
+
+  auto const grid_size =
+    (num + detail::CUCO_DEFAULT_STRIDE * detail::CUCO_DEFAULT_BLOCK_SIZE - 1) /
+    (detail::CUCO_DEFAULT_STRIDE * detail::CUCO_DEFAULT_BLOCK_SIZE);
+
+  clock_cache_ns::detail::find_or_insert<detail::CUCO_DEFAULT_BLOCK_SIZE>
+    <<<grid_size, detail::CUCO_DEFAULT_BLOCK_SIZE, 0, stream>>>(
+      first, num, output_begin, miss_begin, counter.data(), ref(op::insert_and_find));
+
+  return counter.load_to_host(stream);
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+template <typename InputIt, typename OutputIt, typename MissIt>
+void clock_cache<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+  find_or_insert_async(InputIt first,
+                       InputIt last,
+                       OutputIt output_begin,
+                       MissIt miss_begin,
+                       cuda_stream_ref stream) noexcept
+{
+  auto const num = cuco::detail::distance(first, last);
+  if (num == 0) { return; }
+
+  auto const grid_size =
+    (num + detail::CUCO_DEFAULT_STRIDE * detail::CUCO_DEFAULT_BLOCK_SIZE - 1) /
+    (detail::CUCO_DEFAULT_STRIDE * detail::CUCO_DEFAULT_BLOCK_SIZE);
+
+  clock_cache_ns::detail::find_or_insert<detail::CUCO_DEFAULT_BLOCK_SIZE>
+    <<<grid_size, detail::CUCO_DEFAULT_BLOCK_SIZE, 0, stream>>>(
+      first, num, output_begin, miss_begin, ref(op::insert_and_find));
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+clock_cache<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::size_type
+clock_cache<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::size(
+  cuda_stream_ref stream) const noexcept
+{
+  auto const is_filled = clock_cache_ns::detail::slot_is_filled<Key>(this->empty_key_sentinel());
+  return impl_->size(is_filled, stream);
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+constexpr auto
+clock_cache<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::capacity()
+  const noexcept
+{
+  return impl_->capacity();
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+constexpr clock_cache<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::key_type
+clock_cache<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+  empty_key_sentinel() const noexcept
+{
+  return impl_->empty_key_sentinel();
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+constexpr clock_cache<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+  mapped_type
+  clock_cache<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+    empty_value_sentinel() const noexcept
+{
+  return this->empty_value_sentinel_;
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+template <typename... Operators>
+auto clock_cache<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::ref(
+  Operators...) const noexcept
+{
+  static_assert(sizeof...(Operators), "No operators specified");
+  return ref_type<Operators...>{cuco::empty_key<key_type>(this->empty_key_sentinel()),
+                                cuco::empty_value<mapped_type>(this->empty_value_sentinel()),
+                                impl_->key_eq(),
+                                impl_->probing_scheme(),
+                                impl_->storage_ref(),
+                                reinterpret_cast<std::uint32_t*>(hands_->data())};
+}
+}  // namespace experimental
+}  // namespace cuco
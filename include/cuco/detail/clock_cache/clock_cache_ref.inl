@@ -0,0 +1,615 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cuco/detail/bitwise_compare.cuh>
+#include <cuco/detail/equal_wrapper.cuh>
+#include <cuco/operator.hpp>
+#include <cuco/utility/traits.hpp>
+
+#include <cuda/atomic>
+
+#include <cstdint>
+
+namespace cuco {
+namespace experimental {
+
+template <typename Key,
+          typename T,
+          cuda::thread_scope Scope,
+          typename KeyEqual,
+          typename ProbingScheme,
+          typename StorageRef,
+          typename... Operators>
+__host__ __device__ constexpr clock_cache_ref<
+  Key,
+  T,
+  Scope,
+  KeyEqual,
+  ProbingScheme,
+  StorageRef,
+  Operators...>::clock_cache_ref(cuco::empty_key<Key> empty_key_sentinel,
+                                 cuco::empty_value<T> empty_value_sentinel,
+                                 KeyEqual const& predicate,
+                                 ProbingScheme const& probing_scheme,
+                                 StorageRef storage_ref,
+                                 std::uint32_t* hands) noexcept
+  : predicate_{empty_key_sentinel, predicate},
+    empty_value_sentinel_{empty_value_sentinel},
+    probing_scheme_{probing_scheme},
+    storage_ref_{storage_ref},
+    hands_{hands}
+{
+}
+
+template <typename Key,
+          typename T,
+          cuda::thread_scope Scope,
+          typename KeyEqual,
+          typename ProbingScheme,
+          typename StorageRef,
+          typename... Operators>
+__host__ __device__ constexpr auto
+clock_cache_ref<Key, T, Scope, KeyEqual, ProbingScheme, StorageRef, Operators...>::capacity()
+  const noexcept
+{
+  return storage_ref_.capacity();
+}
+
+template <typename Key,
+          typename T,
+          cuda::thread_scope Scope,
+          typename KeyEqual,
+          typename ProbingScheme,
+          typename StorageRef,
+          typename... Operators>
+__host__ __device__ constexpr Key
+clock_cache_ref<Key, T, Scope, KeyEqual, ProbingScheme, StorageRef, Operators...>::
+  empty_key_sentinel() const noexcept
+{
+  return predicate_.empty_sentinel_;
+}
+
+template <typename Key,
+          typename T,
+          cuda::thread_scope Scope,
+          typename KeyEqual,
+          typename ProbingScheme,
+          typename StorageRef,
+          typename... Operators>
+__host__ __device__ constexpr T
+clock_cache_ref<Key, T, Scope, KeyEqual, ProbingScheme, StorageRef, Operators...>::
+  empty_value_sentinel() const noexcept
+{
+  return empty_value_sentinel_;
+}
+
+template <typename Key,
+          typename T,
+          cuda::thread_scope Scope,
+          typename KeyEqual,
+          typename ProbingScheme,
+          typename StorageRef,
+          typename... Operators>
+__device__ constexpr bool
+clock_cache_ref<Key, T, Scope, KeyEqual, ProbingScheme, StorageRef, Operators...>::is_pending(
+  slot_type const& slot) const noexcept
+{
+  return cuco::detail::bitwise_compare(slot.second.first, empty_value_sentinel_);
+}
+
+template <typename Key,
+          typename T,
+          cuda::thread_scope Scope,
+          typename KeyEqual,
+          typename ProbingScheme,
+          typename StorageRef,
+          typename... Operators>
+template <typename ProbeKey>
+__device__ typename clock_cache_ref<Key,
+                                    T,
+                                    Scope,
+                                    KeyEqual,
+                                    ProbingScheme,
+                                    StorageRef,
+                                    Operators...>::slot_type*
+clock_cache_ref<Key, T, Scope, KeyEqual, ProbingScheme, StorageRef, Operators...>::find_slot(
+  ProbeKey const& key) const noexcept
+{
+  auto const window_idx   = *probing_scheme_(key, storage_ref_.window_extent());
+  auto const window_slots = storage_ref_[window_idx];
+
+  // Evictions leave no holes behind, but the whole window is scanned since a key can be stored in
+  // any of its slots
+  for (auto i = 0; i < window_size; ++i) {
+    if (predicate_(window_slots[i].first, key) == detail::equal_result::EQUAL and
+        not is_pending(window_slots[i])) {
+      return (storage_ref_.data() + window_idx)->data() + i;
+    }
+  }
+  return nullptr;
+}
+
+template <typename Key,
+          typename T,
+          cuda::thread_scope Scope,
+          typename KeyEqual,
+          typename ProbingScheme,
+          typename StorageRef,
+          typename... Operators>
+__device__ thrust::pair<typename clock_cache_ref<Key,
+                                                 T,
+                                                 Scope,
+                                                 KeyEqual,
+                                                 ProbingScheme,
+                                                 StorageRef,
+                                                 Operators...>::slot_type*,
+                        bool>
+clock_cache_ref<Key, T, Scope, KeyEqual, ProbingScheme, StorageRef, Operators...>::insert_slot(
+  value_type const& value) noexcept
+{
+  auto const& key        = value.first;
+  auto const payload     = payload_type{value.second, flag_type{1}};
+  auto const empty_key   = this->empty_key_sentinel();
+  auto const window_idx  = *probing_scheme_(key, storage_ref_.window_extent());
+  auto* const window_ptr = (storage_ref_.data() + window_idx)->data();
+
+  while (true) {
+    auto const window_slots = storage_ref_[window_idx];
+
+    int32_t match_idx{-1};
+    int32_t empty_idx{-1};
+    for (auto i = 0; i < window_size; ++i) {
+      auto const eq_res = predicate_(window_slots[i].first, key);
+      if (eq_res == detail::equal_result::EQUAL) {
+        match_idx = i;
+        break;
+      }
+      if (eq_res == detail::equal_result::EMPTY and empty_idx == -1) { empty_idx = i; }
+    }
+
+    // The key is already cached: wait until its payload is readable, then reference it
+    if (match_idx != -1) {
+      if (is_pending(window_slots[match_idx])) { continue; }
+      mark_referenced(window_ptr + match_idx);
+      return {window_ptr + match_idx, false};
+    }
+
+    auto claimed_idx = empty_idx;
+    if (claimed_idx != -1) {
+      // Empty slots always hold a pending payload, so the claimed slot cannot be found until its
+      // payload is published
+      auto const old = compare_and_swap(&window_ptr[claimed_idx].first, empty_key, key);
+      if (not cuco::detail::bitwise_compare(*reinterpret_cast<key_type const*>(&old),
+                                            empty_key)) {
+        continue;
+      }
+    } else {
+      // The window is full: starting from the clock hand, give every referenced slot a second
+      // chance and evict the first unreferenced one
+      for (auto step = 0; step < window_size and claimed_idx == -1; ++step) {
+        auto const i     = advance_hand(window_idx);
+        auto const& slot = window_slots[i];
+        if (is_pending(slot)) { continue; }
+
+        auto const desired = slot.second.second == flag_type{0}
+                               ? payload_type{empty_value_sentinel_, flag_type{0}}
+                               : payload_type{slot.second.first, flag_type{0}};
+        auto const old = compare_and_swap(&window_ptr[i].second, slot.second, desired);
+
+        // Locking the payload of the victim makes it invisible before its key is replaced
+        if (slot.second.second == flag_type{0} and
+            old == *reinterpret_cast<decltype(old) const*>(&slot.second)) {
+          atomic_store(&window_ptr[i].first, key);
+          claimed_idx = i;
+        }
+      }
+      // Every slot was either referenced or pending: sweep the window again
+      if (claimed_idx == -1) { continue; }
+    }
+
+    if (is_first_claim(window_ptr, claimed_idx, key)) {
+      atomic_store(&window_ptr[claimed_idx].second, payload);
+      return {window_ptr + claimed_idx, true};
+    }
+
+    // The same key is being inserted into another slot of this window: release the claimed slot
+    // and reference the other one
+    atomic_store(&window_ptr[claimed_idx].first, empty_key);
+  }
+}
+
+template <typename Key,
+          typename T,
+          cuda::thread_scope Scope,
+          typename KeyEqual,
+          typename ProbingScheme,
+          typename StorageRef,
+          typename... Operators>
+__device__ bool
+clock_cache_ref<Key, T, Scope, KeyEqual, ProbingScheme, StorageRef, Operators...>::is_first_claim(
+  slot_type const* window_ptr, int32_t intra_window_index, key_type const& key) const noexcept
+{
+  // Makes the claim visible before looking for competing claims, so that out of two threads
+  // claiming different slots for the same key, at least one sees the other
+  cuda::atomic_thread_fence(cuda::memory_order_seq_cst, Scope);
+
+  for (auto i = 0; i < window_size; ++i) {
+    if (i == intra_window_index) { continue; }
+    while (predicate_(atomic_load(&window_ptr[i].first), key) == detail::equal_result::EQUAL) {
+      if (i < intra_window_index) { return false; }
+      // A competing claim with a higher index either gets published, in which case it wins, or
+      // gets released after seeing this claim
+      auto const payload = atomic_load(&window_ptr[i].second);
+      if (not cuco::detail::bitwise_compare(payload.first, empty_value_sentinel_)) { return false; }
+    }
+  }
+  return true;
+}
+
+template <typename Key,
+          typename T,
+          cuda::thread_scope Scope,
+          typename KeyEqual,
+          typename ProbingScheme,
+          typename StorageRef,
+          typename... Operators>
+__device__ void
+clock_cache_ref<Key, T, Scope, KeyEqual, ProbingScheme, StorageRef, Operators...>::mark_referenced(
+  slot_type* slot) noexcept
+{
+  auto const expected = slot->second;
+  // Skips the atomic if the flag is already set or if the slot is being evicted
+  if (expected.second != flag_type{0} or
+      cuco::detail::bitwise_compare(expected.first, empty_value_sentinel_)) {
+    return;
+  }
+  compare_and_swap(&slot->second, expected, payload_type{expected.first, flag_type{1}});
+}
+
+template <typename Key,
+          typename T,
+          cuda::thread_scope Scope,
+          typename KeyEqual,
+          typename ProbingScheme,
+          typename StorageRef,
+          typename... Operators>
+__device__ int32_t
+clock_cache_ref<Key, T, Scope, KeyEqual, ProbingScheme, StorageRef, Operators...>::advance_hand(
+  size_type window_idx) noexcept
+{
+  auto* const hand = hands_ + window_idx;
+  std::uint32_t old{};
+  if constexpr (Scope == cuda::thread_scope_system) {
+    old = atomicAdd_system(hand, 1u);
+  } else if constexpr (Scope == cuda::thread_scope_device) {
+    old = atomicAdd(hand, 1u);
+  } else if constexpr (Scope == cuda::thread_scope_block) {
+    old = atomicAdd_block(hand, 1u);
+  } else {
+    static_assert(cuco::dependent_false<decltype(Scope)>, "Unsupported thread scope");
+  }
+  return static_cast<int32_t>(old % window_size);
+}
+
+template <typename Key,
+          typename T,
+          cuda::thread_scope Scope,
+          typename KeyEqual,
+          typename ProbingScheme,
+          typename StorageRef,
+          typename... Operators>
+template <typename U>
+__device__ constexpr auto
+clock_cache_ref<Key, T, Scope, KeyEqual, ProbingScheme, StorageRef, Operators...>::
+  compare_and_swap(U* address, U expected, U desired)
+{
+  if constexpr (sizeof(U) == sizeof(unsigned int)) {
+    auto* const slot_ptr           = reinterpret_cast<unsigned int*>(address);
+    auto const* const expected_ptr = reinterpret_cast<unsigned int*>(&expected);
+    auto const* const desired_ptr  = reinterpret_cast<unsigned int*>(&desired);
+    if constexpr (Scope == cuda::thread_scope_system) {
+      return atomicCAS_system(slot_ptr, *expected_ptr, *desired_ptr);
+    } else if constexpr (Scope == cuda::thread_scope_device) {
+      return atomicCAS(slot_ptr, *expected_ptr, *desired_ptr);
+    } else if constexpr (Scope == cuda::thread_scope_block) {
+      return atomicCAS_block(slot_ptr, *expected_ptr, *desired_ptr);
+    } else {
+      static_assert(cuco::dependent_false<decltype(Scope)>, "Unsupported thread scope");
+    }
+  } else if constexpr (sizeof(U) == sizeof(unsigned long long int)) {
+    auto* const slot_ptr           = reinterpret_cast<unsigned long long int*>(address);
+    auto const* const expected_ptr = reinterpret_cast<unsigned long long int*>(&expected);
+    auto const* const desired_ptr  = reinterpret_cast<unsigned long long int*>(&desired);
+    if constexpr (Scope == cuda::thread_scope_system) {
+      return atomicCAS_system(slot_ptr, *expected_ptr, *desired_ptr);
+    } else if constexpr (Scope == cuda::thread_scope_device) {
+      return atomicCAS(slot_ptr, *expected_ptr, *desired_ptr);
+    } else if constexpr (Scope == cuda::thread_scope_block) {
+      return atomicCAS_block(slot_ptr, *expected_ptr, *desired_ptr);
+    } else {
+      static_assert(cuco::dependent_false<decltype(Scope)>, "Unsupported thread scope");
+    }
+  }
+}
+
+template <typename Key,
+          typename T,
+          cuda::thread_scope Scope,
+          typename KeyEqual,
+          typename ProbingScheme,
+          typename StorageRef,
+          typename... Operators>
+template <typename U>
+__device__ constexpr U
+clock_cache_ref<Key, T, Scope, KeyEqual, ProbingScheme, StorageRef, Operators...>::atomic_load(
+  U const* address) const noexcept
+{
+  if constexpr (sizeof(U) == sizeof(unsigned int)) {
+    auto const value = *reinterpret_cast<unsigned int const volatile*>(address);
+    return *reinterpret_cast<U const*>(&value);
+  } else if constexpr (sizeof(U) == sizeof(unsigned long long int)) {
+    auto const value = *reinterpret_cast<unsigned long long int const volatile*>(address);
+    return *reinterpret_cast<U const*>(&value);
+  }
+}
+
+template <typename Key,
+          typename T,
+          cuda::thread_scope Scope,
+          typename KeyEqual,
+          typename ProbingScheme,
+          typename StorageRef,
+          typename... Operators>
+template <typename U>
+__device__ constexpr void
+clock_cache_ref<Key, T, Scope, KeyEqual, ProbingScheme, StorageRef, Operators...>::atomic_store(
+  U* address, U value)
+{
+  if constexpr (sizeof(U) == sizeof(unsigned int)) {
+    auto* const slot_ptr        = reinterpret_cast<unsigned int*>(address);
+    auto const* const value_ptr = reinterpret_cast<unsigned int*>(&value);
+    if constexpr (Scope == cuda::thread_scope_system) {
+      atomicExch_system(slot_ptr, *value_ptr);
+    } else if constexpr (Scope == cuda::thread_scope_device) {
+      atomicExch(slot_ptr, *value_ptr);
+    } else if constexpr (Scope == cuda::thread_scope_block) {
+      atomicExch_block(slot_ptr, *value_ptr);
+    } else {
+      static_assert(cuco::dependent_false<decltype(Scope)>, "Unsupported thread scope");
+    }
+  } else if constexpr (sizeof(U) == sizeof(unsigned long long int)) {
+    auto* const slot_ptr        = reinterpret_cast<unsigned long long int*>(address);
+    auto const* const value_ptr = reinterpret_cast<unsigned long long int*>(&value);
+    if constexpr (Scope == cuda::thread_scope_system) {
+      atomicExch_system(slot_ptr, *value_ptr);
+    } else if constexpr (Scope == cuda::thread_scope_device) {
+      atomicExch(slot_ptr, *value_ptr);
+    } else if constexpr (Scope == cuda::thread_scope_block) {
+      atomicExch_block(slot_ptr, *value_ptr);
+    } else {
+      static_assert(cuco::dependent_false<decltype(Scope)>, "Unsupported thread scope");
+    }
+  }
+}
+
+namespace detail {
+
+template <typename Key,
+          typename T,
+          cuda::thread_scope Scope,
+          typename KeyEqual,
+          typename ProbingScheme,
+          typename StorageRef,
+          typename... Operators>
+class operator_impl<
+  op::insert_tag,
+  clock_cache_ref<Key, T, Scope, KeyEqual, ProbingScheme, StorageRef, Operators...>> {
+  using base_type = clock_cache_ref<Key, T, Scope, KeyEqual, ProbingScheme, StorageRef>;
+  using ref_type =
+    clock_cache_ref<Key, T, Scope, KeyEqual, ProbingScheme, StorageRef, Operators...>;
+  using value_type = typename base_type::value_type;
+
+ public:
+  /**
+   * @brief Inserts an element.
+   *
+   * @note If the home window of the key is full, evicts the first unreferenced element from the
+   * clock hand of the window on. If the key is already present, marks it as referenced.
+   *
+   * @param value The element to insert
+   * @return True if the given element is successfully inserted
+   */
+  __device__ bool insert(value_type const& value) noexcept
+  {
+    ref_type& ref_ = static_cast<ref_type&>(*this);
+    return ref_.insert_slot(value).second;
+  }
+};
+
+template <typename Key,
+          typename T,
+          cuda::thread_scope Scope,
+          typename KeyEqual,
+          typename ProbingScheme,
+          typename StorageRef,
+          typename... Operators>
+class operator_impl<
+  op::insert_and_find_tag,
+  clock_cache_ref<Key, T, Scope, KeyEqual, ProbingScheme, StorageRef, Operators...>> {
+  using base_type = clock_cache_ref<Key, T, Scope, KeyEqual, ProbingScheme, StorageRef>;
+  using ref_type =
+    clock_cache_ref<Key, T, Scope, KeyEqual, ProbingScheme, StorageRef, Operators...>;
+  using value_type     = typename base_type::value_type;
+  using iterator       = typename base_type::iterator;
+  using const_iterator = typename base_type::const_iterator;
+
+ public:
+  /**
+   * @brief Returns a const_iterator to one past the last slot.
+   *
+   * @note This API is available only when `find_tag` or `insert_and_find_tag` is present.
+   *
+   * @return A const_iterator to one past the last slot
+   */
+  [[nodiscard]] __host__ __device__ constexpr const_iterator end() const noexcept
+  {
+    auto const& ref_ = static_cast<ref_type const&>(*this);
+    return ref_.storage_ref_.end();
+  }
+
+  /**
+   * @brief Returns an iterator to one past the last slot.
+   *
+   * @note This API is available only when `find_tag` or `insert_and_find_tag` is present.
+   *
+   * @return An iterator to one past the last slot
+   */
+  [[nodiscard]] __host__ __device__ constexpr iterator end() noexcept
+  {
+    auto const& ref_ = static_cast<ref_type const&>(*this);
+    return ref_.storage_ref_.end();
+  }
+
+  /**
+   * @brief Inserts the given element into the cache, evicting an unreferenced element of its home
+   * window if needed.
+   *
+   * @note This API returns a pair consisting of an iterator to the inserted element (or to the
+   * element that prevented the insertion) and a `bool` denoting whether the insertion took place or
+   * not, i.e., whether the key missed the cache. The mapped value is stored in `it->second.first`.
+   * @note The element pointed to by the iterator is marked as referenced.
+   *
+   * @param value The element to insert
+   *
+   * @return a pair consisting of an iterator to the element and a bool indicating whether the
+   * insertion is successful or not.
+   */
+  __device__ thrust::pair<iterator, bool> insert_and_find(value_type const& value) noexcept
+  {
+    ref_type& ref_    = static_cast<ref_type&>(*this);
+    auto const result = ref_.insert_slot(value);
+    return {iterator{result.first}, result.second};
+  }
+};
+
+template <typename Key,
+          typename T,
+          cuda::thread_scope Scope,
+          typename KeyEqual,
+          typename ProbingScheme,
+          typename StorageRef,
+          typename... Operators>
+class operator_impl<
+  op::contains_tag,
+  clock_cache_ref<Key, T, Scope, KeyEqual, ProbingScheme, StorageRef, Operators...>> {
+  using base_type = clock_cache_ref<Key, T, Scope, KeyEqual, ProbingScheme, StorageRef>;
+  using ref_type =
+    clock_cache_ref<Key, T, Scope, KeyEqual, ProbingScheme, StorageRef, Operators...>;
+
+ public:
+  /**
+   * @brief Indicates whether the probe key `key` is cached.
+   *
+   * @note Unlike `find`, this function does not mark the key as referenced.
+   *
+   * @tparam ProbeKey Probe key type
+   *
+   * @param key The key to search for
+   *
+   * @return A boolean indicating whether the probe key is present
+   */
+  template <typename ProbeKey>
+  [[nodiscard]] __device__ bool contains(ProbeKey const& key) const noexcept
+  {
+    // CRTP: cast `this` to the actual ref type
+    auto const& ref_ = static_cast<ref_type const&>(*this);
+    return ref_.find_slot(key) != nullptr;
+  }
+};
+
+template <typename Key,
+          typename T,
+          cuda::thread_scope Scope,
+          typename KeyEqual,
+          typename ProbingScheme,
+          typename StorageRef,
+          typename... Operators>
+class operator_impl<
+  op::find_tag,
+  clock_cache_ref<Key, T, Scope, KeyEqual, ProbingScheme, StorageRef, Operators...>> {
+  using base_type = clock_cache_ref<Key, T, Scope, KeyEqual, ProbingScheme, StorageRef>;
+  using ref_type =
+    clock_cache_ref<Key, T, Scope, KeyEqual, ProbingScheme, StorageRef, Operators...>;
+  using iterator       = typename base_type::iterator;
+  using const_iterator = typename base_type::const_iterator;
+
+ public:
+  /**
+   * @brief Returns a const_iterator to one past the last slot.
+   *
+   * @note This API is available only when `find_tag` or `insert_and_find_tag` is present.
+   *
+   * @return A const_iterator to one past the last slot
+   */
+  [[nodiscard]] __host__ __device__ constexpr const_iterator end() const noexcept
+  {
+    auto const& ref_ = static_cast<ref_type const&>(*this);
+    return ref_.storage_ref_.end();
+  }
+
+  /**
+   * @brief Returns an iterator to one past the last slot.
+   *
+   * @note This API is available only when `find_tag` or `insert_and_find_tag` is present.
+   *
+   * @return An iterator to one past the last slot
+   */
+  [[nodiscard]] __host__ __device__ constexpr iterator end() noexcept
+  {
+    auto const& ref_ = static_cast<ref_type const&>(*this);
+    return ref_.storage_ref_.end();
+  }
+
+  /**
+   * @brief Finds an element in the cache with key equivalent to the probe key and marks it as
+   * referenced.
+   *
+   * @note Returns a un-incrementable input iterator to the slot whose key is equivalent to `key`.
+   * The mapped value is stored in `it->second.first`. If no such element exists, returns `end()`.
+   *
+   * @tparam ProbeKey Probe key type
+   *
+   * @param key The key to search for
+   *
+   * @return An iterator to the position at which the equivalent key is stored
+   */
+  template <typename ProbeKey>
+  [[nodiscard]] __device__ iterator find(ProbeKey const& key) noexcept
+  {
+    // CRTP: cast `this` to the actual ref type
+    auto& ref_       = static_cast<ref_type&>(*this);
+    auto* const slot = ref_.find_slot(key);
+    if (slot == nullptr) { return ref_.storage_ref_.end(); }
+    ref_.mark_referenced(slot);
+    return iterator{slot};
+  }
+};
+
+}  // namespace detail
+}  // namespace experimental
+}  // namespace cuco
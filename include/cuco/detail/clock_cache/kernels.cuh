@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cuco/detail/utils.hpp>
+
+#include <cub/block/block_reduce.cuh>
+
+#include <cuda/atomic>
+
+#include <cooperative_groups.h>
+
+namespace cuco {
+namespace experimental {
+namespace clock_cache_ns {
+namespace detail {
+
+/**
+ * @brief Finds the cached elements equivalent to all keys in the range `[first, last)` and marks
+ * them as referenced.
+ *
+ * @note If the key `*(first + i)` has a match in the container, copies the payload of its matched
+ * element to `(output_begin + i)`. Else, copies the empty value sentinel.
+ *
+ * @tparam BlockSize The size of the thread block
+ * @tparam InputIt Device accessible input iterator
+ * @tparam OutputIt Device accessible output iterator assignable from the cache's `mapped_type`
+ * @tparam Ref Type of non-owning device ref allowing access to storage
+ *
+ * @param first Beginning of the sequence of keys
+ * @param n Number of keys to query
+ * @param output_begin Beginning of the sequence of matched payloads retrieved for each key
+ * @param ref Non-owning cache device ref used to access the slot storage
+ */
+template <int32_t BlockSize, typename InputIt, typename OutputIt, typename Ref>
+__global__ void find(InputIt first, cuco::detail::index_type n, OutputIt output_begin, Ref ref)
+{
+  namespace cg = cooperative_groups;
+
+  auto const block      = cg::this_thread_block();
+  auto const thread_idx = block.thread_rank();
+
+  cuco::detail::index_type const loop_stride = gridDim.x * BlockSize;
+  cuco::detail::index_type idx               = BlockSize * blockIdx.x + threadIdx.x;
+  __shared__ typename Ref::mapped_type output_buffer[BlockSize];
+
+  while (idx - thread_idx < n) {  // the whole thread block falls into the same iteration
+    if (idx < n) {
+      auto const key   = *(first + idx);
+      auto const found = ref.find(key);
+      // Stage results in shared memory for the same reason as `static_map::find`
+      output_buffer[thread_idx] =
+        found == ref.end() ? ref.empty_value_sentinel() : (*found).second.first;
+      block.sync();
+      *(output_begin + idx) = output_buffer[thread_idx];
+    }
+    idx += loop_stride;
+  }
+}
+
+/**
+ * @brief Looks up all elements in the range `[first, first + n)`, inserting the ones whose key is
+ * not cached, and counts the number of misses.
+ *
+ * @note Copies the cached payload of the key `(*(first + i)).first` to `(output_begin + i)` and
+ * writes `false` to `(miss_begin + i)` on a hit. On a miss, inserts `*(first + i)`, copies its
+ * payload to `(output_begin + i)` and writes `true` to `(miss_begin + i)`.
+ *
+ * @tparam BlockSize Number of threads in each block
+ * @tparam InputIt Device accessible input iterator whose `value_type` is convertible to the cache's
+ * `value_type`
+ * @tparam OutputIt Device accessible output iterator assignable from the cache's `mapped_type`
+ * @tparam MissIt Device accessible output iterator assignable from `bool`
+ * @tparam AtomicT Atomic counter type
+ * @tparam Ref Type of non-owning device ref allowing access to storage
+ *
+ * @param first Beginning of the sequence of elements
+ * @param n Number of elements to look up
+ * @param output_begin Beginning of the sequence of payloads retrieved for each element
+ * @param miss_begin Beginning of the sequence of miss indicators
+ * @param num_misses Number of elements that missed the cache
+ * @param ref Non-owning cache device ref used to access the slot storage
+ */
+template <int32_t BlockSize,
+          typename InputIt,
+          typename OutputIt,
+          typename MissIt,
+          typename AtomicT,
+          typename Ref>
+__global__ void find_or_insert(InputIt first,
+                               cuco::detail::index_type n,
+                               OutputIt output_begin,
+                               MissIt miss_begin,
+                               AtomicT* num_misses,
+                               Ref ref)
+{
+  using BlockReduce = cub::BlockReduce<typename Ref::size_type, BlockSize>;
+  __shared__ typename BlockReduce::TempStorage temp_storage;
+  typename Ref::size_type thread_num_misses = 0;
+
+  cuco::detail::index_type const loop_stride = gridDim.x * BlockSize;
+  cuco::detail::index_type idx               = BlockSize * blockIdx.x + threadIdx.x;
+
+  while (idx < n) {
+    typename Ref::value_type const pair{*(first + idx)};
+    auto const result   = ref.insert_and_find(pair);
+    auto const inserted = result.second;
+
+    *(output_begin + idx) = inserted ? pair.second : (*result.first).second.first;
+    *(miss_begin + idx)   = inserted;
+    if (inserted) { thread_num_misses++; }
+
+    idx += loop_stride;
+  }
+
+  // compute number of misses for each block and atomically add to the grand total
+  auto const block_num_misses = BlockReduce(temp_storage).Sum(thread_num_misses);
+  if (threadIdx.x == 0) {
+    num_misses->fetch_add(block_num_misses, cuda::std::memory_order_relaxed);
+  }
+}
+
+/**
+ * @brief Looks up all elements in the range `[first, first + n)`, inserting the ones whose key is
+ * not cached.
+ *
+ * @note Copies the cached payload of the key `(*(first + i)).first` to `(output_begin + i)` and
+ * writes `false` to `(miss_begin + i)` on a hit. On a miss, inserts `*(first + i)`, copies its
+ * payload to `(output_begin + i)` and writes `true` to `(miss_begin + i)`.
+ *
+ * @tparam BlockSize Number of threads in each block
+ * @tparam InputIt Device accessible input iterator whose `value_type` is convertible to the cache's
+ * `value_type`
+ * @tparam OutputIt Device accessible output iterator assignable from the cache's `mapped_type`
+ * @tparam MissIt Device accessible output iterator assignable from `bool`
+ * @tparam Ref Type of non-owning device ref allowing access to storage
+ *
+ * @param first Beginning of the sequence of elements
+ * @param n Number of elements to look up
+ * @param output_begin Beginning of the sequence of payloads retrieved for each element
+ * @param miss_begin Beginning of the sequence of miss indicators
+ * @param ref Non-owning cache device ref used to access the slot storage
+ */
+template <int32_t BlockSize, typename InputIt, typename OutputIt, typename MissIt, typename Ref>
+__global__ void find_or_insert(
+  InputIt first, cuco::detail::index_type n, OutputIt output_begin, MissIt miss_begin, Ref ref)
+{
+  cuco::detail::index_type const loop_stride = gridDim.x * BlockSize;
+  cuco::detail::index_type idx               = BlockSize * blockIdx.x + threadIdx.x;
+
+  while (idx < n) {
+    typename Ref::value_type const pair{*(first + idx)};
+    auto const result   = ref.insert_and_find(pair);
+    auto const inserted = result.second;
+
+    *(output_begin + idx) = inserted ? pair.second : (*result.first).second.first;
+    *(miss_begin + idx)   = inserted;
+
+    idx += loop_stride;
+  }
+}
+
+}  // namespace detail
+}  // namespace clock_cache_ns
+}  // namespace experimental
+}  // namespace cuco
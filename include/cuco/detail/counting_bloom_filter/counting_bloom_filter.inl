@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cuco/counting_bloom_filter_ref.cuh>
+#include <cuco/cuda_stream_ref.hpp>
+#include <cuco/detail/counting_bloom_filter/kernels.cuh>
+#include <cuco/detail/error.hpp>
+#include <cuco/detail/tuning.cuh>
+#include <cuco/detail/utils.hpp>
+
+#include <cstddef>
+
+namespace cuco {
+namespace experimental {
+
+template <class Key, class Extent, cuda::thread_scope Scope, class Hash, class Allocator>
+constexpr counting_bloom_filter<Key, Extent, Scope, Hash, Allocator>::counting_bloom_filter(
+  Extent num_blocks,
+  int32_t num_hashes,
+  Hash const& hash,
+  Allocator const& alloc,
+  cuda_stream_ref stream)
+  : num_hashes_{num_hashes},
+    hash_{hash},
+    storage_{std::make_unique<storage_type>(num_blocks, alloc)}
+{
+  CUCO_EXPECTS(num_hashes_ > 0 and num_hashes_ <= ref_type::counters_per_block,
+               "The number of hashes must be in the range [1, 128]");
+
+  this->clear_async(stream);
+}
+
+template <class Key, class Extent, cuda::thread_scope Scope, class Hash, class Allocator>
+void counting_bloom_filter<Key, Extent, Scope, Hash, Allocator>::clear(
+  cuda_stream_ref stream) noexcept
+{
+  this->clear_async(stream);
+  stream.synchronize();
+}
+
+template <class Key, class Extent, cuda::thread_scope Scope, class Hash, class Allocator>
+void counting_bloom_filter<Key, Extent, Scope, Hash, Allocator>::clear_async(
+  cuda_stream_ref stream) noexcept
+{
+  storage_->initialize(word_type{0}, stream);
+}
+
+template <class Key, class Extent, cuda::thread_scope Scope, class Hash, class Allocator>
+template <typename InputIt>
+void counting_bloom_filter<Key, Extent, Scope, Hash, Allocator>::add(InputIt first,
+                                                                     InputIt last,
+                                                                     cuda_stream_ref stream)
+{
+  this->add_async(first, last, stream);
+  stream.synchronize();
+}
+
+template <class Key, class Extent, cuda::thread_scope Scope, class Hash, class Allocator>
+template <typename InputIt>
+void counting_bloom_filter<Key, Extent, Scope, Hash, Allocator>::add_async(
+  InputIt first, InputIt last, cuda_stream_ref stream) noexcept
+{
+  auto const num_keys = cuco::detail::distance(first, last);
+  if (num_keys == 0) { return; }
+
+  auto const grid_size =
+    (num_keys + detail::CUCO_DEFAULT_STRIDE * detail::CUCO_DEFAULT_BLOCK_SIZE - 1) /
+    (detail::CUCO_DEFAULT_STRIDE * detail::CUCO_DEFAULT_BLOCK_SIZE);
+
+  counting_bloom_filter_ns::detail::add<detail::CUCO_DEFAULT_BLOCK_SIZE>
+    <<<grid_size, detail::CUCO_DEFAULT_BLOCK_SIZE, 0, stream>>>(first, num_keys, ref());
+}
+
+template <class Key, class Extent, cuda::thread_scope Scope, class Hash, class Allocator>
+template <typename InputIt>
+void counting_bloom_filter<Key, Extent, Scope, Hash, Allocator>::remove(InputIt first,
+                                                                        InputIt last,
+                                                                        cuda_stream_ref stream)
+{
+  this->remove_async(first, last, stream);
+  stream.synchronize();
+}
+
+template <class Key, class Extent, cuda::thread_scope Scope, class Hash, class Allocator>
+template <typename InputIt>
+void counting_bloom_filter<Key, Extent, Scope, Hash, Allocator>::remove_async(
+  InputIt first, InputIt last, cuda_stream_ref stream) noexcept
+{
+  auto const num_keys = cuco::detail::distance(first, last);
+  if (num_keys == 0) { return; }
+
+  auto const grid_size =
+    (num_keys + detail::CUCO_DEFAULT_STRIDE * detail::CUCO_DEFAULT_BLOCK_SIZE - 1) /
+    (detail::CUCO_DEFAULT_STRIDE * detail::CUCO_DEFAULT_BLOCK_SIZE);
+
+  counting_bloom_filter_ns::detail::remove<detail::CUCO_DEFAULT_BLOCK_SIZE>
+    <<<grid_size, detail::CUCO_DEFAULT_BLOCK_SIZE, 0, stream>>>(first, num_keys, ref());
+}
+
+template <class Key, class Extent, cuda::thread_scope Scope, class Hash, class Allocator>
+template <typename InputIt, typename OutputIt>
+void counting_bloom_filter<Key, Extent, Scope, Hash, Allocator>::contains(
+  InputIt first, InputIt last, OutputIt output_begin, cuda_stream_ref stream) const
+{
+  this->contains_async(first, last, output_begin, stream);
+  stream.synchronize();
+}
+
+template <class Key, class Extent, cuda::thread_scope Scope, class Hash, class Allocator>
+template <typename InputIt, typename OutputIt>
+void counting_bloom_filter<Key, Extent, Scope, Hash, Allocator>::contains_async(
+  InputIt first, InputIt last, OutputIt output_begin, cuda_stream_ref stream) const noexcept
+{
+  auto const num_keys = cuco::detail::distance(first, last);
+  if (num_keys == 0) { return; }
+
+  auto const grid_size =
+    (num_keys + detail::CUCO_DEFAULT_STRIDE * detail::CUCO_DEFAULT_BLOCK_SIZE - 1) /
+    (detail::CUCO_DEFAULT_STRIDE * detail::CUCO_DEFAULT_BLOCK_SIZE);
+
+  counting_bloom_filter_ns::detail::contains<detail::CUCO_DEFAULT_BLOCK_SIZE>
+    <<<grid_size, detail::CUCO_DEFAULT_BLOCK_SIZE, 0, stream>>>(
+      first, num_keys, output_begin, ref());
+}
+
+template <class Key, class Extent, cuda::thread_scope Scope, class Hash, class Allocator>
+constexpr typename counting_bloom_filter<Key, Extent, Scope, Hash, Allocator>::ref_type
+counting_bloom_filter<Key, Extent, Scope, Hash, Allocator>::ref() const noexcept
+{
+  return ref_type{num_hashes_, hash_, storage_->ref()};
+}
+
+}  // namespace experimental
+}  // namespace cuco
@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cuco/detail/hash_functions/murmurhash3.cuh>
+#include <cuco/detail/traits.hpp>
+#include <cuco/utility/traits.hpp>
+
+#include <cuda/atomic>
+#include <cuda/std/array>
+
+#include <cstdint>
+
+namespace cuco {
+namespace experimental {
+
+template <typename Key, cuda::thread_scope Scope, typename Hash, typename StorageRef>
+__host__ __device__ constexpr counting_bloom_filter_ref<Key, Scope, Hash, StorageRef>::
+  counting_bloom_filter_ref(int32_t num_hashes,
+                            hasher const& hash,
+                            storage_ref_type storage_ref) noexcept
+  : num_hashes_{num_hashes}, hash_{hash}, storage_ref_{storage_ref}
+{
+}
+
+template <typename Key, cuda::thread_scope Scope, typename Hash, typename StorageRef>
+template <typename ProbeKey>
+__device__ void counting_bloom_filter_ref<Key, Scope, Hash, StorageRef>::add(
+  ProbeKey const& key) noexcept
+{
+  auto const hash_values = hash_key(key);
+  auto* const words      = storage_ref_.data()[block_index(hash_values[0])].data();
+
+  for (int32_t i = 0; i < num_hashes_; ++i) {
+    auto const index = counter_index(hash_values[1], i);
+    update_counter(
+      words + index / counters_per_word, (index % counters_per_word) * counter_bits, 1);
+  }
+}
+
+template <typename Key, cuda::thread_scope Scope, typename Hash, typename StorageRef>
+template <typename ProbeKey>
+__device__ void counting_bloom_filter_ref<Key, Scope, Hash, StorageRef>::remove(
+  ProbeKey const& key) noexcept
+{
+  auto const hash_values = hash_key(key);
+  auto* const words      = storage_ref_.data()[block_index(hash_values[0])].data();
+
+  for (int32_t i = 0; i < num_hashes_; ++i) {
+    auto const index = counter_index(hash_values[1], i);
+    update_counter(
+      words + index / counters_per_word, (index % counters_per_word) * counter_bits, -1);
+  }
+}
+
+template <typename Key, cuda::thread_scope Scope, typename Hash, typename StorageRef>
+template <typename ProbeKey>
+__device__ bool counting_bloom_filter_ref<Key, Scope, Hash, StorageRef>::contains(
+  ProbeKey const& key) const noexcept
+{
+  auto const hash_values = hash_key(key);
+  // Loads the whole cache line at once
+  auto const block = storage_ref_[block_index(hash_values[0])];
+
+  for (int32_t i = 0; i < num_hashes_; ++i) {
+    auto const index   = counter_index(hash_values[1], i);
+    auto const counter = (block[index / counters_per_word] >>
+                          ((index % counters_per_word) * counter_bits)) &
+                         counter_max;
+    if (counter == 0) { return false; }
+  }
+  return true;
+}
+
+template <typename Key, cuda::thread_scope Scope, typename Hash, typename StorageRef>
+__host__ __device__ constexpr typename counting_bloom_filter_ref<Key, Scope, Hash, StorageRef>::
+  size_type
+  counting_bloom_filter_ref<Key, Scope, Hash, StorageRef>::num_blocks() const noexcept
+{
+  return storage_ref_.num_windows();
+}
+
+template <typename Key, cuda::thread_scope Scope, typename Hash, typename StorageRef>
+__host__ __device__ constexpr int32_t
+counting_bloom_filter_ref<Key, Scope, Hash, StorageRef>::num_hashes() const noexcept
+{
+  return num_hashes_;
+}
+
+template <typename Key, cuda::thread_scope Scope, typename Hash, typename StorageRef>
+template <typename ProbeKey>
+__device__ constexpr cuda::std::array<std::uint64_t, 2>
+counting_bloom_filter_ref<Key, Scope, Hash, StorageRef>::hash_key(
+  ProbeKey const& key) const noexcept
+{
+  if constexpr (cuco::detail::is_wide_hash_v<Hash, ProbeKey>) {
+    // The lower half selects the block and the upper half seeds the counters
+    return hash_(key);
+  } else if constexpr (sizeof(decltype(hash_(key))) < sizeof(std::uint64_t)) {
+    // Spreads a narrow hash value over all 64 bits, otherwise every key would be mapped to the
+    // first block with a step of one
+    auto const hash_value = cuco::detail::MurmurHash3_fmix64<std::uint64_t>{}(
+      static_cast<std::uint64_t>(hash_(key)));
+    return {hash_value, hash_value};
+  } else {
+    auto const hash_value = static_cast<std::uint64_t>(hash_(key));
+    return {hash_value, hash_value};
+  }
+}
+
+template <typename Key, cuda::thread_scope Scope, typename Hash, typename StorageRef>
+__device__ constexpr typename counting_bloom_filter_ref<Key, Scope, Hash, StorageRef>::size_type
+counting_bloom_filter_ref<Key, Scope, Hash, StorageRef>::block_index(
+  std::uint64_t hash_value) const noexcept
+{
+  // Maps the upper 32 bits onto `[0, num_blocks)` without a modulo
+  return static_cast<size_type>(((hash_value >> 32) * static_cast<std::uint64_t>(num_blocks())) >>
+                                32);
+}
+
+template <typename Key, cuda::thread_scope Scope, typename Hash, typename StorageRef>
+__device__ constexpr int32_t counting_bloom_filter_ref<Key, Scope, Hash, StorageRef>::counter_index(
+  std::uint64_t hash_value, int32_t i) const noexcept
+{
+  // The lower 32 bits seed the first counter and the upper 32 bits the step. With a 64-bit hash,
+  // the block index only depends on the most significant bits of the upper half, the step only on
+  // its least significant bits, since `counters_per_block` is a power of two.
+  auto const h1 = static_cast<std::uint32_t>(hash_value);
+  auto const h2 = static_cast<std::uint32_t>(hash_value >> 32) | 1u;
+  return static_cast<int32_t>((h1 + static_cast<std::uint32_t>(i) * h2) % counters_per_block);
+}
+
+template <typename Key, cuda::thread_scope Scope, typename Hash, typename StorageRef>
+__device__ void counting_bloom_filter_ref<Key, Scope, Hash, StorageRef>::update_counter(
+  word_type* address, int32_t shift, int32_t delta) noexcept
+{
+  auto const mask = counter_max << shift;
+  auto expected   = *reinterpret_cast<word_type volatile*>(address);
+  while (true) {
+    auto const counter = (expected & mask) >> shift;
+    // Saturated counters are sticky and empty counters cannot be decremented
+    if (counter == counter_max or (delta < 0 and counter == 0)) { return; }
+
+    auto const step    = word_type{1} << shift;
+    auto const desired = delta > 0 ? expected + step : expected - step;
+    auto const old     = compare_and_swap(address, expected, desired);
+    if (old == expected) { return; }
+    expected = old;
+  }
+}
+
+template <typename Key, cuda::thread_scope Scope, typename Hash, typename StorageRef>
+__device__ typename counting_bloom_filter_ref<Key, Scope, Hash, StorageRef>::word_type
+counting_bloom_filter_ref<Key, Scope, Hash, StorageRef>::compare_and_swap(
+  word_type* address, word_type expected, word_type desired) noexcept
+{
+  if constexpr (Scope == cuda::thread_scope_system) {
+    return atomicCAS_system(address, expected, desired);
+  } else if constexpr (Scope == cuda::thread_scope_device) {
+    return atomicCAS(address, expected, desired);
+  } else if constexpr (Scope == cuda::thread_scope_block) {
+    return atomicCAS_block(address, expected, desired);
+  } else {
+    static_assert(cuco::dependent_false<decltype(Scope)>, "Unsupported thread scope");
+  }
+}
+
+}  // namespace experimental
+}  // namespace cuco
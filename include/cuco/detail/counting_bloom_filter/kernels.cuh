@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cuco/detail/utils.hpp>
+
+#include <cooperative_groups.h>
+
+namespace cuco {
+namespace experimental {
+namespace counting_bloom_filter_ns {
+namespace detail {
+
+/**
+ * @brief Adds all keys in the range `[first, first + n)` to the filter.
+ *
+ * @tparam BlockSize Number of threads in each block
+ * @tparam InputIt Device accessible input iterator whose `value_type` is convertible to the
+ * filter's `key_type`
+ * @tparam Ref Type of non-owning device ref allowing access to the counters
+ *
+ * @param first Beginning of the sequence of keys
+ * @param n Number of keys to add
+ * @param ref Non-owning filter device ref used to access the counters
+ */
+template <int32_t BlockSize, typename InputIt, typename Ref>
+__global__ void add(InputIt first, cuco::detail::index_type n, Ref ref)
+{
+  cuco::detail::index_type const loop_stride = gridDim.x * BlockSize;
+  cuco::detail::index_type idx               = BlockSize * blockIdx.x + threadIdx.x;
+
+  while (idx < n) {
+    typename Ref::key_type const key{*(first + idx)};
+    ref.add(key);
+    idx += loop_stride;
+  }
+}
+
+/**
+ * @brief Removes all keys in the range `[first, first + n)` from the filter.
+ *
+ * @tparam BlockSize Number of threads in each block
+ * @tparam InputIt Device accessible input iterator whose `value_type` is convertible to the
+ * filter's `key_type`
+ * @tparam Ref Type of non-owning device ref allowing access to the counters
+ *
+ * @param first Beginning of the sequence of keys
+ * @param n Number of keys to remove
+ * @param ref Non-owning filter device ref used to access the counters
+ */
+template <int32_t BlockSize, typename InputIt, typename Ref>
+__global__ void remove(InputIt first, cuco::detail::index_type n, Ref ref)
+{
+  cuco::detail::index_type const loop_stride = gridDim.x * BlockSize;
+  cuco::detail::index_type idx               = BlockSize * blockIdx.x + threadIdx.x;
+
+  while (idx < n) {
+    typename Ref::key_type const key{*(first + idx)};
+    ref.remove(key);
+    idx += loop_stride;
+  }
+}
+
+/**
+ * @brief Indicates whether the keys in the range `[first, first + n)` may be contained in the
+ * filter.
+ *
+ * @note If all counters of the key `*(first + i)` are non-zero, stores `true` to
+ * `(output_begin + i)`. Else, stores `false`.
+ *
+ * @tparam BlockSize Number of threads in each block
+ * @tparam InputIt Device accessible input iterator
+ * @tparam OutputIt Device accessible output iterator assignable from `bool`
+ * @tparam Ref Type of non-owning device ref allowing access to the counters
+ *
+ * @param first Beginning of the sequence of keys
+ * @param n Number of keys
+ * @param output_begin Beginning of the sequence of booleans for the presence of each key
+ * @param ref Non-owning filter device ref used to access the counters
+ */
+template <int32_t BlockSize, typename InputIt, typename OutputIt, typename Ref>
+__global__ void contains(InputIt first, cuco::detail::index_type n, OutputIt output_begin, Ref ref)
+{
+  namespace cg = cooperative_groups;
+
+  auto const block      = cg::this_thread_block();
+  auto const thread_idx = block.thread_rank();
+
+  cuco::detail::index_type const loop_stride = gridDim.x * BlockSize;
+  cuco::detail::index_type idx               = BlockSize * blockIdx.x + threadIdx.x;
+
+  __shared__ bool output_buffer[BlockSize];
+
+  while (idx - thread_idx < n) {  // the whole thread block falls into the same iteration
+    if (idx < n) {
+      auto const key = *(first + idx);
+      // Stage results in shared memory for the same reason as `static_set::contains`
+      output_buffer[thread_idx] = ref.contains(key);
+    }
+    block.sync();
+    if (idx < n) { *(output_begin + idx) = output_buffer[thread_idx]; }
+    idx += loop_stride;
+  }
+}
+
+}  // namespace detail
+}  // namespace counting_bloom_filter_ns
+}  // namespace experimental
+}  // namespace cuco
@@ -16,8 +16,10 @@
 #pragma once
 
 #include <cuco/detail/bitwise_compare.cuh>
+#include <cuco/detail/canonicalize.cuh>
 
 #include <cstddef>
+#include <type_traits>
 
 namespace cuco {
 namespace experimental {
@@ -60,12 +62,24 @@ struct equal_wrapper {
    * @param lhs Left-hand side element to check equality
    * @param rhs Right-hand side element to check equality
    *
+   * @note `float` and `double` elements are canonicalized before being passed to `equal_`, and all
+   * NaNs are equivalent to each other, so that they form a single key.
+   *
    * @return `EQUAL` if `lhs` and `rhs` are equivalent. `UNEQUAL` otherwise.
    */
   template <typename U>
   __device__ constexpr equal_result equal_to(T const& lhs, U const& rhs) const noexcept
   {
-    return equal_(lhs, rhs) ? equal_result::EQUAL : equal_result::UNEQUAL;
+    if constexpr (cuco::detail::is_canonicalized_v<T> and std::is_same_v<T, U>) {
+      auto const canonical_lhs = cuco::detail::canonicalize(lhs);
+      auto const canonical_rhs = cuco::detail::canonicalize(rhs);
+      if (canonical_lhs != canonical_lhs) {  // NaN
+        return canonical_rhs != canonical_rhs ? equal_result::EQUAL : equal_result::UNEQUAL;
+      }
+      return equal_(canonical_lhs, canonical_rhs) ? equal_result::EQUAL : equal_result::UNEQUAL;
+    } else {
+      return equal_(lhs, rhs) ? equal_result::EQUAL : equal_result::UNEQUAL;
+    }
   }
 
   /**
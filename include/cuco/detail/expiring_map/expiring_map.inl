@@ -0,0 +1,373 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cuco/cuda_stream_ref.hpp>
+#include <cuco/detail/bitwise_compare.cuh>
+#include <cuco/detail/error.hpp>
+#include <cuco/detail/expiring_map/functors.cuh>
+#include <cuco/detail/expiring_map/kernels.cuh>
+#include <cuco/detail/storage/counter_storage.cuh>
+#include <cuco/detail/tuning.cuh>
+#include <cuco/detail/utils.hpp>
+#include <cuco/expiring_map_ref.cuh>
+#include <cuco/operator.hpp>
+
+#include <cstddef>
+
+namespace cuco {
+namespace experimental {
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+expiring_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::expiring_map(
+  Extent capacity,
+  empty_key<Key> empty_key_sentinel,
+  empty_value<T> empty_value_sentinel,
+  erased_key<Key> erased_key_sentinel,
+  timestamp_type time_to_live,
+  KeyEqual const& pred,
+  ProbingScheme const& probing_scheme,
+  Allocator const& alloc,
+  cuda_stream_ref stream)
+  : impl_{std::make_unique<impl_type>(
+      capacity,
+      empty_key_sentinel,
+      slot_type{empty_key_sentinel, payload_type{empty_value_sentinel, timestamp_type{0}}},
+      pred,
+      probing_scheme,
+      alloc,
+      stream)},
+    empty_value_sentinel_{empty_value_sentinel},
+    erased_key_sentinel_{erased_key_sentinel},
+    time_to_live_{time_to_live}
+{
+  CUCO_EXPECTS(not cuco::detail::bitwise_compare(this->empty_key_sentinel(), erased_key_sentinel_),
+               "The empty key sentinel and erased key sentinel cannot be the same value.");
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+void expiring_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::clear(
+  cuda_stream_ref stream) noexcept
+{
+  impl_->clear(stream);
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+void expiring_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::clear_async(
+  cuda_stream_ref stream) noexcept
+{
+  impl_->clear_async(stream);
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+template <typename InputIt>
+expiring_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::size_type
+expiring_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::insert(
+  InputIt first, InputIt last, timestamp_type now, cuda_stream_ref stream)
+{
+  return impl_->insert(first, last, ref(now, op::insert), stream);
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+template <typename InputIt>
+void expiring_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+  insert_async(InputIt first, InputIt last, timestamp_type now, cuda_stream_ref stream) noexcept
+{
+  impl_->insert_async(first, last, ref(now, op::insert), stream);
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+template <typename InputIt, typename OutputIt>
+void expiring_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::contains(
+  InputIt first,
+  InputIt last,
+  OutputIt output_begin,
+  timestamp_type now,
+  cuda_stream_ref stream) const
+{
+  contains_async(first, last, output_begin, now, stream);
+  stream.synchronize();
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+template <typename InputIt, typename OutputIt>
+void expiring_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+  contains_async(InputIt first,
+                 InputIt last,
+                 OutputIt output_begin,
+                 timestamp_type now,
+                 cuda_stream_ref stream) const noexcept
+{
+  impl_->contains_async(first, last, output_begin, ref(now, op::contains), stream);
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+template <typename InputIt, typename OutputIt>
+void expiring_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::find(
+  InputIt first,
+  InputIt last,
+  OutputIt output_begin,
+  timestamp_type now,
+  cuda_stream_ref stream) const
+{
+  find_async(first, last, output_begin, now, stream);
+  stream.synchronize();
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+template <typename InputIt, typename OutputIt>
+void expiring_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::find_async(
+  InputIt first,
+  InputIt last,
+  OutputIt output_begin,
+  timestamp_type now,
+  cuda_stream_ref stream) const noexcept
+{
+  auto const num_keys = cuco::detail::distance(first, last);
+  if (num_keys == 0) { return; }
+
+  auto const grid_size =
+    (cg_size * num_keys + detail::CUCO_DEFAULT_STRIDE * detail::CUCO_DEFAULT_BLOCK_SIZE - 1) /
+    (detail::CUCO_DEFAULT_STRIDE * detail::CUCO_DEFAULT_BLOCK_SIZE);
+
+  expiring_map_ns::detail::find<cg_size, detail::CUCO_DEFAULT_BLOCK_SIZE>
+    <<<grid_size, detail::CUCO_DEFAULT_BLOCK_SIZE, 0, stream>>>(
+      first, num_keys, output_begin, ref(now, op::find));
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+expiring_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::size_type
+expiring_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::expire(
+  timestamp_type now, cuda_stream_ref stream)
+{
+  auto counter =
+    detail::counter_storage<size_type, thread_scope, allocator_type>{impl_->allocator()};
+  counter.reset(stream);
+
+  auto const storage_ref = impl_->storage_ref();
+  auto const is_expired  = expiring_map_ns::detail::slot_is_expired<Key, T, timestamp_type>(
+    this->empty_key_sentinel(),
+    this->erased_key_sentinel(),
+    this->empty_value_sentinel(),
+    this->time_to_live(),
+    now);
+  auto const tombstone =
+    slot_type{this->erased_key_sentinel(),
+              payload_type{this->empty_value_sentinel(), timestamp_type{0}}};
+
+  auto const grid_size =
+    (storage_ref.num_windows() + detail::CUCO_DEFAULT_STRIDE * detail::CUCO_DEFAULT_BLOCK_SIZE -
+     1) /
+    (detail::CUCO_DEFAULT_STRIDE * detail::CUCO_DEFAULT_BLOCK_SIZE);
+
+  expiring_map_ns::detail::expire<detail::CUCO_DEFAULT_BLOCK_SIZE>
+    <<<grid_size, detail::CUCO_DEFAULT_BLOCK_SIZE, 0, stream>>>(
+      storage_ref, is_expired, tombstone, counter.data());
+
+  return counter.load_to_host(stream);
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+expiring_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::size_type
+expiring_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::size(
+  cuda_stream_ref stream) const noexcept
+{
+  auto const is_filled = expiring_map_ns::detail::slot_is_filled<Key>(this->empty_key_sentinel(),
+                                                                      this->erased_key_sentinel());
+  return impl_->size(is_filled, stream);
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+constexpr auto
+expiring_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::capacity()
+  const noexcept
+{
+  return impl_->capacity();
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+constexpr expiring_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+  key_type
+  expiring_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+    empty_key_sentinel() const noexcept
+{
+  return impl_->empty_key_sentinel();
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+constexpr expiring_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+  mapped_type
+  expiring_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+    empty_value_sentinel() const noexcept
+{
+  return this->empty_value_sentinel_;
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+constexpr expiring_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+  key_type
+  expiring_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+    erased_key_sentinel() const noexcept
+{
+  return this->erased_key_sentinel_;
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+constexpr expiring_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+  timestamp_type
+  expiring_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::time_to_live()
+    const noexcept
+{
+  return this->time_to_live_;
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+template <typename... Operators>
+auto expiring_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::ref(
+  timestamp_type now, Operators...) const noexcept
+{
+  static_assert(sizeof...(Operators), "No operators specified");
+  return ref_type<Operators...>{cuco::empty_key<key_type>(this->empty_key_sentinel()),
+                                cuco::empty_value<mapped_type>(this->empty_value_sentinel()),
+                                cuco::erased_key<key_type>(this->erased_key_sentinel()),
+                                this->time_to_live(),
+                                now,
+                                impl_->key_eq(),
+                                impl_->probing_scheme(),
+                                impl_->storage_ref()};
+}
+}  // namespace experimental
+}  // namespace cuco
@@ -0,0 +1,774 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cuco/detail/bitwise_compare.cuh>
+#include <cuco/detail/equal_wrapper.cuh>
+#include <cuco/operator.hpp>
+#include <cuco/utility/traits.hpp>
+
+#include <cuda/atomic>
+
+#include <cooperative_groups.h>
+
+#include <cstdint>
+
+namespace cuco {
+namespace experimental {
+
+template <typename Key,
+          typename T,
+          cuda::thread_scope Scope,
+          typename KeyEqual,
+          typename ProbingScheme,
+          typename StorageRef,
+          typename... Operators>
+__host__ __device__ constexpr expiring_map_ref<
+  Key,
+  T,
+  Scope,
+  KeyEqual,
+  ProbingScheme,
+  StorageRef,
+  Operators...>::expiring_map_ref(cuco::empty_key<Key> empty_key_sentinel,
+                                  cuco::empty_value<T> empty_value_sentinel,
+                                  cuco::erased_key<Key> erased_key_sentinel,
+                                  timestamp_type time_to_live,
+                                  timestamp_type now,
+                                  KeyEqual const& predicate,
+                                  ProbingScheme const& probing_scheme,
+                                  StorageRef storage_ref) noexcept
+  : impl_{slot_type{empty_key_sentinel, payload_type{empty_value_sentinel, timestamp_type{0}}},
+          probing_scheme,
+          storage_ref},
+    predicate_{empty_key_sentinel, predicate},
+    empty_value_sentinel_{empty_value_sentinel},
+    erased_key_sentinel_{erased_key_sentinel},
+    time_to_live_{time_to_live},
+    now_{now},
+    probing_scheme_{probing_scheme},
+    storage_ref_{storage_ref}
+{
+}
+
+template <typename Key,
+          typename T,
+          cuda::thread_scope Scope,
+          typename KeyEqual,
+          typename ProbingScheme,
+          typename StorageRef,
+          typename... Operators>
+__host__ __device__ constexpr auto
+expiring_map_ref<Key, T, Scope, KeyEqual, ProbingScheme, StorageRef, Operators...>::capacity()
+  const noexcept
+{
+  return impl_.capacity();
+}
+
+template <typename Key,
+          typename T,
+          cuda::thread_scope Scope,
+          typename KeyEqual,
+          typename ProbingScheme,
+          typename StorageRef,
+          typename... Operators>
+__host__ __device__ constexpr Key
+expiring_map_ref<Key, T, Scope, KeyEqual, ProbingScheme, StorageRef, Operators...>::
+  empty_key_sentinel() const noexcept
+{
+  return predicate_.predicate_.empty_sentinel_;
+}
+
+template <typename Key,
+          typename T,
+          cuda::thread_scope Scope,
+          typename KeyEqual,
+          typename ProbingScheme,
+          typename StorageRef,
+          typename... Operators>
+__host__ __device__ constexpr T
+expiring_map_ref<Key, T, Scope, KeyEqual, ProbingScheme, StorageRef, Operators...>::
+  empty_value_sentinel() const noexcept
+{
+  return empty_value_sentinel_;
+}
+
+template <typename Key,
+          typename T,
+          cuda::thread_scope Scope,
+          typename KeyEqual,
+          typename ProbingScheme,
+          typename StorageRef,
+          typename... Operators>
+__host__ __device__ constexpr Key
+expiring_map_ref<Key, T, Scope, KeyEqual, ProbingScheme, StorageRef, Operators...>::
+  erased_key_sentinel() const noexcept
+{
+  return erased_key_sentinel_;
+}
+
+template <typename Key,
+          typename T,
+          cuda::thread_scope Scope,
+          typename KeyEqual,
+          typename ProbingScheme,
+          typename StorageRef,
+          typename... Operators>
+__host__ __device__ constexpr typename expiring_map_ref<Key,
+                                                        T,
+                                                        Scope,
+                                                        KeyEqual,
+                                                        ProbingScheme,
+                                                        StorageRef,
+                                                        Operators...>::timestamp_type
+expiring_map_ref<Key, T, Scope, KeyEqual, ProbingScheme, StorageRef, Operators...>::time_to_live()
+  const noexcept
+{
+  return time_to_live_;
+}
+
+template <typename Key,
+          typename T,
+          cuda::thread_scope Scope,
+          typename KeyEqual,
+          typename ProbingScheme,
+          typename StorageRef,
+          typename... Operators>
+__host__ __device__ constexpr typename expiring_map_ref<Key,
+                                                        T,
+                                                        Scope,
+                                                        KeyEqual,
+                                                        ProbingScheme,
+                                                        StorageRef,
+                                                        Operators...>::timestamp_type
+expiring_map_ref<Key, T, Scope, KeyEqual, ProbingScheme, StorageRef, Operators...>::now()
+  const noexcept
+{
+  return now_;
+}
+
+template <typename Key,
+          typename T,
+          cuda::thread_scope Scope,
+          typename KeyEqual,
+          typename ProbingScheme,
+          typename StorageRef,
+          typename... Operators>
+struct expiring_map_ref<Key, T, Scope, KeyEqual, ProbingScheme, StorageRef, Operators...>::
+  predicate_wrapper {
+  detail::equal_wrapper<key_type, key_equal> predicate_;
+
+  /**
+   * @brief Map predicate wrapper ctor.
+   *
+   * @param sentinel Sentinel value
+   * @param equal Equality binary callable
+   */
+  __host__ __device__ constexpr predicate_wrapper(key_type empty_key_sentinel,
+                                                  key_equal const& equal) noexcept
+    : predicate_{empty_key_sentinel, equal}
+  {
+  }
+
+  /**
+   * @brief Equality check with the given equality callable.
+   *
+   * @param lhs Left-hand side key to check equality
+   * @param rhs Right-hand side key to check equality
+   *
+   * @return `EQUAL` if `lhs` and `rhs` are equivalent. `UNEQUAL` otherwise.
+   */
+  __device__ constexpr detail::equal_result equal_to(key_type const& lhs,
+                                                     key_type const& rhs) const noexcept
+  {
+    return predicate_.equal_to(lhs, rhs);
+  }
+
+  /**
+   * @brief Order-sensitive equality operator.
+   *
+   * @note Container keys MUST be always on the left-hand side.
+   *
+   * @tparam U Right-hand side Element type
+   *
+   * @param lhs Left-hand side element to check equality
+   * @param rhs Right-hand side element to check equality
+   *
+   * @return Three way equality comparison result
+   */
+  template <typename U>
+  __device__ constexpr detail::equal_result operator()(slot_type const& lhs,
+                                                       U const& rhs) const noexcept
+  {
+    return predicate_(lhs.first, rhs);
+  }
+};
+
+template <typename Key,
+          typename T,
+          cuda::thread_scope Scope,
+          typename KeyEqual,
+          typename ProbingScheme,
+          typename StorageRef,
+          typename... Operators>
+__device__ constexpr bool
+expiring_map_ref<Key, T, Scope, KeyEqual, ProbingScheme, StorageRef, Operators...>::is_live(
+  slot_type const& slot) const noexcept
+{
+  // An empty payload marks a slot whose key has been claimed but whose payload is still in flight
+  if (cuco::detail::bitwise_compare(slot.second.first, empty_value_sentinel_)) { return false; }
+  return static_cast<timestamp_type>(now_ - slot.second.second) < time_to_live_;
+}
+
+template <typename Key,
+          typename T,
+          cuda::thread_scope Scope,
+          typename KeyEqual,
+          typename ProbingScheme,
+          typename StorageRef,
+          typename... Operators>
+__device__ constexpr bool
+expiring_map_ref<Key, T, Scope, KeyEqual, ProbingScheme, StorageRef, Operators...>::is_reusable(
+  slot_type const& slot) const noexcept
+{
+  if (cuco::detail::bitwise_compare(slot.first, erased_key_sentinel_)) { return true; }
+  if (cuco::detail::bitwise_compare(slot.first, empty_key_sentinel()) or
+      cuco::detail::bitwise_compare(slot.second.first, empty_value_sentinel_)) {
+    return false;
+  }
+  return static_cast<timestamp_type>(now_ - slot.second.second) >= time_to_live_;
+}
+
+template <typename Key,
+          typename T,
+          cuda::thread_scope Scope,
+          typename KeyEqual,
+          typename ProbingScheme,
+          typename StorageRef,
+          typename... Operators>
+__device__ typename expiring_map_ref<Key,
+                                     T,
+                                     Scope,
+                                     KeyEqual,
+                                     ProbingScheme,
+                                     StorageRef,
+                                     Operators...>::insert_result
+expiring_map_ref<Key, T, Scope, KeyEqual, ProbingScheme, StorageRef, Operators...>::attempt_claim(
+  slot_type* slot,
+  key_type const& expected_key,
+  key_type const& key,
+  payload_type const& payload) noexcept
+{
+  auto old_key      = compare_and_swap(&slot->first, expected_key, key);
+  auto* old_key_ptr = reinterpret_cast<key_type*>(&old_key);
+
+  // if key success
+  if (cuco::detail::bitwise_compare(*old_key_ptr, expected_key)) {
+    atomic_store(&slot->second, payload);
+    return insert_result::SUCCESS;
+  }
+
+  // Our key was already present in the slot, so our key is a duplicate
+  if (predicate_.equal_to(*old_key_ptr, key) == detail::equal_result::EQUAL) {
+    return insert_result::DUPLICATE;
+  }
+
+  return insert_result::CONTINUE;
+}
+
+template <typename Key,
+          typename T,
+          cuda::thread_scope Scope,
+          typename KeyEqual,
+          typename ProbingScheme,
+          typename StorageRef,
+          typename... Operators>
+__device__ typename expiring_map_ref<Key,
+                                     T,
+                                     Scope,
+                                     KeyEqual,
+                                     ProbingScheme,
+                                     StorageRef,
+                                     Operators...>::insert_result
+expiring_map_ref<Key, T, Scope, KeyEqual, ProbingScheme, StorageRef, Operators...>::attempt_reuse(
+  slot_type* slot, key_type const& key, payload_type const& payload) noexcept
+{
+  auto const expected = *slot;
+  if (cuco::detail::bitwise_compare(expected.first, erased_key_sentinel_)) {
+    return attempt_claim(slot, erased_key_sentinel_, key, payload);
+  }
+  // The slot has been reclaimed or refreshed since it was probed
+  if (not is_reusable(expected)) { return insert_result::CONTINUE; }
+
+  // Marks the expired payload as in flight first, so that the entry can neither be refreshed nor
+  // reclaimed by other threads while its key is replaced
+  auto const in_flight = payload_type{empty_value_sentinel_, expected.second.second};
+  auto const old       = compare_and_swap(&slot->second, expected.second, in_flight);
+  if (not(old == *reinterpret_cast<decltype(old) const*>(&expected.second))) {
+    return insert_result::CONTINUE;
+  }
+
+  auto const status = attempt_claim(slot, expected.first, key, payload);
+  // Hands the expired entry back if its key has changed in the meantime
+  if (status != insert_result::SUCCESS) { atomic_store(&slot->second, expected.second); }
+  return status;
+}
+
+template <typename Key,
+          typename T,
+          cuda::thread_scope Scope,
+          typename KeyEqual,
+          typename ProbingScheme,
+          typename StorageRef,
+          typename... Operators>
+__device__ bool
+expiring_map_ref<Key, T, Scope, KeyEqual, ProbingScheme, StorageRef, Operators...>::refresh(
+  slot_type* slot, payload_type const& payload) noexcept
+{
+  auto const expected = slot->second;
+
+  // The matching entry is either being inserted concurrently or still alive
+  if (cuco::detail::bitwise_compare(expected.first, empty_value_sentinel_) or
+      static_cast<timestamp_type>(now_ - expected.second) < time_to_live_) {
+    return false;
+  }
+
+  auto const old = compare_and_swap(&slot->second, expected, payload);
+
+  // Loses the race if another thread refreshed the same entry first
+  return old == *reinterpret_cast<decltype(old) const*>(&expected);
+}
+
+template <typename Key,
+          typename T,
+          cuda::thread_scope Scope,
+          typename KeyEqual,
+          typename ProbingScheme,
+          typename StorageRef,
+          typename... Operators>
+template <typename U>
+__device__ constexpr auto
+expiring_map_ref<Key, T, Scope, KeyEqual, ProbingScheme, StorageRef, Operators...>::
+  compare_and_swap(U* address, U expected, U desired)
+{
+  if constexpr (sizeof(U) == sizeof(unsigned int)) {
+    auto* const slot_ptr           = reinterpret_cast<unsigned int*>(address);
+    auto const* const expected_ptr = reinterpret_cast<unsigned int*>(&expected);
+    auto const* const desired_ptr  = reinterpret_cast<unsigned int*>(&desired);
+    if constexpr (Scope == cuda::thread_scope_system) {
+      return atomicCAS_system(slot_ptr, *expected_ptr, *desired_ptr);
+    } else if constexpr (Scope == cuda::thread_scope_device) {
+      return atomicCAS(slot_ptr, *expected_ptr, *desired_ptr);
+    } else if constexpr (Scope == cuda::thread_scope_block) {
+      return atomicCAS_block(slot_ptr, *expected_ptr, *desired_ptr);
+    } else {
+      static_assert(cuco::dependent_false<decltype(Scope)>, "Unsupported thread scope");
+    }
+  } else if constexpr (sizeof(U) == sizeof(unsigned long long int)) {
+    auto* const slot_ptr           = reinterpret_cast<unsigned long long int*>(address);
+    auto const* const expected_ptr = reinterpret_cast<unsigned long long int*>(&expected);
+    auto const* const desired_ptr  = reinterpret_cast<unsigned long long int*>(&desired);
+    if constexpr (Scope == cuda::thread_scope_system) {
+      return atomicCAS_system(slot_ptr, *expected_ptr, *desired_ptr);
+    } else if constexpr (Scope == cuda::thread_scope_device) {
+      return atomicCAS(slot_ptr, *expected_ptr, *desired_ptr);
+    } else if constexpr (Scope == cuda::thread_scope_block) {
+      return atomicCAS_block(slot_ptr, *expected_ptr, *desired_ptr);
+    } else {
+      static_assert(cuco::dependent_false<decltype(Scope)>, "Unsupported thread scope");
+    }
+  }
+}
+
+template <typename Key,
+          typename T,
+          cuda::thread_scope Scope,
+          typename KeyEqual,
+          typename ProbingScheme,
+          typename StorageRef,
+          typename... Operators>
+template <typename U>
+__device__ constexpr void
+expiring_map_ref<Key, T, Scope, KeyEqual, ProbingScheme, StorageRef, Operators...>::atomic_store(
+  U* address, U value)
+{
+  if constexpr (sizeof(U) == sizeof(unsigned int)) {
+    auto* const slot_ptr        = reinterpret_cast<unsigned int*>(address);
+    auto const* const value_ptr = reinterpret_cast<unsigned int*>(&value);
+    if constexpr (Scope == cuda::thread_scope_system) {
+      atomicExch_system(slot_ptr, *value_ptr);
+    } else if constexpr (Scope == cuda::thread_scope_device) {
+      atomicExch(slot_ptr, *value_ptr);
+    } else if constexpr (Scope == cuda::thread_scope_block) {
+      atomicExch_block(slot_ptr, *value_ptr);
+    } else {
+      static_assert(cuco::dependent_false<decltype(Scope)>, "Unsupported thread scope");
+    }
+  } else if constexpr (sizeof(U) == sizeof(unsigned long long int)) {
+    auto* const slot_ptr        = reinterpret_cast<unsigned long long int*>(address);
+    auto const* const value_ptr = reinterpret_cast<unsigned long long int*>(&value);
+    if constexpr (Scope == cuda::thread_scope_system) {
+      atomicExch_system(slot_ptr, *value_ptr);
+    } else if constexpr (Scope == cuda::thread_scope_device) {
+      atomicExch(slot_ptr, *value_ptr);
+    } else if constexpr (Scope == cuda::thread_scope_block) {
+      atomicExch_block(slot_ptr, *value_ptr);
+    } else {
+      static_assert(cuco::dependent_false<decltype(Scope)>, "Unsupported thread scope");
+    }
+  }
+}
+
+namespace detail {
+
+template <typename Key,
+          typename T,
+          cuda::thread_scope Scope,
+          typename KeyEqual,
+          typename ProbingScheme,
+          typename StorageRef,
+          typename... Operators>
+class operator_impl<
+  op::insert_tag,
+  expiring_map_ref<Key, T, Scope, KeyEqual, ProbingScheme, StorageRef, Operators...>> {
+  using base_type = expiring_map_ref<Key, T, Scope, KeyEqual, ProbingScheme, StorageRef>;
+  using ref_type =
+    expiring_map_ref<Key, T, Scope, KeyEqual, ProbingScheme, StorageRef, Operators...>;
+  using key_type     = typename base_type::key_type;
+  using value_type   = typename base_type::value_type;
+  using slot_type    = typename base_type::slot_type;
+  using payload_type = typename base_type::payload_type;
+  using size_type    = typename base_type::size_type;
+
+  static constexpr auto cg_size     = base_type::cg_size;
+  static constexpr auto window_size = base_type::window_size;
+
+ public:
+  /**
+   * @brief Inserts an element.
+   *
+   * @note If an entry with an equivalent key already exists and has expired, its payload and
+   * timestamp are refreshed in place. Otherwise, the element reclaims the first tombstone or
+   * expired entry along its probing sequence, or claims the first empty slot if there is none.
+   * @note Must not be invoked concurrently with `expiring_map::expire`.
+   *
+   * @param value The element to insert
+   * @return True if the given element is successfully inserted or refreshed an expired entry
+   */
+  __device__ bool insert(value_type const& value) noexcept
+  {
+    static_assert(cg_size == 1, "Non-CG operation is incompatible with the current probing scheme");
+
+    ref_type& ref_         = static_cast<ref_type&>(*this);
+    auto const& key        = value.first;
+    auto const payload     = payload_type{value.second, ref_.now_};
+    auto const empty_key   = ref_.empty_key_sentinel();
+    auto const num_windows = ref_.storage_ref_.num_windows();
+
+    while (true) {
+      auto probing_iter = ref_.probing_scheme_(key, ref_.storage_ref_.window_extent());
+      slot_type* reusable{nullptr};
+      slot_type* empty{nullptr};
+
+      for (size_type probed = 0; probed < num_windows and empty == nullptr; ++probed) {
+        auto const window_slots = ref_.storage_ref_[*probing_iter];
+        auto* window_ptr        = (ref_.storage_ref_.data() + *probing_iter)->data();
+
+        for (auto i = 0; i < window_size and empty == nullptr; ++i) {
+          switch (ref_.predicate_(window_slots[i], key)) {
+            case detail::equal_result::EQUAL: return ref_.refresh(window_ptr + i, payload);
+            case detail::equal_result::EMPTY: empty = window_ptr + i; break;
+            default: {
+              if (reusable == nullptr and ref_.is_reusable(window_slots[i])) {
+                reusable = window_ptr + i;
+              }
+            }
+          }
+        }
+        ++probing_iter;
+      }
+
+      // Every slot is taken by an alive entry
+      if (reusable == nullptr and empty == nullptr) { return false; }
+
+      auto const status = reusable == nullptr
+                            ? ref_.attempt_claim(empty, empty_key, key, payload)
+                            : ref_.attempt_reuse(reusable, key, payload);
+      switch (status) {
+        case ref_type::insert_result::SUCCESS: return true;
+        case ref_type::insert_result::DUPLICATE: return false;
+        // Another key took the target slot: probe again from the beginning since an equivalent
+        // key may have been inserted into a reusable slot we already passed
+        default: break;
+      }
+    }
+  }
+
+  /**
+   * @brief Inserts an element.
+   *
+   * @note If an entry with an equivalent key already exists and has expired, its payload and
+   * timestamp are refreshed in place. Otherwise, the element reclaims the first tombstone or
+   * expired entry along its probing sequence, or claims the first empty slot if there is none.
+   * @note Must not be invoked concurrently with `expiring_map::expire`.
+   *
+   * @param group The Cooperative Group used to perform group insert
+   * @param value The element to insert
+   * @return True if the given element is successfully inserted or refreshed an expired entry
+   */
+  __device__ bool insert(cooperative_groups::thread_block_tile<cg_size> const& group,
+                         value_type const& value) noexcept
+  {
+    auto& ref_             = static_cast<ref_type&>(*this);
+    auto const& key        = value.first;
+    auto const payload     = payload_type{value.second, ref_.now_};
+    auto const empty_key   = ref_.empty_key_sentinel();
+    auto const num_windows = ref_.storage_ref_.num_windows();
+
+    while (true) {
+      auto probing_iter = ref_.probing_scheme_(group, key, ref_.storage_ref_.window_extent());
+      slot_type* reusable{nullptr};
+      slot_type* empty{nullptr};
+
+      // Each step probes one window per lane
+      for (size_type probed = 0; probed < num_windows and empty == nullptr; probed += cg_size) {
+        auto const window_slots = ref_.storage_ref_[*probing_iter];
+        auto* window_ptr        = (ref_.storage_ref_.data() + *probing_iter)->data();
+
+        // Per-lane results: first matching or empty slot, and the first reusable slot before it
+        int32_t match_idx{-1};
+        int32_t empty_idx{-1};
+        int32_t reusable_idx{-1};
+        for (auto i = 0; i < window_size; ++i) {
+          auto const eq_res = ref_.predicate_(window_slots[i], key);
+          if (eq_res == detail::equal_result::EQUAL) {
+            match_idx = i;
+            break;
+          }
+          if (eq_res == detail::equal_result::EMPTY) {
+            empty_idx = i;
+            break;
+          }
+          if (reusable_idx == -1 and ref_.is_reusable(window_slots[i])) { reusable_idx = i; }
+        }
+
+        auto const group_finds_match = group.ballot(match_idx != -1);
+        if (group_finds_match) {
+          auto const src_lane = __ffs(group_finds_match) - 1;
+          auto const status   = (group.thread_rank() == src_lane)
+                                  ? ref_.refresh(window_ptr + match_idx, payload)
+                                  : false;
+          return group.shfl(status, src_lane);
+        }
+
+        if (reusable == nullptr) {
+          auto const group_finds_reusable = group.ballot(reusable_idx != -1);
+          if (group_finds_reusable) {
+            auto const src_lane = __ffs(group_finds_reusable) - 1;
+            auto const res      = group.shfl(
+              reinterpret_cast<intptr_t>(reusable_idx == -1 ? nullptr : window_ptr + reusable_idx),
+              src_lane);
+            reusable = reinterpret_cast<slot_type*>(res);
+          }
+        }
+
+        auto const group_contains_empty = group.ballot(empty_idx != -1);
+        if (group_contains_empty) {
+          auto const src_lane = __ffs(group_contains_empty) - 1;
+          auto const res      = group.shfl(
+            reinterpret_cast<intptr_t>(empty_idx == -1 ? nullptr : window_ptr + empty_idx),
+            src_lane);
+          empty = reinterpret_cast<slot_type*>(res);
+        }
+        ++probing_iter;
+      }
+
+      // Every slot is taken by an alive entry
+      if (reusable == nullptr and empty == nullptr) { return false; }
+
+      auto const status = [&]() {
+        if (group.thread_rank() != 0) { return ref_type::insert_result::CONTINUE; }
+        return reusable == nullptr ? ref_.attempt_claim(empty, empty_key, key, payload)
+                                   : ref_.attempt_reuse(reusable, key, payload);
+      }();
+
+      switch (group.shfl(status, 0)) {
+        case ref_type::insert_result::SUCCESS: return true;
+        case ref_type::insert_result::DUPLICATE: return false;
+        default: break;
+      }
+    }
+  }
+};
+
+template <typename Key,
+          typename T,
+          cuda::thread_scope Scope,
+          typename KeyEqual,
+          typename ProbingScheme,
+          typename StorageRef,
+          typename... Operators>
+class operator_impl<
+  op::contains_tag,
+  expiring_map_ref<Key, T, Scope, KeyEqual, ProbingScheme, StorageRef, Operators...>> {
+  using base_type = expiring_map_ref<Key, T, Scope, KeyEqual, ProbingScheme, StorageRef>;
+  using ref_type =
+    expiring_map_ref<Key, T, Scope, KeyEqual, ProbingScheme, StorageRef, Operators...>;
+  using key_type   = typename base_type::key_type;
+  using value_type = typename base_type::value_type;
+
+  static constexpr auto cg_size     = base_type::cg_size;
+  static constexpr auto window_size = base_type::window_size;
+
+ public:
+  /**
+   * @brief Indicates whether the probe key `key` was inserted into the container and has not
+   * expired yet.
+   *
+   * @tparam ProbeKey Probe key type
+   *
+   * @param key The key to search for
+   *
+   * @return A boolean indicating whether the probe key is present and alive
+   */
+  template <typename ProbeKey>
+  [[nodiscard]] __device__ bool contains(ProbeKey const& key) const noexcept
+  {
+    // CRTP: cast `this` to the actual ref type
+    auto const& ref_ = static_cast<ref_type const&>(*this);
+    auto const found = ref_.impl_.find(key, ref_.predicate_);
+    return found != ref_.impl_.end() and ref_.is_live(*found);
+  }
+
+  /**
+   * @brief Indicates whether the probe key `key` was inserted into the container and has not
+   * expired yet.
+   *
+   * @tparam ProbeKey Probe key type
+   *
+   * @param group The Cooperative Group used to perform group contains
+   * @param key The key to search for
+   *
+   * @return A boolean indicating whether the probe key is present and alive
+   */
+  template <typename ProbeKey>
+  [[nodiscard]] __device__ bool contains(
+    cooperative_groups::thread_block_tile<cg_size> const& group, ProbeKey const& key) const noexcept
+  {
+    auto const& ref_ = static_cast<ref_type const&>(*this);
+    auto const found = ref_.impl_.find(group, key, ref_.predicate_);
+    return found != ref_.impl_.end() and ref_.is_live(*found);
+  }
+};
+
+template <typename Key,
+          typename T,
+          cuda::thread_scope Scope,
+          typename KeyEqual,
+          typename ProbingScheme,
+          typename StorageRef,
+          typename... Operators>
+class operator_impl<
+  op::find_tag,
+  expiring_map_ref<Key, T, Scope, KeyEqual, ProbingScheme, StorageRef, Operators...>> {
+  using base_type = expiring_map_ref<Key, T, Scope, KeyEqual, ProbingScheme, StorageRef>;
+  using ref_type =
+    expiring_map_ref<Key, T, Scope, KeyEqual, ProbingScheme, StorageRef, Operators...>;
+  using key_type       = typename base_type::key_type;
+  using value_type     = typename base_type::value_type;
+  using iterator       = typename base_type::iterator;
+  using const_iterator = typename base_type::const_iterator;
+
+  static constexpr auto cg_size     = base_type::cg_size;
+  static constexpr auto window_size = base_type::window_size;
+
+ public:
+  /**
+   * @brief Returns a const_iterator to one past the last slot.
+   *
+   * @note This API is available only when `find_tag` is present.
+   *
+   * @return A const_iterator to one past the last slot
+   */
+  [[nodiscard]] __host__ __device__ constexpr const_iterator end() const noexcept
+  {
+    auto const& ref_ = static_cast<ref_type const&>(*this);
+    return ref_.impl_.end();
+  }
+
+  /**
+   * @brief Returns an iterator to one past the last slot.
+   *
+   * @note This API is available only when `find_tag` is present.
+   *
+   * @return An iterator to one past the last slot
+   */
+  [[nodiscard]] __host__ __device__ constexpr iterator end() noexcept
+  {
+    auto const& ref_ = static_cast<ref_type const&>(*this);
+    return ref_.impl_.end();
+  }
+
+  /**
+   * @brief Finds an alive element in the map with key equivalent to the probe key.
+   *
+   * @note Returns a un-incrementable input iterator to the slot whose key is equivalent to `key`.
+   * The mapped value is stored in `found->second.first` and its timestamp in
+   * `found->second.second`. If no such element exists or if it has expired, returns `end()`.
+   *
+   * @tparam ProbeKey Probe key type
+   *
+   * @param key The key to search for
+   *
+   * @return An iterator to the position at which the equivalent key is stored
+   */
+  template <typename ProbeKey>
+  [[nodiscard]] __device__ const_iterator find(ProbeKey const& key) const noexcept
+  {
+    // CRTP: cast `this` to the actual ref type
+    auto const& ref_ = static_cast<ref_type const&>(*this);
+    auto const found = ref_.impl_.find(key, ref_.predicate_);
+    return (found == ref_.impl_.end() or not ref_.is_live(*found)) ? ref_.impl_.end() : found;
+  }
+
+  /**
+   * @brief Finds an alive element in the map with key equivalent to the probe key.
+   *
+   * @note Returns a un-incrementable input iterator to the slot whose key is equivalent to `key`.
+   * The mapped value is stored in `found->second.first` and its timestamp in
+   * `found->second.second`. If no such element exists or if it has expired, returns `end()`.
+   *
+   * @tparam ProbeKey Probe key type
+   *
+   * @param group The Cooperative Group used to perform this operation
+   * @param key The key to search for
+   *
+   * @return An iterator to the position at which the equivalent key is stored
+   */
+  template <typename ProbeKey>
+  [[nodiscard]] __device__ const_iterator find(
+    cooperative_groups::thread_block_tile<cg_size> const& group, ProbeKey const& key) const noexcept
+  {
+    auto const& ref_ = static_cast<ref_type const&>(*this);
+    auto const found = ref_.impl_.find(group, key, ref_.predicate_);
+    return (found == ref_.impl_.end() or not ref_.is_live(*found)) ? ref_.impl_.end() : found;
+  }
+};
+
+}  // namespace detail
+}  // namespace experimental
+}  // namespace cuco
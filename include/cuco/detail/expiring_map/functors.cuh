@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cuco/detail/bitwise_compare.cuh>
+
+namespace cuco {
+namespace experimental {
+namespace expiring_map_ns {
+namespace detail {
+
+/**
+ * @brief Device functor returning whether the input slot is filled, i.e., it is neither empty nor
+ * tombstoned.
+ *
+ * @tparam Key The slot key type
+ */
+template <typename Key>
+struct slot_is_filled {
+  Key empty_key_sentinel_;   ///< The value of the empty key sentinel
+  Key erased_key_sentinel_;  ///< The value of the erased key sentinel
+
+  /**
+   * @brief Constructs `slot_is_filled` functor with the given sentinels.
+   *
+   * @param empty_key_sentinel Sentinel indicating empty slot
+   * @param erased_key_sentinel Sentinel indicating tombstoned slot
+   */
+  explicit constexpr slot_is_filled(Key const& empty_key_sentinel,
+                                    Key const& erased_key_sentinel) noexcept
+    : empty_key_sentinel_{empty_key_sentinel}, erased_key_sentinel_{erased_key_sentinel}
+  {
+  }
+
+  /**
+   * @brief Indicates if the target slot `slot` is filled.
+   *
+   * @tparam Slot Slot content type
+   *
+   * @param slot The slot
+   *
+   * @return `true` if slot is filled
+   */
+  template <typename Slot>
+  __device__ constexpr bool operator()(Slot const& slot) const noexcept
+  {
+    return not(cuco::detail::bitwise_compare(empty_key_sentinel_, slot.first) or
+               cuco::detail::bitwise_compare(erased_key_sentinel_, slot.first));
+  }
+};
+
+/**
+ * @brief Device functor returning whether the input slot holds an entry that has expired at the
+ * given point in time.
+ *
+ * @tparam Key The slot key type
+ * @tparam T The mapped value type
+ * @tparam Timestamp The timestamp type
+ */
+template <typename Key, typename T, typename Timestamp>
+struct slot_is_expired {
+  slot_is_filled<Key> is_filled_;  ///< Predicate indicating if a slot is filled
+  T empty_value_sentinel_;         ///< The value of the empty value sentinel
+  Timestamp time_to_live_;         ///< Lifetime of an entry
+  Timestamp now_;                  ///< Point in time at which expiration is checked
+
+  /**
+   * @brief Constructs `slot_is_expired` functor.
+   *
+   * @param empty_key_sentinel Sentinel indicating empty slot
+   * @param erased_key_sentinel Sentinel indicating tombstoned slot
+   * @param empty_value_sentinel Sentinel indicating empty payload
+   * @param time_to_live Lifetime of an entry
+   * @param now Point in time at which expiration is checked
+   */
+  constexpr slot_is_expired(Key const& empty_key_sentinel,
+                            Key const& erased_key_sentinel,
+                            T const& empty_value_sentinel,
+                            Timestamp time_to_live,
+                            Timestamp now) noexcept
+    : is_filled_{empty_key_sentinel, erased_key_sentinel},
+      empty_value_sentinel_{empty_value_sentinel},
+      time_to_live_{time_to_live},
+      now_{now}
+  {
+  }
+
+  /**
+   * @brief Indicates if the target slot `slot` holds an expired entry.
+   *
+   * @tparam Slot Slot content type
+   *
+   * @param slot The slot
+   *
+   * @return `true` if slot holds an expired entry
+   */
+  template <typename Slot>
+  __device__ constexpr bool operator()(Slot const& slot) const noexcept
+  {
+    return is_filled_(slot) and
+           not cuco::detail::bitwise_compare(empty_value_sentinel_, slot.second.first) and
+           static_cast<Timestamp>(now_ - slot.second.second) >= time_to_live_;
+  }
+};
+
+}  // namespace detail
+}  // namespace expiring_map_ns
+}  // namespace experimental
+}  // namespace cuco
@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cuco/detail/utils.hpp>
+
+#include <cub/block/block_reduce.cuh>
+
+#include <cuda/atomic>
+
+#include <cooperative_groups.h>
+
+namespace cuco {
+namespace experimental {
+namespace expiring_map_ns {
+namespace detail {
+
+/**
+ * @brief Finds the alive map elements equivalent to all keys in the range `[first, last)`.
+ *
+ * @note If the key `*(first + i)` has an alive match in the container, copies the payload of its
+ * matched element to `(output_begin + i)`. Else, including when the match has expired, copies the
+ * empty value sentinel.
+ *
+ * @tparam CGSize Number of threads in each CG
+ * @tparam BlockSize The size of the thread block
+ * @tparam InputIt Device accessible input iterator
+ * @tparam OutputIt Device accessible output iterator assignable from the map's `mapped_type`
+ * @tparam Ref Type of non-owning device ref allowing access to storage
+ *
+ * @param first Beginning of the sequence of keys
+ * @param n Number of keys to query
+ * @param output_begin Beginning of the sequence of matched payloads retrieved for each key
+ * @param ref Non-owning map device ref used to access the slot storage
+ */
+template <int32_t CGSize, int32_t BlockSize, typename InputIt, typename OutputIt, typename Ref>
+__global__ void find(InputIt first, cuco::detail::index_type n, OutputIt output_begin, Ref ref)
+{
+  namespace cg = cooperative_groups;
+
+  auto const block      = cg::this_thread_block();
+  auto const thread_idx = block.thread_rank();
+
+  cuco::detail::index_type const loop_stride = gridDim.x * BlockSize / CGSize;
+  cuco::detail::index_type idx               = (BlockSize * blockIdx.x + threadIdx.x) / CGSize;
+  __shared__ typename Ref::mapped_type output_buffer[BlockSize / CGSize];
+
+  while (idx - thread_idx < n) {  // the whole thread block falls into the same iteration
+    if (idx < n) {
+      auto const key = *(first + idx);
+      if constexpr (CGSize == 1) {
+        auto const found = ref.find(key);
+        // Stage results in shared memory for the same reason as `static_map::find`
+        output_buffer[thread_idx] =
+          found == ref.end() ? ref.empty_value_sentinel() : (*found).second.first;
+        block.sync();
+        *(output_begin + idx) = output_buffer[thread_idx];
+      } else {
+        auto const tile  = cg::tiled_partition<CGSize>(block);
+        auto const found = ref.find(tile, key);
+
+        if (tile.thread_rank() == 0) {
+          *(output_begin + idx) =
+            found == ref.end() ? ref.empty_value_sentinel() : (*found).second.first;
+        }
+      }
+    }
+    idx += loop_stride;
+  }
+}
+
+/**
+ * @brief Replaces every slot holding an expired entry with the given tombstone and counts the
+ * number of tombstoned slots.
+ *
+ * @tparam BlockSize Number of threads in each block
+ * @tparam StorageRef Type of non-owning ref allowing access to storage
+ * @tparam Predicate Type of predicate indicating if the given slot holds an expired entry
+ * @tparam AtomicT Atomic counter type
+ *
+ * @param storage Non-owning device ref used to access the slot storage
+ * @param is_expired Predicate indicating if the given slot holds an expired entry
+ * @param tombstone Slot content used to mark an expired slot as reusable
+ * @param count Number of tombstoned slots
+ */
+template <int32_t BlockSize, typename StorageRef, typename Predicate, typename AtomicT>
+__global__ void expire(StorageRef storage,
+                       Predicate is_expired,
+                       typename StorageRef::value_type tombstone,
+                       AtomicT* count)
+{
+  using size_type = typename StorageRef::size_type;
+
+  cuco::detail::index_type const loop_stride = gridDim.x * BlockSize;
+  cuco::detail::index_type idx               = BlockSize * blockIdx.x + threadIdx.x;
+
+  size_type thread_count = 0;
+  auto const n           = storage.num_windows();
+
+  while (idx < n) {
+    auto* const window_ptr = (storage.data() + idx)->data();
+#pragma unroll
+    for (auto i = 0; i < StorageRef::window_size; ++i) {
+      if (is_expired(window_ptr[i])) {
+        window_ptr[i] = tombstone;
+        ++thread_count;
+      }
+    }
+    idx += loop_stride;
+  }
+
+  using BlockReduce = cub::BlockReduce<size_type, BlockSize>;
+  __shared__ typename BlockReduce::TempStorage temp_storage;
+  auto const block_count = BlockReduce(temp_storage).Sum(thread_count);
+  if (threadIdx.x == 0) { count->fetch_add(block_count, cuda::std::memory_order_relaxed); }
+}
+
+}  // namespace detail
+}  // namespace expiring_map_ns
+}  // namespace experimental
+}  // namespace cuco
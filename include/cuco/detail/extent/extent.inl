@@ -75,7 +75,7 @@ template <typename Container>
 template <int32_t CGSize, int32_t WindowSize, typename SizeType, std::size_t N>
 [[nodiscard]] auto constexpr make_window_extent(extent<SizeType, N> ext)
 {
-  auto constexpr max_prime = cuco::detail::primes.back();
+  auto constexpr max_prime = cuco::detail::max_prime;
   auto constexpr max_value =
     (static_cast<uint64_t>(std::numeric_limits<SizeType>::max()) < max_prime)
       ? std::numeric_limits<SizeType>::max()
@@ -86,18 +86,14 @@ template <int32_t CGSize, int32_t WindowSize, typename SizeType, std::size_t N>
 
   if constexpr (N == dynamic_extent) {
     return window_extent<CGSize, WindowSize, SizeType>{static_cast<SizeType>(
-      *cuco::detail::lower_bound(
-        cuco::detail::primes.begin(), cuco::detail::primes.end(), static_cast<uint64_t>(size)) *
-      CGSize)};
+      cuco::detail::prime_lower_bound(static_cast<uint64_t>(size)) * CGSize)};
   }
   if constexpr (N != dynamic_extent) {
     return window_extent<CGSize,
                          WindowSize,
                          SizeType,
                          static_cast<std::size_t>(
-                           *cuco::detail::lower_bound(cuco::detail::primes.begin(),
-                                                      cuco::detail::primes.end(),
-                                                      static_cast<uint64_t>(size)) *
+                           cuco::detail::prime_lower_bound(static_cast<uint64_t>(size)) *
                            CGSize)>{};
   }
 }
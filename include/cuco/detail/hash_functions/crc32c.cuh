@@ -0,0 +1,210 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cuco/detail/canonicalize.cuh>
+#include <cuco/detail/hash_functions/murmurhash3.cuh>
+#include <cuco/detail/hash_functions/utils.cuh>
+#include <cuco/extent.cuh>
+
+#include <cstddef>
+#include <cstdint>
+
+#if !defined(__CUDA_ARCH__)
+#if defined(__SSE4_2__)
+#include <nmmintrin.h>
+#elif defined(__ARM_FEATURE_CRC32)
+#include <arm_acle.h>
+#endif
+#endif
+
+namespace cuco::detail {
+
+/**
+ * @brief Updates a CRC32C remainder with the lowest `Bits` bits of `data`, one bit at a time.
+ *
+ * Portable fallback of the hardware CRC32C instructions, used on device and on hosts without them.
+ *
+ * @tparam Bits Number of bits of `data` to consume, at most 32
+ *
+ * @param crc Current remainder
+ * @param data Input bits
+ * @return The updated remainder
+ */
+template <int Bits>
+constexpr __host__ __device__ std::uint32_t crc32c_bitwise(std::uint32_t crc,
+                                                           std::uint32_t data) noexcept
+{
+  constexpr std::uint32_t polynomial = 0x82f63b78;  // reversed Castagnoli polynomial
+
+  crc ^= data;
+  for (int i = 0; i < Bits; ++i) {
+    crc = (crc >> 1) ^ (polynomial & (0u - (crc & 1u)));
+  }
+  return crc;
+}
+
+/**
+ * @brief Updates a CRC32C remainder with one byte.
+ *
+ * @param crc Current remainder
+ * @param data Input byte
+ * @return The updated remainder
+ */
+__host__ __device__ inline std::uint32_t crc32c_u8(std::uint32_t crc, std::uint8_t data) noexcept
+{
+#if !defined(__CUDA_ARCH__) && defined(__SSE4_2__)
+  return _mm_crc32_u8(crc, data);
+#elif !defined(__CUDA_ARCH__) && defined(__ARM_FEATURE_CRC32)
+  return __crc32cb(crc, data);
+#else
+  return crc32c_bitwise<8>(crc, data);
+#endif
+}
+
+/**
+ * @brief Updates a CRC32C remainder with a 4-byte word.
+ *
+ * @param crc Current remainder
+ * @param data Input word
+ * @return The updated remainder
+ */
+__host__ __device__ inline std::uint32_t crc32c_u32(std::uint32_t crc, std::uint32_t data) noexcept
+{
+#if !defined(__CUDA_ARCH__) && defined(__SSE4_2__)
+  return _mm_crc32_u32(crc, data);
+#elif !defined(__CUDA_ARCH__) && defined(__ARM_FEATURE_CRC32)
+  return __crc32cw(crc, data);
+#else
+  return crc32c_bitwise<32>(crc, data);
+#endif
+}
+
+/**
+ * @brief Updates a CRC32C remainder with an 8-byte word.
+ *
+ * @param crc Current remainder
+ * @param data Input word
+ * @return The updated remainder
+ */
+__host__ __device__ inline std::uint32_t crc32c_u64(std::uint32_t crc, std::uint64_t data) noexcept
+{
+#if !defined(__CUDA_ARCH__) && defined(__SSE4_2__) && defined(__x86_64__)
+  return static_cast<std::uint32_t>(_mm_crc32_u64(crc, data));
+#elif !defined(__CUDA_ARCH__) && defined(__ARM_FEATURE_CRC32)
+  return __crc32cd(crc, data);
+#else
+  return crc32c_u32(crc32c_u32(crc, static_cast<std::uint32_t>(data)),
+                    static_cast<std::uint32_t>(data >> 32));
+#endif
+}
+
+/**
+ * @brief Computes the CRC-32C (Castagnoli) checksum of the given bytes, as defined by RFC 3720.
+ *
+ * @tparam Extent The extent type
+ *
+ * @param bytes The input bytes
+ * @param size The extent of the data in bytes
+ * @return The checksum of `bytes`
+ */
+template <typename Extent>
+constexpr __host__ __device__ std::uint32_t crc32c(std::byte const* bytes, Extent size) noexcept
+{
+  std::uint32_t crc = ~std::uint32_t{0};
+
+  std::size_t const nchunks = size / 8;
+  for (std::size_t i = 0; i < nchunks; ++i) {
+    crc = crc32c_u64(crc, load_chunk<std::uint64_t>(bytes, i));
+  }
+
+  std::size_t offset = nchunks * 8;
+  if (size - offset >= 4) {
+    crc = crc32c_u32(crc, load_chunk<std::uint32_t>(bytes + offset, 0));
+    offset += 4;
+  }
+  for (; offset < size; ++offset) {
+    crc = crc32c_u8(crc, static_cast<std::uint8_t>(bytes[offset]));
+  }
+
+  return ~crc;
+}
+
+/**
+ * @brief A `CRC32C_32` hash function to hash the given argument on host and device.
+ *
+ * Computes the CRC-32C (Castagnoli) checksum of the key bytes, as defined by RFC 3720, and mixes
+ * it with the seed through the `MurmurHash3` 32-bit finalizer. On hosts providing CRC32C
+ * instructions, i.e., x86 with SSE4.2 or ARMv8 with the CRC extension, every 8 bytes of input cost
+ * a single instruction. On device and on other hosts, a bitwise implementation yielding identical
+ * results is used instead.
+ *
+ * @note CRC32C is linear over GF(2): keys whose bytes differ by the same bit pattern always have
+ * checksums differing by the same bits. The finalizer makes every checksum bit affect every output
+ * bit, but as a bijection it cannot remove the collisions of the checksum. CRC32C spreads dense
+ * integer keys well over the slots of a table, which makes it a cheap first-level hash for linear
+ * probing, but it must not be used where hash values need to be hard to collide.
+ *
+ * @tparam Key The type of the values to hash
+ */
+template <typename Key>
+struct CRC32C_32 {
+  using argument_type = Key;            ///< The type of the values taken as argument
+  using result_type   = std::uint32_t;  ///< The type of the hash values produced
+
+  /**
+   * @brief Constructs a CRC32C hash function with the given `seed`.
+   *
+   * @param seed A custom number to randomize the resulting hash value
+   */
+  __host__ __device__ constexpr CRC32C_32(std::uint32_t seed = 0) : fmix32_{0}, seed_{seed} {}
+
+  /**
+   * @brief Returns a hash value for its argument, as a value of type `result_type`.
+   *
+   * @param key The input argument to hash
+   * @return The resulting hash value for `key`
+   */
+  constexpr result_type __host__ __device__ operator()(Key const& key) const noexcept
+  {
+    auto const& canonical_key = cuco::detail::canonicalize(key);
+    return compute_hash(reinterpret_cast<std::byte const*>(&canonical_key),
+                        cuco::experimental::extent<std::size_t, sizeof(Key)>{});
+  }
+
+  /**
+   * @brief Returns a hash value for its argument, as a value of type `result_type`.
+   *
+   * @tparam Extent The extent type
+   *
+   * @param bytes The input argument to hash
+   * @param size The extent of the data in bytes
+   * @return The resulting hash value
+   */
+  template <typename Extent>
+  constexpr result_type __host__ __device__ compute_hash(std::byte const* bytes,
+                                                         Extent size) const noexcept
+  {
+    return fmix32_(crc32c(bytes, size) ^ seed_);
+  }
+
+ private:
+  MurmurHash3_fmix32<std::uint32_t> fmix32_;
+  std::uint32_t seed_;
+};
+
+}  // namespace cuco::detail
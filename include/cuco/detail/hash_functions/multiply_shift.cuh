@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cuco/detail/hash_functions/utils.cuh>
+
+#include <cstdint>
+#include <type_traits>
+
+namespace cuco::detail {
+
+/**
+ * @brief A multiply-shift hash function for integer keys on host and device.
+ *
+ * Keys are hashed with Dietzfelbinger's multiply-add-shift scheme: the hash value is the high 64
+ * bits of `a * key + b * 2^64` computed modulo 2^128, with a 128-bit odd multiplier `a`. This costs
+ * two 64-bit multiplications, one of them a `__umul64hi` on device. The low 64 bits of `a` default
+ * to 2^64 divided by the golden ratio, i.e., Fibonacci hashing.
+ *
+ * The result is finally xor-folded onto itself. Without it, the hash values of strided keys form
+ * a lattice that can resonate with the modulo-prime reduction of the table capacity and cluster
+ * into a few slots. The fold is a bijection and thus preserves the collision probabilities.
+ *
+ * @note Multiply-shift is a universal family, not a high-quality mixer: it is meant as a cheap
+ * first-level hash for integer keys, e.g., with `linear_probing`.
+ *
+ * @throw Key type must be an integral type
+ * @throw Key type must be at most 8 bytes in size
+ *
+ * @tparam Key The type of the values to hash
+ */
+template <typename Key>
+struct MultiplyShift {
+  static_assert(std::is_integral_v<Key>, "Key type must be an integral type.");
+  static_assert(sizeof(Key) <= 8, "Key type must be at most 8 bytes in size.");
+
+  using argument_type = Key;            ///< The type of the values taken as argument
+  using result_type   = std::uint64_t;  ///< The type of the hash values produced
+
+  /**
+   * @brief Constructs a multiply-shift hash function with the given `seed`.
+   *
+   * The seed selects the multiplier, keeping it odd, and the additive term.
+   *
+   * @param seed A custom number to randomize the resulting hash value
+   */
+  __host__ __device__ constexpr MultiplyShift(std::uint64_t seed = 0)
+    : multiplier_lo_{0x9e3779b97f4a7c15ull * (2 * seed + 1)},
+      multiplier_hi_{0xbf58476d1ce4e5b9ull * (2 * seed + 1)},
+      increment_{0x94d049bb133111ebull * seed}
+  {
+  }
+
+  /**
+   * @brief Returns a hash value for its argument, as a value of type `result_type`.
+   *
+   * @param key The input argument to hash
+   * @return A resulting hash value for `key`
+   */
+  constexpr result_type __host__ __device__ operator()(Key const& key) const noexcept
+  {
+    auto const x     = static_cast<std::uint64_t>(key);
+    std::uint64_t lo = 0;
+    std::uint64_t hi = 0;
+    mul128(x, multiplier_lo_, lo, hi);
+    // high 64 bits of (multiplier * x + increment * 2^64) mod 2^128
+    auto const h = multiplier_hi_ * x + hi + increment_;
+    return h ^ (h >> 32);
+  }
+
+ private:
+  std::uint64_t multiplier_lo_;
+  std::uint64_t multiplier_hi_;
+  std::uint64_t increment_;
+};
+
+}  // namespace cuco::detail
@@ -16,9 +16,12 @@
 
 #pragma once
 
+#include <cuco/detail/canonicalize.cuh>
 #include <cuco/detail/hash_functions/utils.cuh>
 #include <cuco/extent.cuh>
 
+#include <cuda/std/array>
+
 #include <cstddef>
 #include <cstdint>
 #include <type_traits>
@@ -144,7 +147,8 @@ struct MurmurHash3_32 {
    */
   constexpr result_type __host__ __device__ operator()(Key const& key) const noexcept
   {
-    return compute_hash(reinterpret_cast<std::byte const*>(&key),
+    auto const& canonical_key = cuco::detail::canonicalize(key);
+    return compute_hash(reinterpret_cast<std::byte const*>(&canonical_key),
                         cuco::experimental::extent<std::size_t, sizeof(Key)>{});
   }
 
@@ -206,4 +210,275 @@ struct MurmurHash3_32 {
   MurmurHash3_fmix32<std::uint32_t> fmix32_;
   std::uint32_t seed_;
 };
+
+/**
+ * @brief An incremental `MurmurHash3_32` hash function to hash a sequence of inputs on host and
+ * device.
+ *
+ * Feeding the bytes of a key through any number of `update` calls yields the same hash value as
+ * `MurmurHash3_32::compute_hash` on the concatenation of these bytes, without materializing it.
+ * This allows hashing composite keys field by field, e.g., the columns of a row or a key and a
+ * salt.
+ *
+ * @note Inputs are consumed in 4-byte blocks. Up to 3 trailing bytes are buffered by the hasher
+ * until the next `update` or `digest` call.
+ */
+class IncrementalMurmurHash3_32 {
+ private:
+  static constexpr std::uint32_t c1 = 0xcc9e2d51;
+  static constexpr std::uint32_t c2 = 0x1b873593;
+
+  static constexpr std::uint32_t block_size = 4;
+
+ public:
+  using result_type = std::uint32_t;  ///< The type of the hash values produced
+
+  /**
+   * @brief Constructs an incremental MurmurHash3_32 hash function with the given `seed`.
+   *
+   * @param seed A custom number to randomize the resulting hash value
+   */
+  __host__ __device__ constexpr IncrementalMurmurHash3_32(std::uint32_t seed = 0)
+    : fmix32_{0}, h1_{seed}, buffer_{}, buffer_size_{0}, total_size_{0}
+  {
+  }
+
+  /**
+   * @brief Appends the given bytes to the input.
+   *
+   * @param bytes The bytes to append
+   * @param size The number of bytes to append
+   */
+  constexpr void __host__ __device__ update(std::byte const* bytes, std::size_t size) noexcept
+  {
+    total_size_ += size;
+
+    std::size_t offset = 0;
+    if (buffer_size_ > 0) {
+      for (; buffer_size_ < block_size and offset < size; ++offset) {
+        buffer_[buffer_size_++] = bytes[offset];
+      }
+      if (buffer_size_ < block_size) { return; }
+      consume_block(load_chunk<std::uint32_t>(buffer_, 0));
+      buffer_size_ = 0;
+    }
+    for (; offset + block_size <= size; offset += block_size) {
+      consume_block(load_chunk<std::uint32_t>(bytes + offset, 0));
+    }
+    for (; offset < size; ++offset) {
+      buffer_[buffer_size_++] = bytes[offset];
+    }
+  }
+
+  /**
+   * @brief Appends the object representation of `value` to the input.
+   *
+   * `float` and `double` values are canonicalized first, see `cuco::detail::canonicalize`.
+   *
+   * @tparam T The type of the value to append
+   *
+   * @param value The value to append
+   */
+  template <typename T>
+  constexpr void __host__ __device__ update(T const& value) noexcept
+  {
+    static_assert(std::is_trivially_copyable_v<T>, "T must be trivially copyable.");
+    auto const& canonical_value = cuco::detail::canonicalize(value);
+    update(reinterpret_cast<std::byte const*>(&canonical_value), sizeof(T));
+  }
+
+  /**
+   * @brief Returns the hash value of the input appended so far, as a value of type
+   * `result_type`.
+   *
+   * @note The hasher is not modified, so the input can be further appended to afterwards.
+   *
+   * @return The resulting hash value
+   */
+  [[nodiscard]] constexpr result_type __host__ __device__ digest() const noexcept
+  {
+    std::uint32_t h1 = h1_;
+    //----------
+    // tail
+    std::uint32_t k1 = 0;
+    switch (buffer_size_) {
+      case 3: k1 ^= std::to_integer<std::uint32_t>(buffer_[2]) << 16; [[fallthrough]];
+      case 2: k1 ^= std::to_integer<std::uint32_t>(buffer_[1]) << 8; [[fallthrough]];
+      case 1:
+        k1 ^= std::to_integer<std::uint32_t>(buffer_[0]);
+        k1 *= c1;
+        k1 = rotl32(k1, 15);
+        k1 *= c2;
+        h1 ^= k1;
+    };
+    //----------
+    // finalization
+    h1 ^= static_cast<std::uint32_t>(total_size_);
+    return fmix32_(h1);
+  }
+
+ private:
+  constexpr __host__ __device__ void consume_block(std::uint32_t k1) noexcept
+  {
+    k1 *= c1;
+    k1 = rotl32(k1, 15);
+    k1 *= c2;
+    h1_ ^= k1;
+    h1_ = rotl32(h1_, 13);
+    h1_ = h1_ * 5 + 0xe6546b64;
+  }
+
+  constexpr __host__ __device__ std::uint32_t rotl32(std::uint32_t x, std::int8_t r) const noexcept
+  {
+    return (x << r) | (x >> (32 - r));
+  }
+
+  MurmurHash3_fmix32<std::uint32_t> fmix32_;
+  std::uint32_t h1_;
+  std::byte buffer_[block_size];
+  std::uint32_t buffer_size_;
+  std::uint64_t total_size_;
+};
+
+/**
+ * @brief A `MurmurHash3_x64_128` hash function to hash the given argument on host and device.
+ *
+ * Returns the two 64-bit halves `h1` and `h2` of the 128-bit hash in this order, which can serve
+ * as two hash values computed by a single call.
+ *
+ * MurmurHash3_x64_128 implementation from
+ * https://github.com/aappleby/smhasher/blob/master/src/MurmurHash3.cpp
+ * -----------------------------------------------------------------------------
+ * MurmurHash3 was written by Austin Appleby, and is placed in the public domain. The author
+ * hereby disclaims copyright to this source code.
+ *
+ * @tparam Key The type of the values to hash
+ */
+template <typename Key>
+struct MurmurHash3_x64_128 {
+  using argument_type = Key;  ///< The type of the values taken as argument
+  using result_type =
+    cuda::std::array<std::uint64_t, 2>;  ///< The type of the hash values produced
+
+  /**
+   * @brief Constructs a MurmurHash3_x64_128 hash function with the given `seed`.
+   *
+   * @note Seeds that fit in 32 bits produce the same hash values as the reference implementation.
+   *
+   * @param seed A custom number to randomize the resulting hash value
+   */
+  __host__ __device__ constexpr MurmurHash3_x64_128(std::uint64_t seed = 0)
+    : fmix64_{0}, seed_{seed}
+  {
+  }
+
+  /**
+   * @brief Returns a hash value for its argument, as a value of type `result_type`.
+   *
+   * @param key The input argument to hash
+   * @return The resulting hash value for `key`
+   */
+  constexpr result_type __host__ __device__ operator()(Key const& key) const noexcept
+  {
+    auto const& canonical_key = cuco::detail::canonicalize(key);
+    return compute_hash(reinterpret_cast<std::byte const*>(&canonical_key),
+                        cuco::experimental::extent<std::size_t, sizeof(Key)>{});
+  }
+
+  /**
+   * @brief Returns a hash value for its argument, as a value of type `result_type`.
+   *
+   * @tparam Extent The extent type
+   *
+   * @param bytes The input argument to hash
+   * @param size The extent of the data in bytes
+   * @return The resulting hash value
+   */
+  template <typename Extent>
+  constexpr result_type __host__ __device__ compute_hash(std::byte const* bytes,
+                                                         Extent size) const noexcept
+  {
+    auto const nblocks = size / 16;
+
+    std::uint64_t h1           = seed_;
+    std::uint64_t h2           = seed_;
+    constexpr std::uint64_t c1 = 0x87c37b91114253d5ull;
+    constexpr std::uint64_t c2 = 0x4cf5ad432745937full;
+    //----------
+    // body
+    for (std::remove_const_t<decltype(nblocks)> i = 0; size >= 16 && i < nblocks; i++) {
+      std::uint64_t k1 = load_chunk<std::uint64_t>(bytes, 2 * i);
+      std::uint64_t k2 = load_chunk<std::uint64_t>(bytes, 2 * i + 1);
+
+      k1 *= c1;
+      k1 = rotl64(k1, 31);
+      k1 *= c2;
+      h1 ^= k1;
+      h1 = rotl64(h1, 27);
+      h1 += h2;
+      h1 = h1 * 5 + 0x52dce729;
+
+      k2 *= c2;
+      k2 = rotl64(k2, 33);
+      k2 *= c1;
+      h2 ^= k2;
+      h2 = rotl64(h2, 31);
+      h2 += h1;
+      h2 = h2 * 5 + 0x38495ab5;
+    }
+    //----------
+    // tail
+    std::byte const* tail = bytes + nblocks * 16;
+    std::uint64_t k1      = 0;
+    std::uint64_t k2      = 0;
+    switch (size & 15) {
+      case 15: k2 ^= std::to_integer<std::uint64_t>(tail[14]) << 48; [[fallthrough]];
+      case 14: k2 ^= std::to_integer<std::uint64_t>(tail[13]) << 40; [[fallthrough]];
+      case 13: k2 ^= std::to_integer<std::uint64_t>(tail[12]) << 32; [[fallthrough]];
+      case 12: k2 ^= std::to_integer<std::uint64_t>(tail[11]) << 24; [[fallthrough]];
+      case 11: k2 ^= std::to_integer<std::uint64_t>(tail[10]) << 16; [[fallthrough]];
+      case 10: k2 ^= std::to_integer<std::uint64_t>(tail[9]) << 8; [[fallthrough]];
+      case 9:
+        k2 ^= std::to_integer<std::uint64_t>(tail[8]);
+        k2 *= c2;
+        k2 = rotl64(k2, 33);
+        k2 *= c1;
+        h2 ^= k2;
+        [[fallthrough]];
+      case 8: k1 ^= std::to_integer<std::uint64_t>(tail[7]) << 56; [[fallthrough]];
+      case 7: k1 ^= std::to_integer<std::uint64_t>(tail[6]) << 48; [[fallthrough]];
+      case 6: k1 ^= std::to_integer<std::uint64_t>(tail[5]) << 40; [[fallthrough]];
+      case 5: k1 ^= std::to_integer<std::uint64_t>(tail[4]) << 32; [[fallthrough]];
+      case 4: k1 ^= std::to_integer<std::uint64_t>(tail[3]) << 24; [[fallthrough]];
+      case 3: k1 ^= std::to_integer<std::uint64_t>(tail[2]) << 16; [[fallthrough]];
+      case 2: k1 ^= std::to_integer<std::uint64_t>(tail[1]) << 8; [[fallthrough]];
+      case 1:
+        k1 ^= std::to_integer<std::uint64_t>(tail[0]);
+        k1 *= c1;
+        k1 = rotl64(k1, 31);
+        k1 *= c2;
+        h1 ^= k1;
+    };
+    //----------
+    // finalization
+    h1 ^= size;
+    h2 ^= size;
+    h1 += h2;
+    h2 += h1;
+    h1 = fmix64_(h1);
+    h2 = fmix64_(h2);
+    h1 += h2;
+    h2 += h1;
+    return {h1, h2};
+  }
+
+ private:
+  constexpr __host__ __device__ std::uint64_t rotl64(std::uint64_t x, std::int8_t r) const noexcept
+  {
+    return (x << r) | (x >> (64 - r));
+  }
+
+  MurmurHash3_fmix64<std::uint64_t> fmix64_;
+  std::uint64_t seed_;
+};
 }  //  namespace cuco::detail
\ No newline at end of file
@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cuco/detail/canonicalize.cuh>
+#include <cuco/detail/hash_functions/utils.cuh>
+#include <cuco/extent.cuh>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace cuco::detail {
+
+/**
+ * @brief A `RapidHash_64` hash function to hash the given argument on host and device.
+ *
+ * rapidhash is the successor of wyhash: every 16 input bytes are mixed with a single 64x64->128-bit
+ * multiplication folded back into 64 bits, which maps onto `__umul64hi` on device. Inputs of up to
+ * 16 bytes are read with at most four overlapping loads and hashed with two multiplications.
+ *
+ * RapidHash_64 implementation from
+ * https://github.com/Nicoshev/rapidhash
+ * -----------------------------------------------------------------------------
+ * rapidhash - Very fast, high quality, platform-independent hashing algorithm.
+ * Copyright (C) 2024 Nicolas De Carli
+ *
+ * Based on 'wyhash', by Wang Yi <godspeed_china@yeah.net>
+ *
+ * BSD 2-Clause License (https://www.opensource.org/licenses/bsd-license.php)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above
+ *      copyright notice, this list of conditions and the following disclaimer
+ *      in the documentation and/or other materials provided with the
+ *      distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * You can contact the author at:
+ *   - rapidhash source repository: https://github.com/Nicoshev/rapidhash
+ *
+ * @tparam Key The type of the values to hash
+ */
+template <typename Key>
+struct RapidHash_64 {
+ private:
+  static constexpr std::uint64_t secret0 = 0x2d358dccaa6c78a5ull;
+  static constexpr std::uint64_t secret1 = 0x8bb84b93962eacc9ull;
+  static constexpr std::uint64_t secret2 = 0x4b33a62ed433d4a3ull;
+
+ public:
+  using argument_type = Key;            ///< The type of the values taken as argument
+  using result_type   = std::uint64_t;  ///< The type of the hash values produced
+
+  /**
+   * @brief Constructs a rapidhash hash function with the given `seed`.
+   *
+   * @param seed A custom number to randomize the resulting hash value
+   */
+  __host__ __device__ constexpr RapidHash_64(std::uint64_t seed = 0) : seed_{seed} {}
+
+  /**
+   * @brief Returns a hash value for its argument, as a value of type `result_type`.
+   *
+   * @param key The input argument to hash
+   * @return The resulting hash value for `key`
+   */
+  constexpr result_type __host__ __device__ operator()(Key const& key) const noexcept
+  {
+    auto const& canonical_key = cuco::detail::canonicalize(key);
+    return compute_hash(reinterpret_cast<std::byte const*>(&canonical_key),
+                        cuco::experimental::extent<std::size_t, sizeof(Key)>{});
+  }
+
+  /**
+   * @brief Returns a hash value for its argument, as a value of type `result_type`.
+   *
+   * @tparam Extent The extent type
+   *
+   * @param bytes The input argument to hash
+   * @param size The extent of the data in bytes
+   * @return The resulting hash value
+   */
+  template <typename Extent>
+  constexpr result_type __host__ __device__ compute_hash(std::byte const* bytes,
+                                                         Extent size) const noexcept
+  {
+    std::size_t const len = size;
+
+    std::uint64_t seed = seed_ ^ mix(seed_ ^ secret0, secret1) ^ len;
+    std::uint64_t a    = 0;
+    std::uint64_t b    = 0;
+
+    if (len <= 16) {
+      if (len >= 4) {
+        // up to four overlapping 4-byte loads cover the whole input
+        auto const last  = bytes + len - 4;
+        auto const delta = (len & 24) >> (len >> 3);
+        a                = (load32(bytes) << 32) | load32(last);
+        b                = (load32(bytes + delta) << 32) | load32(last - delta);
+      } else if (len > 0) {
+        a = (std::to_integer<std::uint64_t>(bytes[0]) << 56) |
+            (std::to_integer<std::uint64_t>(bytes[len >> 1]) << 32) |
+            std::to_integer<std::uint64_t>(bytes[len - 1]);
+      }
+    } else {
+      std::size_t remaining = len;
+      if (remaining > 48) {
+        // data can be processed in 48-byte chunks on three independent lanes
+        std::uint64_t see1 = seed;
+        std::uint64_t see2 = seed;
+        do {
+          seed = mix(load64(bytes) ^ secret0, load64(bytes + 8) ^ seed);
+          see1 = mix(load64(bytes + 16) ^ secret1, load64(bytes + 24) ^ see1);
+          see2 = mix(load64(bytes + 32) ^ secret2, load64(bytes + 40) ^ see2);
+          bytes += 48;
+          remaining -= 48;
+        } while (remaining >= 48);
+        seed ^= see1 ^ see2;
+      }
+      if (remaining > 16) {
+        seed = mix(load64(bytes) ^ secret2, load64(bytes + 8) ^ seed ^ secret1);
+        if (remaining > 32) { seed = mix(load64(bytes + 16) ^ secret2, load64(bytes + 24) ^ seed); }
+      }
+      a = load64(bytes + remaining - 16);
+      b = load64(bytes + remaining - 8);
+    }
+
+    a ^= secret1;
+    b ^= seed;
+    mul128(a, b, a, b);
+    return mix(a ^ secret0 ^ len, b ^ secret1);
+  }
+
+ private:
+  constexpr __host__ __device__ std::uint64_t mix(std::uint64_t lhs,
+                                                  std::uint64_t rhs) const noexcept
+  {
+    return mul128_fold64(lhs, rhs);
+  }
+
+  constexpr __host__ __device__ std::uint64_t load32(std::byte const* bytes) const noexcept
+  {
+    return load_chunk<std::uint32_t>(bytes, 0);
+  }
+
+  constexpr __host__ __device__ std::uint64_t load64(std::byte const* bytes) const noexcept
+  {
+    return load_chunk<std::uint64_t>(bytes, 0);
+  }
+
+  std::uint64_t seed_;
+};
+
+}  // namespace cuco::detail
@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cuco/detail/canonicalize.cuh>
+
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+
+namespace cuco::detail {
+
+/**
+ * @brief A 32-bit twisted tabulation hash function for keys of up to 8 bytes on host and device.
+ *
+ * The key is split into 4-bit characters, each of which selects a random 32-bit entry of its own
+ * table. The hash value is the XOR of the selected entries. Before the last character is looked
+ * up, it is "twisted", i.e., XORed with random 4-bit values selected by all other characters
+ * (Patrascu and Thorup, "Twisted Tabulation Hashing", SODA 2013).
+ *
+ * Unlike the other hash functions, the guarantees of tabulation hashing hold for any set of keys
+ * over the random choice of the tables: simple tabulation is 3-independent and, together with the
+ * twist, gives Chernoff-style concentration bounds, which makes it suited to cuckoo hashing and
+ * sketches.
+ *
+ * The tables are filled from the seed by `splitmix64` when the hash function is constructed, and
+ * are stored in the hash function object. With 4-bit characters they take 512 bytes for 4-byte
+ * keys and 1 KiB for 8-byte keys, small enough to stay L1-resident on host. On device, the
+ * containers copy the hash function into each thread, so the data-dependent table lookups go to
+ * local memory and are served by the L1 cache as long as the tables fit there.
+ *
+ * @note Construct the hash function once and copy it, e.g., on host before launching a kernel,
+ * since filling the tables costs a few hundred 64-bit multiplications.
+ *
+ * @throw Key type must be at most 8 bytes in size
+ *
+ * @tparam Key The type of the values to hash
+ */
+template <typename Key>
+struct TabulationHash {
+  static_assert(sizeof(Key) <= 8, "Key type must be at most 8 bytes in size.");
+
+  using argument_type = Key;            ///< The type of the values taken as argument
+  using result_type   = std::uint32_t;  ///< The type of the hash values produced
+
+  /**
+   * @brief Constructs a tabulation hash function, filling its tables from the given `seed`.
+   *
+   * @param seed A custom number to randomize the resulting hash value
+   */
+  __host__ __device__ constexpr TabulationHash(std::uint64_t seed = 0) : table_{}, twist_{}
+  {
+    for (std::size_t i = 0; i < num_chars; ++i) {
+      for (std::size_t c = 0; c < table_size; ++c) {
+        table_[i][c] = static_cast<result_type>(splitmix64(seed));
+      }
+    }
+    for (std::size_t i = 0; i < num_chars - 1; ++i) {
+      twist_[i] = splitmix64(seed);
+    }
+  }
+
+  /**
+   * @brief Returns a hash value for its argument, as a value of type `result_type`.
+   *
+   * @param key The input argument to hash
+   * @return A resulting hash value for `key`
+   */
+  constexpr result_type __host__ __device__ operator()(Key const& key) const noexcept
+  {
+    auto const& canonical_key = cuco::detail::canonicalize(key);
+    auto const bytes          = reinterpret_cast<std::byte const*>(&canonical_key);
+    std::uint64_t x           = 0;
+    for (std::size_t i = 0; i < sizeof(Key); ++i) {
+      x |= static_cast<std::uint64_t>(bytes[i]) << (CHAR_BIT * i);
+    }
+
+    result_type h       = 0;
+    std::uint64_t twist = 0;
+    for (std::size_t i = 0; i < num_chars - 1; ++i) {
+      auto const c = (x >> (char_bits * i)) & char_mask;
+      h ^= table_[i][c];
+      twist ^= twist_[i] >> (char_bits * c);
+    }
+    auto const last = ((x >> (char_bits * (num_chars - 1))) ^ twist) & char_mask;
+    return h ^ table_[num_chars - 1][last];
+  }
+
+ private:
+  static constexpr std::size_t char_bits  = 4;                     ///< Bits per character
+  static constexpr std::size_t char_mask  = (1 << char_bits) - 1;  ///< Character mask
+  static constexpr std::size_t table_size = 1 << char_bits;        ///< Entries per table
+  static constexpr std::size_t num_chars  = CHAR_BIT * sizeof(Key) / char_bits;  ///< Table count
+
+  /**
+   * @brief Advances the given `splitmix64` state and returns its next output.
+   *
+   * @param state Generator state
+   * @return Next pseudo-random value
+   */
+  __host__ __device__ static constexpr std::uint64_t splitmix64(std::uint64_t& state) noexcept
+  {
+    state += 0x9e3779b97f4a7c15ull;
+    auto z = state;
+    z      = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+    z      = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+    return z ^ (z >> 31);
+  }
+
+  result_type table_[num_chars][table_size];  ///< One table per character
+  /// The 4-bit twists selected by each character but the last, packed into one word per table
+  std::uint64_t twist_[num_chars - 1];
+};
+
+}  // namespace cuco::detail
@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cuco/pair.cuh>
+
+#include <thrust/tuple.h>
+
+#include <cstddef>
+#include <utility>
+
+namespace cuco::detail {
+
+/**
+ * @brief A hash function for tuples and pairs, hashing their elements in a single pass.
+ *
+ * The object representations of the elements are fed one after the other into a copy of the
+ * given incremental hasher. The resulting hash value is thus the hash value of the packed
+ * concatenation of the elements, independent of the padding of the tuple type, and no element is
+ * copied into an intermediate buffer.
+ *
+ * @tparam Hasher Incremental hash function type, e.g., `IncrementalXXHash_32`
+ */
+template <typename Hasher>
+struct TupleHash {
+  using result_type = typename Hasher::result_type;  ///< The type of the hash values produced
+
+  /**
+   * @brief Constructs a tuple hash function from the given incremental hasher.
+   *
+   * @param hasher Incremental hasher, copied for every hashed tuple
+   */
+  __host__ __device__ constexpr TupleHash(Hasher const& hasher = {}) : hasher_{hasher} {}
+
+  /**
+   * @brief Returns a hash value for the given `thrust::tuple`, as a value of type `result_type`.
+   *
+   * @tparam Tuple The type of the tuple to hash
+   *
+   * @param tuple The tuple to hash
+   * @return The resulting hash value for `tuple`
+   */
+  template <typename Tuple>
+  constexpr result_type __host__ __device__ operator()(Tuple const& tuple) const noexcept
+  {
+    return hash_elements(tuple, std::make_index_sequence<thrust::tuple_size<Tuple>::value>{});
+  }
+
+  /**
+   * @brief Returns a hash value for the given `cuco::pair`, as a value of type `result_type`.
+   *
+   * @tparam First The type of the first element of the pair
+   * @tparam Second The type of the second element of the pair
+   *
+   * @param pair The pair to hash
+   * @return The resulting hash value for `pair`
+   */
+  template <typename First, typename Second>
+  constexpr result_type __host__ __device__
+  operator()(cuco::pair<First, Second> const& pair) const noexcept
+  {
+    auto hasher = hasher_;
+    hasher.update(pair.first);
+    hasher.update(pair.second);
+    return hasher.digest();
+  }
+
+ private:
+  template <typename Tuple, std::size_t... Is>
+  constexpr result_type __host__ __device__ hash_elements(Tuple const& tuple,
+                                                          std::index_sequence<Is...>) const noexcept
+  {
+    auto hasher = hasher_;
+    (hasher.update(thrust::get<Is>(tuple)), ...);
+    return hasher.digest();
+  }
+
+  Hasher hasher_;
+};
+
+}  // namespace cuco::detail
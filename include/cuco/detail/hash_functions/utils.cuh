@@ -16,6 +16,9 @@
 
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+
 namespace cuco::detail {
 
 template <typename T, typename U, typename Extent>
@@ -27,4 +30,44 @@ constexpr __host__ __device__ T load_chunk(U const* const data, Extent index) no
   return chunk;
 }
 
+/**
+ * @brief Computes the full 128-bit product of two 64-bit unsigned integers.
+ *
+ * @param lhs Left-hand side of the multiplication
+ * @param rhs Right-hand side of the multiplication
+ * @param lo Low 64 bits of the product
+ * @param hi High 64 bits of the product
+ */
+constexpr __host__ __device__ void mul128(std::uint64_t lhs,
+                                          std::uint64_t rhs,
+                                          std::uint64_t& lo,
+                                          std::uint64_t& hi) noexcept
+{
+#if defined(__CUDA_ARCH__)
+  lo = lhs * rhs;
+  hi = __umul64hi(lhs, rhs);
+#else
+  auto const product = static_cast<unsigned __int128>(lhs) * rhs;
+  lo                 = static_cast<std::uint64_t>(product);
+  hi                 = static_cast<std::uint64_t>(product >> 64);
+#endif
+}
+
+/**
+ * @brief Folds the 128-bit product of two 64-bit unsigned integers into 64 bits by XOR-ing its
+ * low and high halves.
+ *
+ * @param lhs Left-hand side of the multiplication
+ * @param rhs Right-hand side of the multiplication
+ * @return The folded product
+ */
+constexpr __host__ __device__ std::uint64_t mul128_fold64(std::uint64_t lhs,
+                                                          std::uint64_t rhs) noexcept
+{
+  std::uint64_t lo = 0;
+  std::uint64_t hi = 0;
+  mul128(lhs, rhs, lo, hi);
+  return lo ^ hi;
+}
+
 };  // namespace cuco::detail
\ No newline at end of file
@@ -16,11 +16,15 @@
 
 #pragma once
 
+#include <cuco/detail/canonicalize.cuh>
 #include <cuco/detail/hash_functions/utils.cuh>
 #include <cuco/extent.cuh>
 
+#include <cuda/std/array>
+
 #include <cstddef>
 #include <cstdint>
+#include <type_traits>
 
 namespace cuco::detail {
 
@@ -89,7 +93,8 @@ struct XXHash_32 {
    */
   constexpr result_type __host__ __device__ operator()(Key const& key) const noexcept
   {
-    return compute_hash(reinterpret_cast<std::byte const*>(&key),
+    auto const& canonical_key = cuco::detail::canonicalize(key);
+    return compute_hash(reinterpret_cast<std::byte const*>(&canonical_key),
                         cuco::experimental::extent<std::size_t, sizeof(Key)>{});
   }
 
@@ -251,7 +256,8 @@ struct XXHash_64 {
    */
   constexpr result_type __host__ __device__ operator()(Key const& key) const noexcept
   {
-    return compute_hash(reinterpret_cast<std::byte const*>(&key),
+    auto const& canonical_key = cuco::detail::canonicalize(key);
+    return compute_hash(reinterpret_cast<std::byte const*>(&canonical_key),
                         cuco::experimental::extent<std::size_t, sizeof(Key)>{});
   }
 
@@ -378,4 +384,905 @@ struct XXHash_64 {
   std::uint64_t seed_;
 };
 
+/**
+ * @brief An incremental `XXHash_32` hash function to hash a sequence of inputs on host and
+ * device.
+ *
+ * Feeding the bytes of a key through any number of `update` calls yields the same hash value as
+ * `XXHash_32::compute_hash` on the concatenation of these bytes, without materializing it. This
+ * allows hashing composite keys field by field, e.g., the columns of a row or a key and a salt.
+ *
+ * @note Inputs are consumed in 16-byte stripes. Up to 15 trailing bytes are buffered by the hasher
+ * until the next `update` or `digest` call.
+ */
+class IncrementalXXHash_32 {
+ private:
+  static constexpr std::uint32_t prime1 = 0x9e3779b1u;
+  static constexpr std::uint32_t prime2 = 0x85ebca77u;
+  static constexpr std::uint32_t prime3 = 0xc2b2ae3du;
+  static constexpr std::uint32_t prime4 = 0x27d4eb2fu;
+  static constexpr std::uint32_t prime5 = 0x165667b1u;
+
+  static constexpr std::uint32_t stripe_size = 16;
+
+ public:
+  using result_type = std::uint32_t;  ///< The type of the hash values produced
+
+  /**
+   * @brief Constructs an incremental XXH32 hash function with the given `seed`.
+   *
+   * @param seed A custom number to randomize the resulting hash value
+   */
+  __host__ __device__ constexpr IncrementalXXHash_32(std::uint32_t seed = 0)
+    : v1_{seed + prime1 + prime2},
+      v2_{seed + prime2},
+      v3_{seed},
+      v4_{seed - prime1},
+      buffer_{},
+      buffer_size_{0},
+      total_size_{0},
+      seed_{seed}
+  {
+  }
+
+  /**
+   * @brief Appends the given bytes to the input.
+   *
+   * @param bytes The bytes to append
+   * @param size The number of bytes to append
+   */
+  constexpr void __host__ __device__ update(std::byte const* bytes, std::size_t size) noexcept
+  {
+    total_size_ += size;
+
+    std::size_t offset = 0;
+    if (buffer_size_ > 0) {
+      for (; buffer_size_ < stripe_size and offset < size; ++offset) {
+        buffer_[buffer_size_++] = bytes[offset];
+      }
+      if (buffer_size_ < stripe_size) { return; }
+      consume_stripe(buffer_);
+      buffer_size_ = 0;
+    }
+    for (; offset + stripe_size <= size; offset += stripe_size) {
+      consume_stripe(bytes + offset);
+    }
+    for (; offset < size; ++offset) {
+      buffer_[buffer_size_++] = bytes[offset];
+    }
+  }
+
+  /**
+   * @brief Appends the object representation of `value` to the input.
+   *
+   * `float` and `double` values are canonicalized first, see `cuco::detail::canonicalize`.
+   *
+   * @tparam T The type of the value to append
+   *
+   * @param value The value to append
+   */
+  template <typename T>
+  constexpr void __host__ __device__ update(T const& value) noexcept
+  {
+    static_assert(std::is_trivially_copyable_v<T>, "T must be trivially copyable.");
+    auto const& canonical_value = cuco::detail::canonicalize(value);
+    update(reinterpret_cast<std::byte const*>(&canonical_value), sizeof(T));
+  }
+
+  /**
+   * @brief Returns the hash value of the input appended so far, as a value of type
+   * `result_type`.
+   *
+   * @note The hasher is not modified, so the input can be further appended to afterwards.
+   *
+   * @return The resulting hash value
+   */
+  [[nodiscard]] constexpr result_type __host__ __device__ digest() const noexcept
+  {
+    std::uint32_t h32 = total_size_ >= stripe_size
+                          ? rotl(v1_, 1) + rotl(v2_, 7) + rotl(v3_, 12) + rotl(v4_, 18)
+                          : seed_ + prime5;
+    h32 += static_cast<std::uint32_t>(total_size_);
+
+    std::uint32_t offset = 0;
+    for (; offset + 4 <= buffer_size_; offset += 4) {
+      h32 += load_chunk<std::uint32_t>(buffer_, offset / 4) * prime3;
+      h32 = rotl(h32, 17) * prime4;
+    }
+    for (; offset < buffer_size_; ++offset) {
+      h32 += (std::to_integer<std::uint32_t>(buffer_[offset]) & 255) * prime5;
+      h32 = rotl(h32, 11) * prime1;
+    }
+
+    return finalize(h32);
+  }
+
+ private:
+  constexpr __host__ __device__ void consume_stripe(std::byte const* bytes) noexcept
+  {
+    v1_ = round(v1_, load_chunk<std::uint32_t>(bytes, 0));
+    v2_ = round(v2_, load_chunk<std::uint32_t>(bytes, 1));
+    v3_ = round(v3_, load_chunk<std::uint32_t>(bytes, 2));
+    v4_ = round(v4_, load_chunk<std::uint32_t>(bytes, 3));
+  }
+
+  constexpr __host__ __device__ std::uint32_t round(std::uint32_t acc,
+                                                    std::uint32_t input) const noexcept
+  {
+    return rotl(acc + input * prime2, 13) * prime1;
+  }
+
+  constexpr __host__ __device__ std::uint32_t rotl(std::uint32_t h, std::int8_t r) const noexcept
+  {
+    return ((h << r) | (h >> (32 - r)));
+  }
+
+  // avalanche helper
+  constexpr __host__ __device__ std::uint32_t finalize(std::uint32_t h) const noexcept
+  {
+    h ^= h >> 15;
+    h *= prime2;
+    h ^= h >> 13;
+    h *= prime3;
+    h ^= h >> 16;
+    return h;
+  }
+
+  std::uint32_t v1_;
+  std::uint32_t v2_;
+  std::uint32_t v3_;
+  std::uint32_t v4_;
+  std::byte buffer_[stripe_size];
+  std::uint32_t buffer_size_;
+  std::uint64_t total_size_;
+  std::uint32_t seed_;
+};
+
+/**
+ * @brief An incremental `XXHash_64` hash function to hash a sequence of inputs on host and
+ * device.
+ *
+ * Feeding the bytes of a key through any number of `update` calls yields the same hash value as
+ * `XXHash_64::compute_hash` on the concatenation of these bytes, without materializing it.
+ *
+ * @note Inputs are consumed in 32-byte stripes. Up to 31 trailing bytes are buffered by the hasher
+ * until the next `update` or `digest` call.
+ */
+class IncrementalXXHash_64 {
+ private:
+  static constexpr std::uint64_t prime1 = 11400714785074694791ull;
+  static constexpr std::uint64_t prime2 = 14029467366897019727ull;
+  static constexpr std::uint64_t prime3 = 1609587929392839161ull;
+  static constexpr std::uint64_t prime4 = 9650029242287828579ull;
+  static constexpr std::uint64_t prime5 = 2870177450012600261ull;
+
+  static constexpr std::uint32_t stripe_size = 32;
+
+ public:
+  using result_type = std::uint64_t;  ///< The type of the hash values produced
+
+  /**
+   * @brief Constructs an incremental XXH64 hash function with the given `seed`.
+   *
+   * @param seed A custom number to randomize the resulting hash value
+   */
+  __host__ __device__ constexpr IncrementalXXHash_64(std::uint64_t seed = 0)
+    : v1_{seed + prime1 + prime2},
+      v2_{seed + prime2},
+      v3_{seed},
+      v4_{seed - prime1},
+      buffer_{},
+      buffer_size_{0},
+      total_size_{0},
+      seed_{seed}
+  {
+  }
+
+  /**
+   * @brief Appends the given bytes to the input.
+   *
+   * @param bytes The bytes to append
+   * @param size The number of bytes to append
+   */
+  constexpr void __host__ __device__ update(std::byte const* bytes, std::size_t size) noexcept
+  {
+    total_size_ += size;
+
+    std::size_t offset = 0;
+    if (buffer_size_ > 0) {
+      for (; buffer_size_ < stripe_size and offset < size; ++offset) {
+        buffer_[buffer_size_++] = bytes[offset];
+      }
+      if (buffer_size_ < stripe_size) { return; }
+      consume_stripe(buffer_);
+      buffer_size_ = 0;
+    }
+    for (; offset + stripe_size <= size; offset += stripe_size) {
+      consume_stripe(bytes + offset);
+    }
+    for (; offset < size; ++offset) {
+      buffer_[buffer_size_++] = bytes[offset];
+    }
+  }
+
+  /**
+   * @brief Appends the object representation of `value` to the input.
+   *
+   * `float` and `double` values are canonicalized first, see `cuco::detail::canonicalize`.
+   *
+   * @tparam T The type of the value to append
+   *
+   * @param value The value to append
+   */
+  template <typename T>
+  constexpr void __host__ __device__ update(T const& value) noexcept
+  {
+    static_assert(std::is_trivially_copyable_v<T>, "T must be trivially copyable.");
+    auto const& canonical_value = cuco::detail::canonicalize(value);
+    update(reinterpret_cast<std::byte const*>(&canonical_value), sizeof(T));
+  }
+
+  /**
+   * @brief Returns the hash value of the input appended so far, as a value of type
+   * `result_type`.
+   *
+   * @note The hasher is not modified, so the input can be further appended to afterwards.
+   *
+   * @return The resulting hash value
+   */
+  [[nodiscard]] constexpr result_type __host__ __device__ digest() const noexcept
+  {
+    std::uint64_t h64 = seed_ + prime5;
+    if (total_size_ >= stripe_size) {
+      h64 = rotl(v1_, 1) + rotl(v2_, 7) + rotl(v3_, 12) + rotl(v4_, 18);
+      h64 = merge_round(h64, v1_);
+      h64 = merge_round(h64, v2_);
+      h64 = merge_round(h64, v3_);
+      h64 = merge_round(h64, v4_);
+    }
+    h64 += total_size_;
+
+    std::uint32_t offset = 0;
+    for (; offset + 8 <= buffer_size_; offset += 8) {
+      h64 ^= round(0, load_chunk<std::uint64_t>(buffer_, offset / 8));
+      h64 = rotl(h64, 27) * prime1 + prime4;
+    }
+    for (; offset + 4 <= buffer_size_; offset += 4) {
+      h64 ^= (load_chunk<std::uint32_t>(buffer_, offset / 4) & 0xffffffffull) * prime1;
+      h64 = rotl(h64, 23) * prime2 + prime3;
+    }
+    for (; offset < buffer_size_; ++offset) {
+      h64 ^= (std::to_integer<std::uint32_t>(buffer_[offset]) & 0xff) * prime5;
+      h64 = rotl(h64, 11) * prime1;
+    }
+
+    return finalize(h64);
+  }
+
+ private:
+  constexpr __host__ __device__ void consume_stripe(std::byte const* bytes) noexcept
+  {
+    v1_ = round(v1_, load_chunk<std::uint64_t>(bytes, 0));
+    v2_ = round(v2_, load_chunk<std::uint64_t>(bytes, 1));
+    v3_ = round(v3_, load_chunk<std::uint64_t>(bytes, 2));
+    v4_ = round(v4_, load_chunk<std::uint64_t>(bytes, 3));
+  }
+
+  constexpr __host__ __device__ std::uint64_t round(std::uint64_t acc,
+                                                    std::uint64_t input) const noexcept
+  {
+    return rotl(acc + input * prime2, 31) * prime1;
+  }
+
+  constexpr __host__ __device__ std::uint64_t merge_round(std::uint64_t h,
+                                                          std::uint64_t acc) const noexcept
+  {
+    return (h ^ round(0, acc)) * prime1 + prime4;
+  }
+
+  constexpr __host__ __device__ std::uint64_t rotl(std::uint64_t h, std::int8_t r) const noexcept
+  {
+    return ((h << r) | (h >> (64 - r)));
+  }
+
+  // avalanche helper
+  constexpr __host__ __device__ std::uint64_t finalize(std::uint64_t h) const noexcept
+  {
+    h ^= h >> 33;
+    h *= prime2;
+    h ^= h >> 29;
+    h *= prime3;
+    h ^= h >> 32;
+    return h;
+  }
+
+  std::uint64_t v1_;
+  std::uint64_t v2_;
+  std::uint64_t v3_;
+  std::uint64_t v4_;
+  std::byte buffer_[stripe_size];
+  std::uint32_t buffer_size_;
+  std::uint64_t total_size_;
+  std::uint64_t seed_;
+};
+
+/**
+ * @brief Secret, constants and mixing steps shared by the `XXH3` family of hash functions.
+ *
+ * Inputs longer than 240 bytes are hashed by the striped accumulator loop with a secret derived
+ * from the seed, from which the 64 and 128-bit variants merge one and two results respectively.
+ */
+class XXHash3_base {
+ protected:
+  static constexpr std::uint32_t prime32_1 = 0x9e3779b1u;
+  static constexpr std::uint32_t prime32_2 = 0x85ebca77u;
+  static constexpr std::uint32_t prime32_3 = 0xc2b2ae3du;
+  static constexpr std::uint64_t prime64_1 = 11400714785074694791ull;
+  static constexpr std::uint64_t prime64_2 = 14029467366897019727ull;
+  static constexpr std::uint64_t prime64_3 = 1609587929392839161ull;
+  static constexpr std::uint64_t prime64_4 = 9650029242287828579ull;
+  static constexpr std::uint64_t prime64_5 = 2870177450012600261ull;
+  static constexpr std::uint64_t prime_mx1 = 0x165667919e3779f9ull;
+  static constexpr std::uint64_t prime_mx2 = 0x9fb21c651e98df25ull;
+
+  static constexpr std::size_t secret_size  = 192;  // size of the default secret in bytes
+  static constexpr std::size_t stripe_len   = 64;   // input bytes per stripe of the long path
+  static constexpr std::size_t consume_rate = 8;    // secret bytes consumed per stripe
+  static constexpr std::size_t midsize_max  = 240;  // longest input of the mid-size paths
+
+  __host__ __device__ constexpr XXHash3_base(std::uint64_t seed) : seed_{seed} {}
+
+  // runs the accumulator loop of the long path over `bytes`, deriving `secret` from the seed
+  constexpr __host__ __device__ void accumulate_long(std::byte const* bytes,
+                                                     std::size_t len,
+                                                     std::byte* secret,
+                                                     std::uint64_t* acc) const noexcept
+  {
+    // custom secret derived from the seed, identical to the default secret for a zero seed
+    for (std::size_t i = 0; i < secret_size / 16; ++i) {
+      auto const lo = load_secret<std::uint64_t>(16 * i) + seed_;
+      auto const hi = load_secret<std::uint64_t>(16 * i + 8) - seed_;
+      memcpy(secret + 16 * i, &lo, sizeof(lo));
+      memcpy(secret + 16 * i + 8, &hi, sizeof(hi));
+    }
+
+    std::uint64_t const init[8] = {
+      prime32_3, prime64_1, prime64_2, prime64_3, prime64_4, prime32_2, prime64_5, prime32_1};
+    for (std::size_t lane = 0; lane < 8; ++lane) {
+      acc[lane] = init[lane];
+    }
+
+    constexpr std::size_t stripes_per_block = (secret_size - stripe_len) / consume_rate;
+    constexpr std::size_t block_len         = stripe_len * stripes_per_block;
+    auto const num_blocks                   = (len - 1) / block_len;
+
+    for (std::size_t n = 0; n < num_blocks; ++n) {
+      accumulate(acc, bytes + n * block_len, secret, stripes_per_block);
+      scramble(acc, secret + secret_size - stripe_len);
+    }
+
+    // last partial block and last stripe, which uses the secret at an offset not aligned on 8
+    auto const num_stripes = ((len - 1) - block_len * num_blocks) / stripe_len;
+    accumulate(acc, bytes + num_blocks * block_len, secret, num_stripes);
+    accumulate_512(acc, bytes + len - stripe_len, secret + secret_size - stripe_len - 7);
+  }
+
+  // merges the accumulators of the long path into 64 bits
+  constexpr __host__ __device__ std::uint64_t merge_accs(std::uint64_t const* acc,
+                                                         std::byte const* secret,
+                                                         std::uint64_t start) const noexcept
+  {
+    for (std::size_t i = 0; i < 4; ++i) {
+      start += mul128_fold64(acc[2 * i] ^ load_chunk<std::uint64_t>(secret + 16 * i, 0),
+                             acc[2 * i + 1] ^ load_chunk<std::uint64_t>(secret + 16 * i + 8, 0));
+    }
+    return avalanche(start);
+  }
+
+  // mixes 16 input bytes with 16 bytes at byte `offset` of the default secret
+  constexpr __host__ __device__ std::uint64_t mix16(std::byte const* bytes,
+                                                    std::size_t offset,
+                                                    std::uint64_t seed) const noexcept
+  {
+    return mul128_fold64(
+      load_chunk<std::uint64_t>(bytes, 0) ^ (load_secret<std::uint64_t>(offset) + seed),
+      load_chunk<std::uint64_t>(bytes, 1) ^ (load_secret<std::uint64_t>(offset + 8) - seed));
+  }
+
+  // reads a `T` at byte `offset` of the default secret
+  template <typename T>
+  constexpr __host__ __device__ T load_secret(std::size_t offset) const noexcept
+  {
+    constexpr std::uint8_t secret[secret_size] = {
+      0xb8, 0xfe, 0x6c, 0x39, 0x23, 0xa4, 0x4b, 0xbe, 0x7c, 0x01, 0x81, 0x2c, 0xf7, 0x21, 0xad,
+      0x1c, 0xde, 0xd4, 0x6d, 0xe9, 0x83, 0x90, 0x97, 0xdb, 0x72, 0x40, 0xa4, 0xa4, 0xb7, 0xb3,
+      0x67, 0x1f, 0xcb, 0x79, 0xe6, 0x4e, 0xcc, 0xc0, 0xe5, 0x78, 0x82, 0x5a, 0xd0, 0x7d, 0xcc,
+      0xff, 0x72, 0x21, 0xb8, 0x08, 0x46, 0x74, 0xf7, 0x43, 0x24, 0x8e, 0xe0, 0x35, 0x90, 0xe6,
+      0x81, 0x3a, 0x26, 0x4c, 0x3c, 0x28, 0x52, 0xbb, 0x91, 0xc3, 0x00, 0xcb, 0x88, 0xd0, 0x65,
+      0x8b, 0x1b, 0x53, 0x2e, 0xa3, 0x71, 0x64, 0x48, 0x97, 0xa2, 0x0d, 0xf9, 0x4e, 0x38, 0x19,
+      0xef, 0x46, 0xa9, 0xde, 0xac, 0xd8, 0xa8, 0xfa, 0x76, 0x3f, 0xe3, 0x9c, 0x34, 0x3f, 0xf9,
+      0xdc, 0xbb, 0xc7, 0xc7, 0x0b, 0x4f, 0x1d, 0x8a, 0x51, 0xe0, 0x4b, 0xcd, 0xb4, 0x59, 0x31,
+      0xc8, 0x9f, 0x7e, 0xc9, 0xd9, 0x78, 0x73, 0x64, 0xea, 0xc5, 0xac, 0x83, 0x34, 0xd3, 0xeb,
+      0xc3, 0xc5, 0x81, 0xa0, 0xff, 0xfa, 0x13, 0x63, 0xeb, 0x17, 0x0d, 0xdd, 0x51, 0xb7, 0xf0,
+      0xda, 0x49, 0xd3, 0x16, 0x55, 0x26, 0x29, 0xd4, 0x68, 0x9e, 0x2b, 0x16, 0xbe, 0x58, 0x7d,
+      0x47, 0xa1, 0xfc, 0x8f, 0xf8, 0xb8, 0xd1, 0x7a, 0xd0, 0x31, 0xce, 0x45, 0xcb, 0x3a, 0x8f,
+      0x95, 0x16, 0x04, 0x28, 0xaf, 0xd7, 0xfb, 0xca, 0xbb, 0x4b, 0x40, 0x7e};
+    return load_chunk<T>(secret + offset, 0);
+  }
+
+  constexpr __host__ __device__ std::uint32_t swap32(std::uint32_t x) const noexcept
+  {
+    return ((x << 24) & 0xff000000u) | ((x << 8) & 0x00ff0000u) | ((x >> 8) & 0x0000ff00u) |
+           ((x >> 24) & 0x000000ffu);
+  }
+
+  constexpr __host__ __device__ std::uint64_t swap64(std::uint64_t x) const noexcept
+  {
+    return (static_cast<std::uint64_t>(swap32(static_cast<std::uint32_t>(x))) << 32) |
+           swap32(static_cast<std::uint32_t>(x >> 32));
+  }
+
+  // avalanche helper
+  constexpr __host__ __device__ std::uint64_t avalanche(std::uint64_t h) const noexcept
+  {
+    h ^= h >> 37;
+    h *= prime_mx1;
+    h ^= h >> 32;
+    return h;
+  }
+
+  // XXH64 avalanche helper of the shortest inputs
+  constexpr __host__ __device__ std::uint64_t finalize(std::uint64_t h) const noexcept
+  {
+    h ^= h >> 33;
+    h *= prime64_2;
+    h ^= h >> 29;
+    h *= prime64_3;
+    h ^= h >> 32;
+    return h;
+  }
+
+  std::uint64_t seed_;
+
+ private:
+  constexpr __host__ __device__ void accumulate(std::uint64_t* acc,
+                                                std::byte const* bytes,
+                                                std::byte const* secret,
+                                                std::size_t num_stripes) const noexcept
+  {
+    for (std::size_t n = 0; n < num_stripes; ++n) {
+      accumulate_512(acc, bytes + n * stripe_len, secret + n * consume_rate);
+    }
+  }
+
+  constexpr __host__ __device__ void accumulate_512(std::uint64_t* acc,
+                                                    std::byte const* bytes,
+                                                    std::byte const* secret) const noexcept
+  {
+    for (std::size_t lane = 0; lane < 8; ++lane) {
+      auto const data_val = load_chunk<std::uint64_t>(bytes, lane);
+      auto const data_key = data_val ^ load_chunk<std::uint64_t>(secret, lane);
+      acc[lane ^ 1] += data_val;
+      acc[lane] += (data_key & 0xffffffffull) * (data_key >> 32);
+    }
+  }
+
+  constexpr __host__ __device__ void scramble(std::uint64_t* acc,
+                                              std::byte const* secret) const noexcept
+  {
+    for (std::size_t lane = 0; lane < 8; ++lane) {
+      auto h = acc[lane];
+      h ^= h >> 47;
+      h ^= load_chunk<std::uint64_t>(secret, lane);
+      h *= prime32_1;
+      acc[lane] = h;
+    }
+  }
+};
+
+/**
+ * @brief A `XXHash3_64` hash function to hash the given argument on host and device.
+ *
+ * Inputs of up to 16 bytes, i.e., most hash table keys, are hashed by dedicated paths of a couple
+ * of multiplications each, which makes `XXH3_64bits` substantially cheaper than `XXH64` for small
+ * keys. Longer inputs are hashed with the mum-hash style mid-size paths up to 240 bytes and the
+ * striped accumulator loop beyond.
+ *
+ * XXHash3_64 implementation from
+ * https://github.com/Cyan4973/xxHash
+ * -----------------------------------------------------------------------------
+ * xxHash - Extremely Fast Hash algorithm
+ * Header File
+ * Copyright (C) 2012-2021 Yann Collet
+ *
+ * BSD 2-Clause License (https://www.opensource.org/licenses/bsd-license.php)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above
+ *      copyright notice, this list of conditions and the following disclaimer
+ *      in the documentation and/or other materials provided with the
+ *      distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * You can contact the author at:
+ *   - xxHash homepage: https://www.xxhash.com
+ *   - xxHash source repository: https://github.com/Cyan4973/xxHash
+ *
+ * @tparam Key The type of the values to hash
+ */
+template <typename Key>
+struct XXHash3_64 : private XXHash3_base {
+  using argument_type = Key;            ///< The type of the values taken as argument
+  using result_type   = std::uint64_t;  ///< The type of the hash values produced
+
+  /**
+   * @brief Constructs a XXH3_64 hash function with the given `seed`.
+   *
+   * @param seed A custom number to randomize the resulting hash value
+   */
+  __host__ __device__ constexpr XXHash3_64(std::uint64_t seed = 0) : XXHash3_base{seed} {}
+
+  /**
+   * @brief Returns a hash value for its argument, as a value of type `result_type`.
+   *
+   * @param key The input argument to hash
+   * @return The resulting hash value for `key`
+   */
+  constexpr result_type __host__ __device__ operator()(Key const& key) const noexcept
+  {
+    auto const& canonical_key = cuco::detail::canonicalize(key);
+    return compute_hash(reinterpret_cast<std::byte const*>(&canonical_key),
+                        cuco::experimental::extent<std::size_t, sizeof(Key)>{});
+  }
+
+  /**
+   * @brief Returns a hash value for its argument, as a value of type `result_type`.
+   *
+   * @tparam Extent The extent type
+   *
+   * @param bytes The input argument to hash
+   * @param size The extent of the data in bytes
+   * @return The resulting hash value
+   */
+  template <typename Extent>
+  constexpr result_type __host__ __device__ compute_hash(std::byte const* bytes,
+                                                         Extent size) const noexcept
+  {
+    std::size_t const len = size;
+
+    if (len <= 16) { return hash_0to16(bytes, len); }
+    if (len <= 128) { return hash_17to128(bytes, len); }
+    if (len <= midsize_max) { return hash_129to240(bytes, len); }
+    return hash_long(bytes, len);
+  }
+
+ private:
+  constexpr __host__ __device__ std::uint64_t hash_0to16(std::byte const* bytes,
+                                                         std::size_t len) const noexcept
+  {
+    if (len > 8) {
+      auto const bitflip1 =
+        (load_secret<std::uint64_t>(24) ^ load_secret<std::uint64_t>(32)) + seed_;
+      auto const bitflip2 =
+        (load_secret<std::uint64_t>(40) ^ load_secret<std::uint64_t>(48)) - seed_;
+
+      auto const input_lo = load_chunk<std::uint64_t>(bytes, 0) ^ bitflip1;
+      auto const input_hi = load_chunk<std::uint64_t>(bytes + len - 8, 0) ^ bitflip2;
+      auto const acc      = len + swap64(input_lo) + input_hi + mul128_fold64(input_lo, input_hi);
+      return avalanche(acc);
+    }
+    if (len >= 4) {
+      auto const seed =
+        seed_ ^ (static_cast<std::uint64_t>(swap32(static_cast<std::uint32_t>(seed_))) << 32);
+
+      auto const input1  = load_chunk<std::uint32_t>(bytes, 0);
+      auto const input2  = load_chunk<std::uint32_t>(bytes + len - 4, 0);
+      auto const bitflip = (load_secret<std::uint64_t>(8) ^ load_secret<std::uint64_t>(16)) - seed;
+      auto const input64 = input2 + (static_cast<std::uint64_t>(input1) << 32);
+      return rrmxmx(input64 ^ bitflip, len);
+    }
+    if (len > 0) {
+      auto const c1       = std::to_integer<std::uint32_t>(bytes[0]);
+      auto const c2       = std::to_integer<std::uint32_t>(bytes[len >> 1]);
+      auto const c3       = std::to_integer<std::uint32_t>(bytes[len - 1]);
+      auto const combined = (c1 << 16) | (c2 << 24) | c3 | (static_cast<std::uint32_t>(len) << 8);
+
+      auto const bitflip =
+        static_cast<std::uint64_t>(load_secret<std::uint32_t>(0) ^ load_secret<std::uint32_t>(4)) +
+        seed_;
+      return finalize(combined ^ bitflip);
+    }
+    return finalize(seed_ ^ (load_secret<std::uint64_t>(56) ^ load_secret<std::uint64_t>(64)));
+  }
+
+  constexpr __host__ __device__ std::uint64_t hash_17to128(std::byte const* bytes,
+                                                           std::size_t len) const noexcept
+  {
+    std::uint64_t acc = len * prime64_1;
+    if (len > 32) {
+      if (len > 64) {
+        if (len > 96) {
+          acc += mix16(bytes + 48, 96, seed_);
+          acc += mix16(bytes + len - 64, 112, seed_);
+        }
+        acc += mix16(bytes + 32, 64, seed_);
+        acc += mix16(bytes + len - 48, 80, seed_);
+      }
+      acc += mix16(bytes + 16, 32, seed_);
+      acc += mix16(bytes + len - 32, 48, seed_);
+    }
+    acc += mix16(bytes, 0, seed_);
+    acc += mix16(bytes + len - 16, 16, seed_);
+    return avalanche(acc);
+  }
+
+  constexpr __host__ __device__ std::uint64_t hash_129to240(std::byte const* bytes,
+                                                            std::size_t len) const noexcept
+  {
+    std::uint64_t acc = len * prime64_1;
+    for (std::size_t i = 0; i < 8; ++i) {
+      acc += mix16(bytes + 16 * i, 16 * i, seed_);
+    }
+    acc = avalanche(acc);
+
+    // the last 16 bytes use the secret at offset 136 - 17
+    std::uint64_t acc_end = mix16(bytes + len - 16, 119, seed_);
+    for (std::size_t i = 8; i < len / 16; ++i) {
+      acc_end += mix16(bytes + 16 * i, 16 * (i - 8) + 3, seed_);
+    }
+    return avalanche(acc + acc_end);
+  }
+
+  constexpr __host__ __device__ std::uint64_t hash_long(std::byte const* bytes,
+                                                        std::size_t len) const noexcept
+  {
+    std::byte secret[secret_size]{};
+    std::uint64_t acc[8]{};
+    accumulate_long(bytes, len, secret, acc);
+
+    // merge the accumulators, with the secret at an offset not aligned on 8
+    return merge_accs(acc, secret + 11, len * prime64_1);
+  }
+
+  // avalanche helper of the 4 to 8-byte path
+  constexpr __host__ __device__ std::uint64_t rrmxmx(std::uint64_t h,
+                                                     std::uint64_t len) const noexcept
+  {
+    h ^= ((h << 49) | (h >> 15)) ^ ((h << 24) | (h >> 40));
+    h *= prime_mx2;
+    h ^= (h >> 35) + len;
+    h *= prime_mx2;
+    h ^= h >> 28;
+    return h;
+  }
+};
+
+/**
+ * @brief A `XXHash3_128` hash function to hash the given argument on host and device.
+ *
+ * The 128-bit variant of `XXH3`, returning the low and high 64 bits of the hash in this order.
+ * The two halves are independent enough to serve as two hash values, e.g., a home bucket and a
+ * fingerprint, or the initial slot and the step size of double hashing.
+ *
+ * XXHash3_128 implementation from
+ * https://github.com/Cyan4973/xxHash
+ * -----------------------------------------------------------------------------
+ * xxHash - Extremely Fast Hash algorithm
+ * Header File
+ * Copyright (C) 2012-2021 Yann Collet
+ *
+ * BSD 2-Clause License (https://www.opensource.org/licenses/bsd-license.php)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above
+ *      copyright notice, this list of conditions and the following disclaimer
+ *      in the documentation and/or other materials provided with the
+ *      distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * You can contact the author at:
+ *   - xxHash homepage: https://www.xxhash.com
+ *   - xxHash source repository: https://github.com/Cyan4973/xxHash
+ *
+ * @tparam Key The type of the values to hash
+ */
+template <typename Key>
+struct XXHash3_128 : private XXHash3_base {
+  using argument_type = Key;  ///< The type of the values taken as argument
+  using result_type =
+    cuda::std::array<std::uint64_t, 2>;  ///< The type of the hash values produced
+
+  /**
+   * @brief Constructs a XXH3_128 hash function with the given `seed`.
+   *
+   * @param seed A custom number to randomize the resulting hash value
+   */
+  __host__ __device__ constexpr XXHash3_128(std::uint64_t seed = 0) : XXHash3_base{seed} {}
+
+  /**
+   * @brief Returns a hash value for its argument, as a value of type `result_type`.
+   *
+   * @param key The input argument to hash
+   * @return The resulting hash value for `key`
+   */
+  constexpr result_type __host__ __device__ operator()(Key const& key) const noexcept
+  {
+    auto const& canonical_key = cuco::detail::canonicalize(key);
+    return compute_hash(reinterpret_cast<std::byte const*>(&canonical_key),
+                        cuco::experimental::extent<std::size_t, sizeof(Key)>{});
+  }
+
+  /**
+   * @brief Returns a hash value for its argument, as a value of type `result_type`.
+   *
+   * @tparam Extent The extent type
+   *
+   * @param bytes The input argument to hash
+   * @param size The extent of the data in bytes
+   * @return The resulting hash value
+   */
+  template <typename Extent>
+  constexpr result_type __host__ __device__ compute_hash(std::byte const* bytes,
+                                                         Extent size) const noexcept
+  {
+    std::size_t const len = size;
+
+    if (len <= 16) { return hash_0to16(bytes, len); }
+    if (len <= midsize_max) { return hash_17to240(bytes, len); }
+    return hash_long(bytes, len);
+  }
+
+ private:
+  constexpr __host__ __device__ result_type hash_0to16(std::byte const* bytes,
+                                                       std::size_t len) const noexcept
+  {
+    std::uint64_t lo = 0;
+    std::uint64_t hi = 0;
+    if (len > 8) {
+      auto const bitflip_lo =
+        (load_secret<std::uint64_t>(32) ^ load_secret<std::uint64_t>(40)) - seed_;
+      auto const bitflip_hi =
+        (load_secret<std::uint64_t>(48) ^ load_secret<std::uint64_t>(56)) + seed_;
+
+      auto const input_lo = load_chunk<std::uint64_t>(bytes, 0);
+      auto const input_hi = load_chunk<std::uint64_t>(bytes + len - 8, 0);
+      mul128(input_lo ^ input_hi ^ bitflip_lo, prime64_1, lo, hi);
+      lo += static_cast<std::uint64_t>(len - 1) << 54;
+
+      auto const keyed_hi = input_hi ^ bitflip_hi;
+      hi += keyed_hi + (keyed_hi & 0xffffffffull) * (prime32_2 - 1);
+      lo ^= swap64(hi);
+
+      // 128x64-bit multiplication by prime64_2
+      std::uint64_t h_lo = 0;
+      std::uint64_t h_hi = 0;
+      mul128(lo, prime64_2, h_lo, h_hi);
+      h_hi += hi * prime64_2;
+      return {avalanche(h_lo), avalanche(h_hi)};
+    }
+    if (len >= 4) {
+      auto const seed =
+        seed_ ^ (static_cast<std::uint64_t>(swap32(static_cast<std::uint32_t>(seed_))) << 32);
+
+      auto const input_lo = load_chunk<std::uint32_t>(bytes, 0);
+      auto const input_hi = load_chunk<std::uint32_t>(bytes + len - 4, 0);
+      auto const input64  = input_lo + (static_cast<std::uint64_t>(input_hi) << 32);
+      auto const bitflip = (load_secret<std::uint64_t>(16) ^ load_secret<std::uint64_t>(24)) + seed;
+      mul128(input64 ^ bitflip, prime64_1 + (len << 2), lo, hi);
+
+      hi += lo << 1;
+      lo ^= hi >> 3;
+      lo ^= lo >> 35;
+      lo *= prime_mx2;
+      lo ^= lo >> 28;
+      return {lo, avalanche(hi)};
+    }
+    if (len > 0) {
+      auto const c1 = std::to_integer<std::uint32_t>(bytes[0]);
+      auto const c2 = std::to_integer<std::uint32_t>(bytes[len >> 1]);
+      auto const c3 = std::to_integer<std::uint32_t>(bytes[len - 1]);
+
+      auto const combined_lo =
+        (c1 << 16) | (c2 << 24) | c3 | (static_cast<std::uint32_t>(len) << 8);
+      auto const swapped     = swap32(combined_lo);
+      auto const combined_hi = (swapped << 13) | (swapped >> 19);
+
+      auto const bitflip_lo =
+        static_cast<std::uint64_t>(load_secret<std::uint32_t>(0) ^ load_secret<std::uint32_t>(4)) +
+        seed_;
+      auto const bitflip_hi =
+        static_cast<std::uint64_t>(load_secret<std::uint32_t>(8) ^ load_secret<std::uint32_t>(12)) -
+        seed_;
+      return {finalize(combined_lo ^ bitflip_lo), finalize(combined_hi ^ bitflip_hi)};
+    }
+    return {finalize(seed_ ^ load_secret<std::uint64_t>(64) ^ load_secret<std::uint64_t>(72)),
+            finalize(seed_ ^ load_secret<std::uint64_t>(80) ^ load_secret<std::uint64_t>(88))};
+  }
+
+  constexpr __host__ __device__ result_type hash_17to240(std::byte const* bytes,
+                                                         std::size_t len) const noexcept
+  {
+    std::uint64_t lo = len * prime64_1;
+    std::uint64_t hi = 0;
+    if (len <= 128) {
+      for (std::size_t i = (len - 1) / 32 + 1; i-- > 0;) {
+        mix32(lo, hi, bytes + 16 * i, bytes + len - 16 * (i + 1), 32 * i, seed_);
+      }
+    } else {
+      for (std::size_t i = 32; i < 160; i += 32) {
+        mix32(lo, hi, bytes + i - 32, bytes + i - 16, i - 32, seed_);
+      }
+      lo = avalanche(lo);
+      hi = avalanche(hi);
+      for (std::size_t i = 160; i <= len; i += 32) {
+        mix32(lo, hi, bytes + i - 32, bytes + i - 16, i - 157, seed_);
+      }
+      // the last 32 bytes use the secret at offset 136 - 17 - 16
+      mix32(lo, hi, bytes + len - 16, bytes + len - 32, 103, 0 - seed_);
+    }
+
+    auto const h_lo = lo + hi;
+    auto const h_hi = lo * prime64_1 + hi * prime64_4 + (len - seed_) * prime64_2;
+    return {avalanche(h_lo), 0 - avalanche(h_hi)};
+  }
+
+  constexpr __host__ __device__ result_type hash_long(std::byte const* bytes,
+                                                      std::size_t len) const noexcept
+  {
+    std::byte secret[secret_size]{};
+    std::uint64_t acc[8]{};
+    accumulate_long(bytes, len, secret, acc);
+
+    // merge the accumulators twice, with the secret at offsets not aligned on 8
+    return {merge_accs(acc, secret + 11, len * prime64_1),
+            merge_accs(acc, secret + secret_size - 64 - 11, ~(len * prime64_2))};
+  }
+
+  // mixes 32 input bytes into the two accumulators
+  constexpr __host__ __device__ void mix32(std::uint64_t& lo,
+                                           std::uint64_t& hi,
+                                           std::byte const* bytes1,
+                                           std::byte const* bytes2,
+                                           std::size_t offset,
+                                           std::uint64_t seed) const noexcept
+  {
+    lo += mix16(bytes1, offset, seed);
+    lo ^= load_chunk<std::uint64_t>(bytes2, 0) + load_chunk<std::uint64_t>(bytes2, 1);
+    hi += mix16(bytes2, offset + 16, seed);
+    hi ^= load_chunk<std::uint64_t>(bytes1, 0) + load_chunk<std::uint64_t>(bytes1, 1);
+  }
+};
+
 }  // namespace cuco::detail
@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cuco/detail/error.hpp>
+#include <cuco/detail/utils.cuh>
+
+#include <algorithm>
+#include <bitset>
+#include <climits>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+namespace cuco {
+namespace experimental {
+
+template <typename Hash, typename InputIt>
+double avalanche_bias(Hash const& hash, InputIt first, InputIt last)
+{
+  using key_type    = typename std::iterator_traits<InputIt>::value_type;
+  using bits_type   = std::make_unsigned_t<key_type>;
+  using result_type = std::decay_t<decltype(hash(std::declval<key_type const&>()))>;
+  static_assert(std::is_integral_v<key_type>, "Key type must be integral.");
+  static_assert(std::is_integral_v<result_type>, "Hash result type must be integral.");
+
+  constexpr std::size_t input_bits  = CHAR_BIT * sizeof(key_type);
+  constexpr std::size_t output_bits = CHAR_BIT * sizeof(result_type);
+
+  std::vector<std::size_t> num_flips(input_bits, 0);
+  std::size_t num_keys = 0;
+  for (; first != last; ++first, ++num_keys) {
+    key_type const key = *first;
+    auto const h       = hash(key);
+    for (std::size_t bit = 0; bit < input_bits; ++bit) {
+      auto const mask    = static_cast<bits_type>(bits_type{1} << bit);
+      auto const flipped = static_cast<key_type>(static_cast<bits_type>(key) ^ mask);
+      auto const diff    = static_cast<unsigned long long>(h ^ hash(flipped));
+      num_flips[bit] += std::bitset<output_bits>(diff).count();
+    }
+  }
+  if (num_keys == 0) { return 0.; }
+
+  double bias = 0.;
+  for (auto const flips : num_flips) {
+    auto const ratio = static_cast<double>(flips) / (num_keys * output_bits);
+    bias             = std::max(bias, std::abs(ratio - 0.5));
+  }
+  return bias;
+}
+
+template <typename Hash, typename InputIt>
+double bucket_chi_square(Hash const& hash, InputIt first, InputIt last, std::size_t num_buckets)
+{
+  CUCO_EXPECTS(num_buckets > 1, "Invalid number of buckets");
+
+  std::vector<std::size_t> counts(num_buckets, 0);
+  std::size_t num_keys = 0;
+  for (; first != last; ++first, ++num_keys) {
+    ++counts[cuco::detail::sanitize_hash<std::size_t>(hash(*first)) % num_buckets];
+  }
+  if (num_keys == 0) { return 0.; }
+
+  auto const expected = static_cast<double>(num_keys) / num_buckets;
+  double chi_square   = 0.;
+  for (auto const count : counts) {
+    chi_square += (count - expected) * (count - expected) / expected;
+  }
+  return chi_square / (num_buckets - 1);
+}
+
+template <typename ProbingScheme, typename InputIt>
+probe_length_report probe_lengths(ProbingScheme const& probing_scheme,
+                                  InputIt first,
+                                  InputIt last,
+                                  std::size_t num_windows,
+                                  int32_t window_size)
+{
+  CUCO_EXPECTS(num_windows > 0 and window_size > 0, "Invalid table extent");
+  auto const capacity = num_windows * static_cast<std::size_t>(window_size);
+  CUCO_EXPECTS(static_cast<std::size_t>(std::distance(first, last)) <= capacity,
+               "Table cannot hold all keys");
+
+  auto const upper_bound = extent<std::size_t>{num_windows};
+  std::vector<int32_t> occupancy(num_windows, 0);
+
+  probe_length_report report{};
+  std::size_t total_probes = 0;
+  for (; first != last; ++first) {
+    auto iter              = probing_scheme(*first, upper_bound);
+    std::size_t num_probes = 1;
+    while (num_probes <= num_windows and occupancy[*iter] == window_size) {
+      ++iter;
+      ++num_probes;
+    }
+    if (num_probes > num_windows) {
+      ++report.num_failed;
+      continue;
+    }
+
+    ++occupancy[*iter];
+    ++report.num_keys;
+    total_probes += num_probes;
+    report.max_probes = std::max(report.max_probes, num_probes);
+    if (report.histogram.size() < num_probes) { report.histogram.resize(num_probes, 0); }
+    ++report.histogram[num_probes - 1];
+  }
+
+  report.load_factor = static_cast<double>(report.num_keys) / capacity;
+  report.mean_probes =
+    report.num_keys == 0 ? 0. : static_cast<double>(total_probes) / report.num_keys;
+  return report;
+}
+
+}  // namespace experimental
+}  // namespace cuco
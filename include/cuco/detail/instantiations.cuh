@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <thrust/device_vector.h>
+
+namespace cuco {
+namespace experimental {
+namespace detail {
+
+/*
+ * Precompiled instantiations
+ *
+ * The `cuco_instantiations` library explicitly instantiates the host bulk operations of common
+ * `static_set` and `static_map` types, i.e., 4- and 8-byte integer keys and payloads with either
+ * the default double hashing or scalar linear probing (`linear_probing_static_set` and
+ * `linear_probing_static_map`), for input and output iterators that are raw pointers or
+ * `thrust::device_vector` iterators. Targets linking against the library are compiled
+ * with `CUCO_EXTERN_INSTANTIATIONS`, which turns the same lists into explicit instantiation
+ * declarations, so that these operations and their kernels are compiled once in the library
+ * instead of in every translation unit using them. Other types and iterators are instantiated
+ * implicitly as usual.
+ */
+
+/// Iterator over constant elements in device memory
+template <typename T>
+using const_pointer = T const*;
+
+/// Iterator over mutable elements in device memory
+template <typename T>
+using pointer = T*;
+
+/// Iterator of a mutable `thrust::device_vector`
+template <typename T>
+using device_vector_iterator = typename thrust::device_vector<T>::iterator;
+
+/// Iterator of a constant `thrust::device_vector`
+template <typename T>
+using device_vector_const_iterator = typename thrust::device_vector<T>::const_iterator;
+
+}  // namespace detail
+}  // namespace experimental
+}  // namespace cuco
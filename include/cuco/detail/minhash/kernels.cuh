@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cuco/detail/utils.hpp>
+
+#include <cuda/std/limits>
+
+#include <cooperative_groups.h>
+
+#include <cstdint>
+#include <iterator>
+
+namespace cuco {
+namespace experimental {
+namespace minhash_ns {
+namespace detail {
+
+/**
+ * @brief Computes the MinHash signatures of `n` sets.
+ *
+ * @note Each set is processed by a tile of `TileSize` threads. The tile loads `TileSize` elements
+ * at a time, one per thread, and broadcasts them to all threads of the tile. Thread `t` of the
+ * tile computes the components `t, t + TileSize, ...` of the signature, so that the signature is
+ * written with coalesced stores.
+ *
+ * @tparam BlockSize Number of threads in each block
+ * @tparam TileSize Number of threads processing each set
+ * @tparam Hasher Seeded hash function type
+ * @tparam OffsetIt Device accessible random access input iterator of set offsets
+ * @tparam InputIt Device accessible random access input iterator of set elements
+ * @tparam OutputIt Device accessible random access output iterator assignable from
+ * `Hasher::result_type`
+ *
+ * @param offsets Beginning of the sequence of `n + 1` set offsets
+ * @param n Number of sets
+ * @param elements Beginning of the sequence of set elements
+ * @param num_hashes Number of hash functions
+ * @param output_begin Beginning of the sequence of `n * num_hashes` signature components
+ */
+template <int32_t BlockSize,
+          int32_t TileSize,
+          typename Hasher,
+          typename OffsetIt,
+          typename InputIt,
+          typename OutputIt>
+__global__ void minhash(OffsetIt offsets,
+                        cuco::detail::index_type n,
+                        InputIt elements,
+                        int32_t num_hashes,
+                        OutputIt output_begin)
+{
+  namespace cg = cooperative_groups;
+
+  using element_type = typename std::iterator_traits<InputIt>::value_type;
+  using result_type  = typename Hasher::result_type;
+
+  auto const tile      = cg::tiled_partition<TileSize>(cg::this_thread_block());
+  auto const tile_rank = static_cast<int32_t>(tile.thread_rank());
+
+  cuco::detail::index_type const loop_stride = gridDim.x * BlockSize / TileSize;
+  cuco::detail::index_type idx               = (BlockSize * blockIdx.x + threadIdx.x) / TileSize;
+
+  while (idx < n) {
+    cuco::detail::index_type const first = *(offsets + idx);
+    cuco::detail::index_type const last  = *(offsets + idx + 1);
+
+    for (int32_t base = 0; base < num_hashes; base += TileSize) {
+      auto const hash_idx = base + tile_rank;
+      Hasher const hash(static_cast<std::uint32_t>(hash_idx));
+      auto min_hash = cuda::std::numeric_limits<result_type>::max();
+
+      for (auto chunk = first; chunk < last; chunk += TileSize) {
+        auto const chunk_size = static_cast<int32_t>(
+          last - chunk < TileSize ? last - chunk : cuco::detail::index_type{TileSize});
+        element_type element{};
+        if (tile_rank < chunk_size) { element = *(elements + chunk + tile_rank); }
+
+        for (int32_t i = 0; i < chunk_size; ++i) {
+          auto const value = hash(tile.shfl(element, i));
+          if (value < min_hash) { min_hash = value; }
+        }
+      }
+
+      if (hash_idx < num_hashes) { *(output_begin + idx * num_hashes + hash_idx) = min_hash; }
+    }
+    idx += loop_stride;
+  }
+}
+
+}  // namespace detail
+}  // namespace minhash_ns
+}  // namespace experimental
+}  // namespace cuco
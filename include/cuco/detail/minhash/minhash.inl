@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cuco/cuda_stream_ref.hpp>
+#include <cuco/detail/minhash/kernels.cuh>
+#include <cuco/detail/tuning.cuh>
+#include <cuco/detail/utils.hpp>
+
+#include <iterator>
+
+namespace cuco {
+namespace experimental {
+
+template <template <typename> class Hash, typename OffsetIt, typename InputIt, typename OutputIt>
+void minhash(OffsetIt offsets_first,
+             OffsetIt offsets_last,
+             InputIt elements_first,
+             int32_t num_hashes,
+             OutputIt output_begin,
+             cuda_stream_ref stream)
+{
+  minhash_async<Hash>(
+    offsets_first, offsets_last, elements_first, num_hashes, output_begin, stream);
+  stream.synchronize();
+}
+
+template <template <typename> class Hash, typename OffsetIt, typename InputIt, typename OutputIt>
+void minhash_async(OffsetIt offsets_first,
+                   OffsetIt offsets_last,
+                   InputIt elements_first,
+                   int32_t num_hashes,
+                   OutputIt output_begin,
+                   cuda_stream_ref stream) noexcept
+{
+  using hasher = Hash<typename std::iterator_traits<InputIt>::value_type>;
+
+  auto const num_offsets = cuco::detail::distance(offsets_first, offsets_last);
+  if (num_offsets < 2 or num_hashes <= 0) { return; }
+  auto const num_sets = num_offsets - 1;
+
+  // One warp per set
+  auto constexpr tile_size = 32;
+  auto const grid_size =
+    (tile_size * num_sets + detail::CUCO_DEFAULT_STRIDE * detail::CUCO_DEFAULT_BLOCK_SIZE - 1) /
+    (detail::CUCO_DEFAULT_STRIDE * detail::CUCO_DEFAULT_BLOCK_SIZE);
+
+  minhash_ns::detail::minhash<detail::CUCO_DEFAULT_BLOCK_SIZE, tile_size, hasher>
+    <<<grid_size, detail::CUCO_DEFAULT_BLOCK_SIZE, 0, stream>>>(
+      offsets_first, num_sets, elements_first, num_hashes, output_begin);
+}
+
+}  // namespace experimental
+}  // namespace cuco
@@ -20,10 +20,14 @@
 #include <cuco/detail/common_functors.cuh>
 #include <cuco/detail/common_kernels.cuh>
 #include <cuco/detail/storage/counter_storage.cuh>
+#include <cuco/detail/table_analysis/kernels.cuh>
+#include <cuco/detail/tracing/trace_scope.hpp>
 #include <cuco/detail/tuning.cuh>
 #include <cuco/extent.cuh>
 #include <cuco/probing_scheme.cuh>
 #include <cuco/storage.cuh>
+#include <cuco/table_analysis.hpp>
+#include <cuco/tracing.hpp>
 #include <cuco/utility/traits.hpp>
 
 #include <thrust/iterator/constant_iterator.h>
@@ -34,6 +38,10 @@
 
 #include <cuda/atomic>
 
+#include <functional>
+#include <memory>
+#include <utility>
+
 namespace cuco {
 namespace experimental {
 namespace detail {
@@ -143,6 +151,7 @@ class open_addressing_impl {
    */
   void clear(cuda_stream_ref stream) noexcept
   {
+    auto const scope = this->trace("clear", this->capacity(), stream);
     this->clear_async(stream);
     stream.synchronize();
   }
@@ -155,6 +164,7 @@ class open_addressing_impl {
    */
   void clear_async(cuda_stream_ref stream) noexcept
   {
+    auto const scope = this->trace("clear_async", this->capacity(), stream);
     storage_.initialize(empty_slot_sentinel_, stream);
   }
 
@@ -181,6 +191,7 @@ class open_addressing_impl {
   size_type insert(InputIt first, InputIt last, Ref container_ref, cuda_stream_ref stream)
   {
     auto const num_keys = cuco::detail::distance(first, last);
+    auto const scope    = this->trace("insert", num_keys, stream);
     if (num_keys == 0) { return 0; }
 
     auto counter =
@@ -216,6 +227,7 @@ class open_addressing_impl {
   void insert_async(InputIt first, InputIt last, Ref container_ref, cuda_stream_ref stream) noexcept
   {
     auto const num_keys = cuco::detail::distance(first, last);
+    auto const scope    = this->trace("insert_async", num_keys, stream);
     if (num_keys == 0) { return; }
 
     auto const grid_size =
@@ -263,6 +275,7 @@ class open_addressing_impl {
                       cuda_stream_ref stream)
   {
     auto const num_keys = cuco::detail::distance(first, last);
+    auto const scope    = this->trace("insert_if", num_keys, stream);
     if (num_keys == 0) { return 0; }
 
     auto counter =
@@ -311,6 +324,7 @@ class open_addressing_impl {
                        cuda_stream_ref stream) noexcept
   {
     auto const num_keys = cuco::detail::distance(first, last);
+    auto const scope    = this->trace("insert_if_async", num_keys, stream);
     if (num_keys == 0) { return; }
 
     auto const grid_size =
@@ -344,6 +358,7 @@ class open_addressing_impl {
                       cuda_stream_ref stream) const noexcept
   {
     auto const num_keys = cuco::detail::distance(first, last);
+    auto const scope    = this->trace("contains_async", num_keys, stream);
     if (num_keys == 0) { return; }
 
     auto const grid_size =
@@ -395,6 +410,7 @@ class open_addressing_impl {
                          cuda_stream_ref stream) const noexcept
   {
     auto const num_keys = cuco::detail::distance(first, last);
+    auto const scope    = this->trace("contains_if_async", num_keys, stream);
     if (num_keys == 0) { return; }
 
     auto const grid_size =
@@ -433,6 +449,8 @@ class open_addressing_impl {
                                       Predicate const& is_filled,
                                       cuda_stream_ref stream) const
   {
+    auto const scope = this->trace("retrieve_all", this->capacity(), stream);
+
     std::size_t temp_storage_bytes = 0;
     using temp_allocator_type = typename std::allocator_traits<allocator_type>::rebind_alloc<char>;
     auto temp_allocator       = temp_allocator_type{this->allocator()};
@@ -485,21 +503,76 @@ class open_addressing_impl {
   template <typename Predicate>
   [[nodiscard]] size_type size(Predicate const& is_filled, cuda_stream_ref stream) const noexcept
   {
-    auto counter =
-      detail::counter_storage<size_type, thread_scope, allocator_type>{this->allocator()};
-    counter.reset(stream);
-
-    auto const grid_size =
-      (storage_.num_windows() + detail::CUCO_DEFAULT_STRIDE * detail::CUCO_DEFAULT_BLOCK_SIZE - 1) /
-      (detail::CUCO_DEFAULT_STRIDE * detail::CUCO_DEFAULT_BLOCK_SIZE);
-
-    // TODO: custom kernel to be replaced by cub::DeviceReduce::Sum when cub version is bumped to
-    // v2.1.0
-    detail::size<detail::CUCO_DEFAULT_BLOCK_SIZE>
-      <<<grid_size, detail::CUCO_DEFAULT_BLOCK_SIZE, 0, stream>>>(
-        storage_.ref(), is_filled, counter.data());
+    return count_filled(storage_.ref(), is_filled, this->allocator(), stream);
+  }
 
-    return counter.load_to_host(stream);
+  /**
+   * @brief Builds a health report of the container.
+   *
+   * @note This function synchronizes the given stream.
+   *
+   * @tparam Key Type of the keys the probing scheme is invoked with
+   * @tparam Predicate Type of predicate indicating if the given slot is filled
+   *
+   * @param is_filled Predicate indicating if the given slot is filled
+   * @param stream CUDA stream used for this operation
+   *
+   * @return Health report of the container
+   */
+  template <typename Key, typename Predicate>
+  [[nodiscard]] table_analysis analyze(Predicate const& is_filled, cuda_stream_ref stream) const
+  {
+    constexpr auto num_bins = table_analysis::num_displacement_bins;
+    auto const num_windows  = storage_.num_windows();
+
+    // Counters layout: [histogram bins][displacement sum][max displacement]
+    auto const occupancy_bytes = sizeof(int32_t) * num_windows;
+    auto const counters_bytes  = sizeof(unsigned long long int) * (num_bins + 2);
+
+    using temp_allocator_type =
+      typename std::allocator_traits<allocator_type>::template rebind_alloc<char>;
+    auto temp_allocator = temp_allocator_type{this->allocator()};
+    auto d_occupancy    = reinterpret_cast<int32_t*>(temp_allocator.allocate(occupancy_bytes));
+    auto d_counters =
+      reinterpret_cast<unsigned long long int*>(temp_allocator.allocate(counters_bytes));
+    CUCO_CUDA_TRY(cudaMemsetAsync(d_occupancy, 0, occupancy_bytes, stream));
+    CUCO_CUDA_TRY(cudaMemsetAsync(d_counters, 0, counters_bytes, stream));
+
+    if (num_windows > 0) {
+      auto const grid_size =
+        (cg_size * num_windows + detail::CUCO_DEFAULT_STRIDE * detail::CUCO_DEFAULT_BLOCK_SIZE -
+         1) /
+        (detail::CUCO_DEFAULT_STRIDE * detail::CUCO_DEFAULT_BLOCK_SIZE);
+
+      detail::analyze<cg_size, detail::CUCO_DEFAULT_BLOCK_SIZE, Key>
+        <<<grid_size, detail::CUCO_DEFAULT_BLOCK_SIZE, 0, stream>>>(storage_.ref(),
+                                                                    probing_scheme_,
+                                                                    is_filled,
+                                                                    d_occupancy,
+                                                                    d_counters,
+                                                                    num_bins,
+                                                                    d_counters + num_bins,
+                                                                    d_counters + num_bins + 1);
+    }
+
+    std::vector<int32_t> h_occupancy(num_windows);
+    std::vector<unsigned long long int> h_counters(num_bins + 2);
+    CUCO_CUDA_TRY(cudaMemcpyAsync(
+      h_occupancy.data(), d_occupancy, occupancy_bytes, cudaMemcpyDeviceToHost, stream));
+    CUCO_CUDA_TRY(cudaMemcpyAsync(
+      h_counters.data(), d_counters, counters_bytes, cudaMemcpyDeviceToHost, stream));
+    stream.synchronize();
+    temp_allocator.deallocate(reinterpret_cast<char*>(d_occupancy), occupancy_bytes);
+    temp_allocator.deallocate(reinterpret_cast<char*>(d_counters), counters_bytes);
+
+    return detail::make_table_analysis(
+      h_occupancy,
+      std::vector<std::uint64_t>(h_counters.begin(), h_counters.begin() + num_bins),
+      h_counters[num_bins],
+      h_counters[num_bins + 1],
+      window_size,
+      cg_size,
+      detail::is_linear_probing<probing_scheme_type>::value);
   }
 
   /**
@@ -550,12 +623,95 @@ class open_addressing_impl {
    */
   [[nodiscard]] constexpr storage_ref_type storage_ref() const noexcept { return storage_.ref(); }
 
+  /**
+   * @brief Attaches a tracer receiving a begin and an end event for every bulk operation.
+   *
+   * @tparam Predicate Type of predicate indicating if the given slot is filled
+   *
+   * @param tracer Tracer to attach, or null to detach the current one
+   * @param is_filled Predicate indicating if the given slot is filled, used to compute the load
+   * factors requested by the tracer
+   */
+  template <typename Predicate>
+  void set_tracer(std::shared_ptr<cuco::experimental::tracer> tracer, Predicate const& is_filled)
+  {
+    tracer_ = std::move(tracer);
+    // Captures values rather than `this`, which is not stable across moves of the container
+    load_factor_ = [storage_ref = this->storage_ref(), allocator = this->allocator(), is_filled](
+                     cuda_stream_ref stream) {
+      return static_cast<double>(count_filled(storage_ref, is_filled, allocator, stream)) /
+             storage_ref.capacity();
+    };
+  }
+
+  /**
+   * @brief Traces a bulk operation until the returned scope is destroyed.
+   *
+   * @param name Name of the operation
+   * @param num_keys Number of input keys, or of scanned slots for whole-container operations
+   * @param stream CUDA stream of the operation
+   *
+   * @return Scope tracing the operation
+   */
+  [[nodiscard]] detail::trace_scope trace(char const* name,
+                                          std::size_t num_keys,
+                                          cuda_stream_ref stream) const noexcept
+  {
+    return detail::trace_scope{tracer_.get(),
+                               name,
+                               num_keys,
+                               static_cast<std::size_t>(this->capacity()),
+                               &load_factor_,
+                               stream};
+  }
+
+ private:
+  /**
+   * @brief Gets the number of filled slots of the given storage.
+   *
+   * @note This function synchronizes the given stream.
+   *
+   * @tparam Predicate Type of predicate indicating if the given slot is filled
+   *
+   * @param storage_ref Non-owning ref of the slot storage
+   * @param is_filled Predicate indicating if the given slot is filled
+   * @param allocator Allocator used to allocate the counter
+   * @param stream CUDA stream used to count the filled slots
+   *
+   * @return The number of filled slots
+   */
+  template <typename Predicate>
+  [[nodiscard]] static size_type count_filled(storage_ref_type storage_ref,
+                                              Predicate const& is_filled,
+                                              allocator_type const& allocator,
+                                              cuda_stream_ref stream)
+  {
+    auto counter = detail::counter_storage<size_type, thread_scope, allocator_type>{allocator};
+    counter.reset(stream);
+
+    auto const num_windows = storage_ref.num_windows();
+    auto const grid_size =
+      (num_windows + detail::CUCO_DEFAULT_STRIDE * detail::CUCO_DEFAULT_BLOCK_SIZE - 1) /
+      (detail::CUCO_DEFAULT_STRIDE * detail::CUCO_DEFAULT_BLOCK_SIZE);
+
+    // TODO: custom kernel to be replaced by cub::DeviceReduce::Sum when cub version is bumped to
+    // v2.1.0
+    detail::size<detail::CUCO_DEFAULT_BLOCK_SIZE>
+      <<<grid_size, detail::CUCO_DEFAULT_BLOCK_SIZE, 0, stream>>>(
+        storage_ref, is_filled, counter.data());
+
+    return counter.load_to_host(stream);
+  }
+
  protected:
   key_type empty_key_sentinel_;         ///< Key value that represents an empty slot
   value_type empty_slot_sentinel_;      ///< Slot value that represents an empty slot
   key_equal predicate_;                 ///< Key equality binary predicate
   probing_scheme_type probing_scheme_;  ///< Probing scheme
   storage_type storage_;                ///< Slot window storage
+
+  std::shared_ptr<cuco::experimental::tracer> tracer_;  ///< Tracer of bulk operations, may be null
+  detail::trace_scope::load_factor_type load_factor_;  ///< Load factor getter of the tracer
 };
 
 }  // namespace detail
@@ -17,6 +17,7 @@
 #pragma once
 
 #include <cuco/detail/equal_wrapper.cuh>
+#include <cuco/detail/probe_stats/probe_stats.cuh>
 #include <cuco/extent.cuh>
 #include <cuco/pair.cuh>
 
@@ -47,10 +48,14 @@ namespace detail {
  * @tparam Key Type used for keys. Requires `cuco::is_bitwise_comparable_v<Key>` returning true
  * @tparam Scope The scope in which operations will be performed by individual threads.
  * @tparam ProbingScheme Probing scheme (see `include/cuco/probing_scheme.cuh` for options)
- * @tparam StorageRef Storage ref type
+ * @tparam StorageRef Storage ref type, optionally carrying a probing statistics ref (see
+ * `cuco::experimental::detail::probe_stats_storage_ref`)
  */
 template <typename Key, cuda::thread_scope Scope, typename ProbingScheme, typename StorageRef>
-class open_addressing_ref_impl {
+class open_addressing_ref_impl
+  : private probe_stats_storage_ref_traits<StorageRef>::stats_ref_type {
+  using stats_traits = probe_stats_storage_ref_traits<StorageRef>;
+
   static_assert(sizeof(Key) <= 8, "Container does not support key types larger than 8 bytes.");
 
   static_assert(
@@ -73,13 +78,15 @@ class open_addressing_ref_impl {
  public:
   using key_type            = Key;                                     ///< Key type
   using probing_scheme_type = ProbingScheme;                           ///< Type of probing scheme
-  using storage_ref_type    = StorageRef;                              ///< Type of storage ref
+  /// Type of slot storage ref
+  using storage_ref_type    = typename stats_traits::storage_ref_type;
   using window_type         = typename storage_ref_type::window_type;  ///< Window type
   using value_type          = typename storage_ref_type::value_type;   ///< Storage element type
   using extent_type         = typename storage_ref_type::extent_type;  ///< Extent type
   using size_type           = typename storage_ref_type::size_type;    ///< Probing scheme size type
   using iterator            = typename storage_ref_type::iterator;     ///< Slot iterator type
   using const_iterator = typename storage_ref_type::const_iterator;    ///< Const slot iterator type
+  using stats_ref_type = typename stats_traits::stats_ref_type;  ///< Type of probing statistics ref
 
   static constexpr auto cg_size = probing_scheme_type::cg_size;  ///< Cooperative group size
   static constexpr auto window_size =
@@ -95,8 +102,9 @@ class open_addressing_ref_impl {
   __host__ __device__ explicit constexpr open_addressing_ref_impl(
     value_type empty_slot_sentinel,
     probing_scheme_type const& probing_scheme,
-    storage_ref_type storage_ref) noexcept
-    : empty_slot_sentinel_{empty_slot_sentinel},
+    StorageRef storage_ref) noexcept
+    : stats_ref_type{stats_traits::stats_ref(storage_ref)},
+      empty_slot_sentinel_{empty_slot_sentinel},
       probing_scheme_{probing_scheme},
       storage_ref_{storage_ref}
   {
@@ -147,6 +155,7 @@ class open_addressing_ref_impl {
   {
     static_assert(cg_size == 1, "Non-CG operation is incompatible with the current probing scheme");
     auto probing_iter = probing_scheme_(key, storage_ref_.window_extent());
+    auto probe_length = this->template make_probe_counter<probe_op::INSERT>(true);
 
     while (true) {
       auto const window_slots = storage_ref_[*probing_iter];
@@ -155,7 +164,10 @@ class open_addressing_ref_impl {
         auto const eq_res = predicate(slot_content, key);
 
         // If the key is already in the container, return false
-        if (eq_res == detail::equal_result::EQUAL) { return false; }
+        if (eq_res == detail::equal_result::EQUAL) {
+          this->record_duplicate();
+          return false;
+        }
         if (eq_res == detail::equal_result::EMPTY) {
           auto const intra_window_index = thrust::distance(window_slots.begin(), &slot_content);
           switch (attempt_insert(
@@ -167,6 +179,7 @@ class open_addressing_ref_impl {
         }
       }
       ++probing_iter;
+      ++probe_length;
     }
   }
 
@@ -189,6 +202,8 @@ class open_addressing_ref_impl {
                          Predicate const& predicate) noexcept
   {
     auto probing_iter = probing_scheme_(group, key, storage_ref_.window_extent());
+    auto probe_length =
+      this->template make_probe_counter<probe_op::INSERT>(group.thread_rank() == 0);
 
     while (true) {
       auto const window_slots = storage_ref_[*probing_iter];
@@ -206,7 +221,10 @@ class open_addressing_ref_impl {
       }();
 
       // If the key is already in the container, return false
-      if (group.any(state == detail::equal_result::EQUAL)) { return false; }
+      if (group.any(state == detail::equal_result::EQUAL)) {
+        if (group.thread_rank() == 0) { this->record_duplicate(); }
+        return false;
+      }
 
       auto const group_contains_empty = group.ballot(state == detail::equal_result::EMPTY);
 
@@ -226,6 +244,7 @@ class open_addressing_ref_impl {
         }
       } else {
         ++probing_iter;
+        ++probe_length;
       }
     }
   }
@@ -253,6 +272,7 @@ class open_addressing_ref_impl {
   {
     static_assert(cg_size == 1, "Non-CG operation is incompatible with the current probing scheme");
     auto probing_iter = probing_scheme_(key, storage_ref_.window_extent());
+    auto probe_length = this->template make_probe_counter<probe_op::INSERT>(true);
 
     while (true) {
       auto const window_slots = storage_ref_[*probing_iter];
@@ -262,7 +282,10 @@ class open_addressing_ref_impl {
         auto* window_ptr  = (storage_ref_.data() + *probing_iter)->data();
 
         // If the key is already in the container, return false
-        if (eq_res == detail::equal_result::EQUAL) { return {iterator{&window_ptr[i]}, false}; }
+        if (eq_res == detail::equal_result::EQUAL) {
+          this->record_duplicate();
+          return {iterator{&window_ptr[i]}, false};
+        }
         if (eq_res == detail::equal_result::EMPTY) {
           switch ([&]() {
             if constexpr (sizeof(value_type) <= 8) {
@@ -282,6 +305,7 @@ class open_addressing_ref_impl {
         }
       }
       ++probing_iter;
+      ++probe_length;
     };
   }
 
@@ -310,6 +334,8 @@ class open_addressing_ref_impl {
     Predicate const& predicate) noexcept
   {
     auto probing_iter = probing_scheme_(group, key, storage_ref_.window_extent());
+    auto probe_length =
+      this->template make_probe_counter<probe_op::INSERT>(group.thread_rank() == 0);
 
     while (true) {
       auto const window_slots = storage_ref_[*probing_iter];
@@ -331,6 +357,7 @@ class open_addressing_ref_impl {
       // If the key is already in the container, return false
       auto const group_finds_equal = group.ballot(state == detail::equal_result::EQUAL);
       if (group_finds_equal) {
+        if (group.thread_rank() == 0) { this->record_duplicate(); }
         auto const src_lane = __ffs(group_finds_equal) - 1;
         auto const res      = group.shfl(reinterpret_cast<intptr_t>(slot_ptr), src_lane);
         return {iterator{reinterpret_cast<value_type*>(res)}, false};
@@ -360,6 +387,7 @@ class open_addressing_ref_impl {
         }
       } else {
         ++probing_iter;
+        ++probe_length;
       }
     }
   }
@@ -384,6 +412,7 @@ class open_addressing_ref_impl {
   {
     static_assert(cg_size == 1, "Non-CG operation is incompatible with the current probing scheme");
     auto probing_iter = probing_scheme_(key, storage_ref_.window_extent());
+    auto probe_length = this->template make_probe_counter<probe_op::LOOKUP>(true);
 
     while (true) {
       // TODO atomic_ref::load if insert operator is present
@@ -397,6 +426,7 @@ class open_addressing_ref_impl {
         }
       }
       ++probing_iter;
+      ++probe_length;
     }
   }
 
@@ -422,6 +452,8 @@ class open_addressing_ref_impl {
     Predicate const& predicate) const noexcept
   {
     auto probing_iter = probing_scheme_(group, key, storage_ref_.window_extent());
+    auto probe_length =
+      this->template make_probe_counter<probe_op::LOOKUP>(group.thread_rank() == 0);
 
     while (true) {
       auto const window_slots = storage_ref_[*probing_iter];
@@ -441,6 +473,7 @@ class open_addressing_ref_impl {
       if (group.any(state == detail::equal_result::EMPTY)) { return false; }
 
       ++probing_iter;
+      ++probe_length;
     }
   }
 
@@ -464,6 +497,7 @@ class open_addressing_ref_impl {
   {
     static_assert(cg_size == 1, "Non-CG operation is incompatible with the current probing scheme");
     auto probing_iter = probing_scheme_(key, storage_ref_.window_extent());
+    auto probe_length = this->template make_probe_counter<probe_op::LOOKUP>(true);
 
     while (true) {
       // TODO atomic_ref::load if insert operator is present
@@ -481,6 +515,7 @@ class open_addressing_ref_impl {
         }
       }
       ++probing_iter;
+      ++probe_length;
     }
   }
 
@@ -506,6 +541,8 @@ class open_addressing_ref_impl {
        Predicate const& predicate) const noexcept
   {
     auto probing_iter = probing_scheme_(group, key, storage_ref_.window_extent());
+    auto probe_length =
+      this->template make_probe_counter<probe_op::LOOKUP>(group.thread_rank() == 0);
 
     while (true) {
       auto const window_slots = storage_ref_[*probing_iter];
@@ -536,6 +573,7 @@ class open_addressing_ref_impl {
       if (group.any(state == detail::equal_result::EMPTY)) { return this->end(); }
 
       ++probing_iter;
+      ++probe_length;
     }
   }
 
@@ -668,9 +706,12 @@ class open_addressing_ref_impl {
       return insert_result::SUCCESS;
     } else {
       // Shouldn't use `predicate` operator directly since it includes a redundant bitwise compare
-      return predicate.equal_to(*old_ptr, value) == detail::equal_result::EQUAL
-               ? insert_result::DUPLICATE
-               : insert_result::CONTINUE;
+      if (predicate.equal_to(*old_ptr, value) == detail::equal_result::EQUAL) {
+        this->record_duplicate();
+        return insert_result::DUPLICATE;
+      }
+      this->record_cas_failure();
+      return insert_result::CONTINUE;
     }
   }
 
@@ -713,9 +754,11 @@ class open_addressing_ref_impl {
     // Our key was already present in the slot, so our key is a duplicate
     // Shouldn't use `predicate` operator directly since it includes a redundant bitwise compare
     if (predicate.equal_to(*old_key_ptr, value.first) == detail::equal_result::EQUAL) {
+      this->record_duplicate();
       return insert_result::DUPLICATE;
     }
 
+    this->record_cas_failure();
     return insert_result::CONTINUE;
   }
 
@@ -749,9 +792,11 @@ class open_addressing_ref_impl {
     // Our key was already present in the slot, so our key is a duplicate
     // Shouldn't use `predicate` operator directly since it includes a redundant bitwise compare
     if (predicate.equal_to(*old_key_ptr, value.first) == detail::equal_result::EQUAL) {
+      this->record_duplicate();
       return insert_result::DUPLICATE;
     }
 
+    this->record_cas_failure();
     return insert_result::CONTINUE;
   }
 
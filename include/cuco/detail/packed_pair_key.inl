@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+namespace cuco {
+
+template <typename First, typename Second>
+__host__ __device__ constexpr packed_pair_key<First, Second>::packed_pair_key(First f,
+                                                                            Second s) noexcept
+  : first{f}, second{s}
+{
+}
+
+template <typename First, typename Second>
+__host__ __device__ constexpr std::uint64_t packed_pair_key<First, Second>::pack() const noexcept
+{
+  return static_cast<std::uint64_t>(static_cast<std::uint32_t>(first)) |
+         (static_cast<std::uint64_t>(static_cast<std::uint32_t>(second)) << 32);
+}
+
+template <typename First, typename Second>
+__host__ __device__ constexpr packed_pair_key<First, Second>
+packed_pair_key<First, Second>::unpack(std::uint64_t packed) noexcept
+{
+  return packed_pair_key{static_cast<First>(static_cast<std::uint32_t>(packed)),
+                         static_cast<Second>(static_cast<std::uint32_t>(packed >> 32))};
+}
+
+template <typename First, typename Second>
+__host__ __device__ constexpr bool operator==(packed_pair_key<First, Second> const& lhs,
+                                              packed_pair_key<First, Second> const& rhs) noexcept
+{
+  return lhs.first == rhs.first and lhs.second == rhs.second;
+}
+
+template <typename First, typename Second>
+__host__ __device__ constexpr bool operator!=(packed_pair_key<First, Second> const& lhs,
+                                              packed_pair_key<First, Second> const& rhs) noexcept
+{
+  return not(lhs == rhs);
+}
+
+// A packed key has no padding, and thus unique object representations, by construction
+static_assert(cuco::is_bitwise_comparable_v<packed_pair_key<>>);
+static_assert(cuco::is_bitwise_comparable_v<packed_pair_key<std::uint32_t, std::int32_t>>);
+
+}  // namespace cuco
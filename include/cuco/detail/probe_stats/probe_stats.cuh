@@ -0,0 +1,492 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cuco/cuda_stream_ref.hpp>
+#include <cuco/detail/error.hpp>
+#include <cuco/probe_stats.cuh>
+
+#include <cooperative_groups.h>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace cuco {
+namespace experimental {
+namespace detail {
+
+/// Kinds of operations whose probe lengths are recorded separately
+enum class probe_op : int32_t { INSERT = 0, LOOKUP = 1 };
+
+/**
+ * @brief Atomically adds the number of calling threads of the warp to the given counter.
+ *
+ * @note Only one atomic is issued per warp for all threads that call this function together.
+ *
+ * @param counter Pointer to the device counter
+ */
+__device__ inline void warp_aggregated_increment(unsigned long long int* counter) noexcept
+{
+  auto const group = cooperative_groups::coalesced_threads();
+  if (group.thread_rank() == 0) {
+    atomicAdd(counter, static_cast<unsigned long long>(group.size()));
+  }
+}
+
+/**
+ * @brief Atomically increments bin `bin` of the given histogram.
+ *
+ * @note On Volta and newer architectures, threads of a warp incrementing the same bin together
+ * issue a single atomic.
+ *
+ * @param bins Pointer to the device histogram bins
+ * @param bin Index of the bin to increment
+ */
+__device__ inline void warp_aggregated_increment(unsigned long long int* bins,
+                                                 int32_t bin) noexcept
+{
+#if defined(__CUDA_ARCH__) && (__CUDA_ARCH__ >= 700)
+  auto const group =
+    cooperative_groups::labeled_partition(cooperative_groups::coalesced_threads(), bin);
+  if (group.thread_rank() == 0) {
+    atomicAdd(bins + bin, static_cast<unsigned long long>(group.size()));
+  }
+#else
+  atomicAdd(bins + bin, 1ull);
+#endif
+}
+
+/**
+ * @brief Probe-length counter of a disabled statistics policy.
+ */
+class null_probe_counter {
+ public:
+  /**
+   * @brief Counts one more visited window. Does nothing.
+   *
+   * @return Reference of the current counter
+   */
+  __device__ constexpr null_probe_counter& operator++() noexcept { return *this; }
+};
+
+/**
+ * @brief Device statistics ref of a disabled statistics policy.
+ *
+ * @note All members are no-ops so that the instrumentation compiles away entirely.
+ */
+class null_probe_stats_ref {
+ public:
+  /**
+   * @brief Creates a probe-length counter. Does nothing.
+   *
+   * @tparam Op Kind of the operation
+   *
+   * @return An empty counter
+   */
+  template <probe_op Op>
+  [[nodiscard]] __device__ constexpr null_probe_counter make_probe_counter(bool) const noexcept
+  {
+    return {};
+  }
+
+  /**
+   * @brief Records a failed CAS attempt. Does nothing.
+   */
+  __device__ constexpr void record_cas_failure() const noexcept {}
+
+  /**
+   * @brief Records an insertion of a key already present. Does nothing.
+   */
+  __device__ constexpr void record_duplicate() const noexcept {}
+};
+
+/**
+ * @brief Counts the windows visited by one operation and records the count when it goes out of
+ * scope, i.e., on every return path of the operation.
+ *
+ * @tparam NumBins Number of histogram bins
+ */
+template <int32_t NumBins>
+class probe_counter {
+ public:
+  /**
+   * @brief Constructs a counter of one visited window.
+   *
+   * @param bins Pointer to the histogram bins of the operation kind
+   * @param is_recording Whether this thread records the count, e.g., only one thread of a group
+   */
+  __device__ explicit constexpr probe_counter(unsigned long long int* bins,
+                                              bool is_recording) noexcept
+    : bins_{bins}, num_windows_{1}, is_recording_{is_recording}
+  {
+  }
+
+  probe_counter(probe_counter const&) = delete;
+  probe_counter& operator=(probe_counter const&) = delete;
+
+  /**
+   * @brief Records the number of visited windows.
+   */
+  __device__ ~probe_counter()
+  {
+    if (is_recording_) {
+      warp_aggregated_increment(bins_, num_windows_ < NumBins ? num_windows_ - 1 : NumBins - 1);
+    }
+  }
+
+  /**
+   * @brief Counts one more visited window.
+   *
+   * @return Reference of the current counter
+   */
+  __device__ constexpr probe_counter& operator++() noexcept
+  {
+    ++num_windows_;
+    return *this;
+  }
+
+ private:
+  unsigned long long int* bins_;  ///< Histogram bins
+  int32_t num_windows_;           ///< Number of visited windows
+  bool is_recording_;             ///< Whether the count is recorded by this thread
+};
+
+/**
+ * @brief Device statistics ref of the `probe_stats` policy.
+ *
+ * @note The counters are laid out as the insert histogram, the lookup histogram, the number of
+ * CAS failures and the number of duplicates.
+ *
+ * @tparam NumBins Number of histogram bins
+ */
+template <int32_t NumBins>
+class probe_stats_ref {
+ public:
+  static constexpr int32_t num_bins     = NumBins;          ///< Number of histogram bins
+  static constexpr int32_t num_counters = 2 * NumBins + 2;  ///< Total number of counters
+
+  using counter_type = unsigned long long int;  ///< Device counter type
+
+  /**
+   * @brief Constructs probe_stats_ref.
+   *
+   * @param counters Pointer to the device counters
+   */
+  __host__ __device__ explicit constexpr probe_stats_ref(counter_type* counters) noexcept
+    : counters_{counters}
+  {
+  }
+
+  /**
+   * @brief Creates a probe-length counter recording into the histogram of `Op`.
+   *
+   * @tparam Op Kind of the operation
+   *
+   * @param is_recording Whether this thread records the count
+   *
+   * @return A counter of one visited window
+   */
+  template <probe_op Op>
+  [[nodiscard]] __device__ probe_counter<NumBins> make_probe_counter(
+    bool is_recording) const noexcept
+  {
+    return probe_counter<NumBins>{counters_ + static_cast<int32_t>(Op) * NumBins, is_recording};
+  }
+
+  /**
+   * @brief Records a failed CAS attempt.
+   */
+  __device__ void record_cas_failure() const noexcept
+  {
+    warp_aggregated_increment(counters_ + 2 * NumBins);
+  }
+
+  /**
+   * @brief Records an insertion of a key already present.
+   */
+  __device__ void record_duplicate() const noexcept
+  {
+    warp_aggregated_increment(counters_ + 2 * NumBins + 1);
+  }
+
+ private:
+  counter_type* counters_;  ///< Pointer to the device counters
+};
+
+/**
+ * @brief Slot storage ref carrying the device statistics ref of an instrumented container.
+ *
+ * Instrumented containers pass this type as the `StorageRef` of their device refs, so that the
+ * refs do not need a separate statistics template parameter. Containers with disabled statistics
+ * pass the plain slot storage ref instead.
+ *
+ * @tparam StorageRef Slot storage ref type
+ * @tparam StatsRef Device statistics ref type
+ */
+template <typename StorageRef, typename StatsRef>
+class probe_stats_storage_ref : public StorageRef {
+ public:
+  using stats_ref_type = StatsRef;  ///< Device statistics ref type
+
+  /**
+   * @brief Constructs probe_stats_storage_ref.
+   *
+   * @param storage_ref Non-owning ref of slot storage
+   * @param stats_ref Device statistics ref
+   */
+  __host__ __device__ explicit constexpr probe_stats_storage_ref(StorageRef storage_ref,
+                                                                 StatsRef stats_ref) noexcept
+    : StorageRef{storage_ref}, stats_ref_{stats_ref}
+  {
+  }
+
+  /**
+   * @brief Gets the device statistics ref.
+   *
+   * @return Device statistics ref
+   */
+  [[nodiscard]] __host__ __device__ constexpr stats_ref_type stats_ref() const noexcept
+  {
+    return stats_ref_;
+  }
+
+ private:
+  stats_ref_type stats_ref_;  ///< Device statistics ref
+};
+
+/**
+ * @brief Splits a storage ref into its slot storage ref and device statistics ref types.
+ *
+ * @tparam StorageRef Storage ref type without statistics
+ */
+template <typename StorageRef>
+struct probe_stats_storage_ref_traits {
+  using storage_ref_type = StorageRef;            ///< Slot storage ref type
+  using stats_ref_type   = null_probe_stats_ref;  ///< Device statistics ref type
+
+  /**
+   * @brief Gets the device statistics ref of the given storage ref.
+   *
+   * @return An empty statistics ref
+   */
+  __host__ __device__ static constexpr stats_ref_type stats_ref(StorageRef const&) noexcept
+  {
+    return stats_ref_type{};
+  }
+};
+
+/**
+ * @brief Splits a storage ref into its slot storage ref and device statistics ref types.
+ *
+ * @tparam StorageRef Slot storage ref type
+ * @tparam StatsRef Device statistics ref type
+ */
+template <typename StorageRef, typename StatsRef>
+struct probe_stats_storage_ref_traits<probe_stats_storage_ref<StorageRef, StatsRef>> {
+  using storage_ref_type = StorageRef;  ///< Slot storage ref type
+  using stats_ref_type   = StatsRef;    ///< Device statistics ref type
+
+  /**
+   * @brief Gets the device statistics ref of the given storage ref.
+   *
+   * @param storage_ref Storage ref carrying statistics
+   *
+   * @return Device statistics ref
+   */
+  __host__ __device__ static constexpr stats_ref_type stats_ref(
+    probe_stats_storage_ref<StorageRef, StatsRef> const& storage_ref) noexcept
+  {
+    return storage_ref.stats_ref();
+  }
+};
+
+/**
+ * @brief Statistics storage of a disabled statistics policy.
+ *
+ * @tparam Allocator Type of allocator used for device storage
+ */
+template <class Allocator>
+class null_probe_stats_storage {
+ public:
+  using ref_type = null_probe_stats_ref;  ///< Device statistics ref type
+
+  /**
+   * @brief Constructs an empty statistics storage.
+   */
+  explicit constexpr null_probe_stats_storage(Allocator const&) noexcept {}
+
+  /**
+   * @brief Resets all counters. Does nothing.
+   */
+  void reset(cuda_stream_ref) noexcept {}
+
+  /**
+   * @brief Gets the storage ref passed to device refs, i.e., the given storage ref.
+   *
+   * @tparam StorageRef Slot storage ref type
+   *
+   * @param storage_ref Non-owning ref of slot storage
+   *
+   * @return The given storage ref
+   */
+  template <typename StorageRef>
+  [[nodiscard]] constexpr StorageRef attach(StorageRef storage_ref) const noexcept
+  {
+    return storage_ref;
+  }
+};
+
+/**
+ * @brief Statistics storage of the `probe_stats` policy.
+ *
+ * @tparam NumBins Number of histogram bins
+ * @tparam Allocator Type of allocator used for device storage
+ */
+template <int32_t NumBins, class Allocator>
+class probe_stats_storage {
+ public:
+  using ref_type     = probe_stats_ref<NumBins>;        ///< Device statistics ref type
+  using counter_type = typename ref_type::counter_type;  ///< Device counter type
+  /// Type of the allocator to (de)allocate counters
+  using allocator_type =
+    typename std::allocator_traits<Allocator>::template rebind_alloc<counter_type>;
+
+  /**
+   * @brief Counter deleter owning a copy of the allocator, so that the storage stays valid when
+   * it is moved along with its container.
+   */
+  struct counter_deleter {
+    /**
+     * @brief Deallocates the counters.
+     *
+     * @param ptr Pointer to the counters
+     */
+    void operator()(counter_type* ptr) { allocator_.deallocate(ptr, ref_type::num_counters); }
+
+    allocator_type allocator_;  ///< Allocator used to deallocate the counters
+  };
+
+  /**
+   * @brief Constructs a statistics storage.
+   *
+   * @note The counters are not initialized, `reset` must be called before use.
+   *
+   * @param allocator Allocator used for (de)allocating device storage
+   */
+  explicit probe_stats_storage(Allocator const& allocator)
+    : counters_{allocator_type{allocator}.allocate(ref_type::num_counters),
+                counter_deleter{allocator_type{allocator}}}
+  {
+  }
+
+  /**
+   * @brief Asynchronously resets all counters to zero.
+   *
+   * @param stream CUDA stream used to reset
+   */
+  void reset(cuda_stream_ref stream)
+  {
+    CUCO_CUDA_TRY(cudaMemsetAsync(
+      counters_.get(), 0, sizeof(counter_type) * ref_type::num_counters, stream));
+  }
+
+  /**
+   * @brief Gets the storage ref passed to device refs, i.e., the given storage ref carrying the
+   * device statistics ref.
+   *
+   * @tparam StorageRef Slot storage ref type
+   *
+   * @param storage_ref Non-owning ref of slot storage
+   *
+   * @return Storage ref carrying the device statistics ref
+   */
+  template <typename StorageRef>
+  [[nodiscard]] constexpr auto attach(StorageRef storage_ref) const noexcept
+  {
+    return probe_stats_storage_ref<StorageRef, ref_type>{storage_ref, ref_type{counters_.get()}};
+  }
+
+  /**
+   * @brief Copies the counters to the host.
+   *
+   * @note This API synchronizes the given `stream`.
+   *
+   * @param stream CUDA stream used to copy the counters to the host
+   * @return Probing statistics
+   */
+  [[nodiscard]] probe_stats_summary load_to_host(cuda_stream_ref stream) const
+  {
+    std::vector<counter_type> h_counters(ref_type::num_counters);
+    CUCO_CUDA_TRY(cudaMemcpyAsync(h_counters.data(),
+                                  counters_.get(),
+                                  sizeof(counter_type) * ref_type::num_counters,
+                                  cudaMemcpyDeviceToHost,
+                                  stream));
+    stream.synchronize();
+
+    auto const insert_begin = h_counters.begin();
+    auto const lookup_begin = insert_begin + NumBins;
+    return probe_stats_summary{{insert_begin, lookup_begin},
+                               {lookup_begin, lookup_begin + NumBins},
+                               h_counters[2 * NumBins],
+                               h_counters[2 * NumBins + 1]};
+  }
+
+ private:
+  std::unique_ptr<counter_type, counter_deleter> counters_;  ///< Pointer to the counters
+};
+
+/**
+ * @brief Maps a statistics policy to its storage types.
+ *
+ * @tparam StatsPolicy Statistics policy
+ */
+template <class StatsPolicy>
+struct probe_stats_traits;
+
+/**
+ * @brief Types of the disabled statistics policy.
+ */
+template <>
+struct probe_stats_traits<cuco::experimental::no_probe_stats> {
+  /// Statistics storage type
+  template <class Allocator>
+  using storage_type = null_probe_stats_storage<Allocator>;
+  /// Storage ref type of device refs
+  template <class StorageRef>
+  using storage_ref_type = StorageRef;
+};
+
+/**
+ * @brief Types of the `probe_stats` policy.
+ *
+ * @tparam NumBins Number of histogram bins
+ */
+template <int32_t NumBins>
+struct probe_stats_traits<cuco::experimental::probe_stats<NumBins>> {
+  /// Statistics storage type
+  template <class Allocator>
+  using storage_type = probe_stats_storage<NumBins, Allocator>;
+  /// Storage ref type of device refs
+  template <class StorageRef>
+  using storage_ref_type = probe_stats_storage_ref<StorageRef, probe_stats_ref<NumBins>>;
+};
+
+}  // namespace detail
+}  // namespace experimental
+}  // namespace cuco
@@ -16,8 +16,11 @@
 
 #pragma once
 
+#include <cuco/detail/traits.hpp>
 #include <cuco/detail/utils.cuh>
 
+#include <type_traits>
+
 namespace cuco {
 namespace experimental {
 namespace detail {
@@ -132,12 +135,23 @@ __host__ __device__ constexpr auto double_hashing<CGSize, Hash1, Hash2>::operato
   ProbeKey const& probe_key, Extent upper_bound) const noexcept
 {
   using size_type = typename Extent::value_type;
-  return detail::probing_iterator<Extent>{
-    cuco::detail::sanitize_hash<size_type>(hash1_(probe_key)) % upper_bound,
-    max(size_type{1},
-        cuco::detail::sanitize_hash<size_type>(hash2_(probe_key)) %
-          upper_bound),  // step size in range [1, prime - 1]
-    upper_bound};
+  if constexpr (cuco::detail::is_wide_hash_v<Hash1, ProbeKey>) {
+    // both the initial slot and the step size are derived from a single 128-bit hash
+    auto const hash = hash1_(probe_key);
+    return detail::probing_iterator<Extent>{
+      cuco::detail::sanitize_hash<size_type>(hash[0]) % upper_bound,
+      max(size_type{1},
+          cuco::detail::sanitize_hash<size_type>(hash[1]) %
+            upper_bound),  // step size in range [1, prime - 1]
+      upper_bound};
+  } else {
+    return detail::probing_iterator<Extent>{
+      cuco::detail::sanitize_hash<size_type>(hash1_(probe_key)) % upper_bound,
+      max(size_type{1},
+          cuco::detail::sanitize_hash<size_type>(hash2_(probe_key)) %
+            upper_bound),  // step size in range [1, prime - 1]
+      upper_bound};
+  }
 }
 
 template <int32_t CGSize, typename Hash1, typename Hash2>
@@ -148,13 +162,40 @@ __host__ __device__ constexpr auto double_hashing<CGSize, Hash1, Hash2>::operato
   Extent upper_bound) const noexcept
 {
   using size_type = typename Extent::value_type;
-  return detail::probing_iterator<Extent>{
-    cuco::detail::sanitize_hash<size_type>(hash1_(probe_key) + g.thread_rank()) % upper_bound,
-    static_cast<size_type>((cuco::detail::sanitize_hash<size_type>(hash2_(probe_key)) %
-                              (upper_bound.value() / cg_size - 1) +
-                            1) *
-                           cg_size),
-    upper_bound};  // TODO use fast_int operator
+  if constexpr (cuco::detail::is_wide_hash_v<Hash1, ProbeKey>) {
+    // both the initial slot and the step size are derived from a single 128-bit hash
+    auto const hash = hash1_(probe_key);
+    return detail::probing_iterator<Extent>{
+      cuco::detail::sanitize_hash<size_type>(hash[0] + g.thread_rank()) % upper_bound,
+      static_cast<size_type>(
+        (cuco::detail::sanitize_hash<size_type>(hash[1]) % (upper_bound.value() / cg_size - 1) +
+         1) *
+        cg_size),
+      upper_bound};  // TODO use fast_int operator
+  } else {
+    return detail::probing_iterator<Extent>{
+      cuco::detail::sanitize_hash<size_type>(hash1_(probe_key) + g.thread_rank()) % upper_bound,
+      static_cast<size_type>((cuco::detail::sanitize_hash<size_type>(hash2_(probe_key)) %
+                                (upper_bound.value() / cg_size - 1) +
+                              1) *
+                             cg_size),
+      upper_bound};  // TODO use fast_int operator
+  }
 }
+
+namespace detail {
+/**
+ * @brief Indicates whether the given probing scheme is `linear_probing`.
+ *
+ * @tparam ProbingScheme Type of probing scheme
+ */
+template <typename ProbingScheme>
+struct is_linear_probing : std::false_type {
+};
+
+template <int32_t CGSize, typename Hash>
+struct is_linear_probing<linear_probing<CGSize, Hash>> : std::true_type {
+};
+}  // namespace detail
 }  // namespace experimental
 }  // namespace cuco
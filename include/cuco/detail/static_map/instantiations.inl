@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+// Lookups of keys from `INPUT_IT<KEY>` writing to `OUTPUT_IT`
+#define CUCO_STATIC_MAP_INSTANTIATE_LOOKUP(EXTERN, MAP, KEY, T, INPUT_IT, OUTPUT_IT)               \
+  EXTERN template void MAP<KEY, T>::contains<INPUT_IT<KEY>, OUTPUT_IT<bool>>(                      \
+    INPUT_IT<KEY>, INPUT_IT<KEY>, OUTPUT_IT<bool>, cuco::cuda_stream_ref) const;                   \
+  EXTERN template void MAP<KEY, T>::contains_async<INPUT_IT<KEY>, OUTPUT_IT<bool>>(                \
+    INPUT_IT<KEY>, INPUT_IT<KEY>, OUTPUT_IT<bool>, cuco::cuda_stream_ref) const noexcept;          \
+  EXTERN template void MAP<KEY, T>::find<INPUT_IT<KEY>, OUTPUT_IT<T>>(                             \
+    INPUT_IT<KEY>, INPUT_IT<KEY>, OUTPUT_IT<T>, cuco::cuda_stream_ref) const;                      \
+  EXTERN template void MAP<KEY, T>::find_async<INPUT_IT<KEY>, OUTPUT_IT<T>>(                       \
+    INPUT_IT<KEY>, INPUT_IT<KEY>, OUTPUT_IT<T>, cuco::cuda_stream_ref) const;
+
+// Insertions of pairs from `INPUT_IT<cuco::pair<KEY, T>>` and lookups of keys from `INPUT_IT<KEY>`
+#define CUCO_STATIC_MAP_INSTANTIATE_INPUT(EXTERN, MAP, KEY, T, INPUT_IT)                           \
+  EXTERN template MAP<KEY, T>::size_type MAP<KEY, T>::insert<INPUT_IT<cuco::pair<KEY, T>>>(        \
+    INPUT_IT<cuco::pair<KEY, T>>, INPUT_IT<cuco::pair<KEY, T>>, cuco::cuda_stream_ref);            \
+  EXTERN template void MAP<KEY, T>::insert_async<INPUT_IT<cuco::pair<KEY, T>>>(                    \
+    INPUT_IT<cuco::pair<KEY, T>>, INPUT_IT<cuco::pair<KEY, T>>, cuco::cuda_stream_ref) noexcept;   \
+  CUCO_STATIC_MAP_INSTANTIATE_LOOKUP(EXTERN, MAP, KEY, T, INPUT_IT, detail::pointer)               \
+  CUCO_STATIC_MAP_INSTANTIATE_LOOKUP(EXTERN, MAP, KEY, T, INPUT_IT, detail::device_vector_iterator)
+
+/**
+ * @brief Declares (`EXTERN` is `extern`) or defines (`EXTERN` is empty) the explicit
+ * instantiations of the host bulk operations of `MAP<KEY, T>`.
+ */
+#define CUCO_STATIC_MAP_INSTANTIATE(EXTERN, MAP, KEY, T)                                           \
+  EXTERN template void MAP<KEY, T>::clear(cuco::cuda_stream_ref) noexcept;                         \
+  EXTERN template void MAP<KEY, T>::clear_async(cuco::cuda_stream_ref) noexcept;                   \
+  EXTERN template MAP<KEY, T>::size_type MAP<KEY, T>::size(cuco::cuda_stream_ref) const noexcept;  \
+  EXTERN template std::pair<detail::pointer<KEY>, detail::pointer<T>>                              \
+  MAP<KEY, T>::retrieve_all<detail::pointer<KEY>, detail::pointer<T>>(                             \
+    detail::pointer<KEY>, detail::pointer<T>, cuco::cuda_stream_ref) const;                        \
+  EXTERN template std::pair<detail::device_vector_iterator<KEY>,                                   \
+                            detail::device_vector_iterator<T>>                                     \
+  MAP<KEY, T>::retrieve_all<detail::device_vector_iterator<KEY>,                                   \
+                            detail::device_vector_iterator<T>>(                                    \
+    detail::device_vector_iterator<KEY>, detail::device_vector_iterator<T>, cuco::cuda_stream_ref) \
+    const;                                                                                         \
+  CUCO_STATIC_MAP_INSTANTIATE_INPUT(EXTERN, MAP, KEY, T, detail::const_pointer)                    \
+  CUCO_STATIC_MAP_INSTANTIATE_INPUT(EXTERN, MAP, KEY, T, detail::pointer)                          \
+  CUCO_STATIC_MAP_INSTANTIATE_INPUT(EXTERN, MAP, KEY, T, detail::device_vector_iterator)           \
+  CUCO_STATIC_MAP_INSTANTIATE_INPUT(EXTERN, MAP, KEY, T, detail::device_vector_const_iterator)
+
+/// All `static_map` types precompiled by `cuco_instantiations`
+#define CUCO_STATIC_MAP_INSTANTIATIONS(EXTERN)                                                     \
+  CUCO_STATIC_MAP_INSTANTIATE(EXTERN, static_map, std::int32_t, std::int32_t)                      \
+  CUCO_STATIC_MAP_INSTANTIATE(EXTERN, static_map, std::int64_t, std::int64_t)                      \
+  CUCO_STATIC_MAP_INSTANTIATE(EXTERN, linear_probing_static_map, std::int32_t, std::int32_t)       \
+  CUCO_STATIC_MAP_INSTANTIATE(EXTERN, linear_probing_static_map, std::int64_t, std::int64_t)
+
+#if defined(CUCO_EXTERN_INSTANTIATIONS)
+#include <cuco/detail/instantiations.cuh>
+
+namespace cuco {
+namespace experimental {
+CUCO_STATIC_MAP_INSTANTIATIONS(extern)
+}  // namespace experimental
+}  // namespace cuco
+#endif
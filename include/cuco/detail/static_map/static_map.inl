@@ -23,6 +23,8 @@
 #include <cuco/static_map_ref.cuh>
 
 #include <cstddef>
+#include <memory>
+#include <utility>
 
 namespace cuco {
 namespace experimental {
@@ -34,16 +36,25 @@ template <class Key,
           class KeyEqual,
           class ProbingScheme,
           class Allocator,
-          class Storage>
-constexpr static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
-  static_map(Extent capacity,
-             empty_key<Key> empty_key_sentinel,
-             empty_value<T> empty_value_sentinel,
-             KeyEqual const& pred,
-             ProbingScheme const& probing_scheme,
-             Allocator const& alloc,
-             cuda_stream_ref stream)
-  : impl_{std::make_unique<impl_type>(capacity,
+          class Storage,
+          class StatsPolicy>
+constexpr static_map<Key,
+                     T,
+                     Extent,
+                     Scope,
+                     KeyEqual,
+                     ProbingScheme,
+                     Allocator,
+                     Storage,
+                     StatsPolicy>::static_map(Extent capacity,
+                                              empty_key<Key> empty_key_sentinel,
+                                              empty_value<T> empty_value_sentinel,
+                                              KeyEqual const& pred,
+                                              ProbingScheme const& probing_scheme,
+                                              Allocator const& alloc,
+                                              cuda_stream_ref stream)
+  : stats_storage_type{alloc},
+    impl_{std::make_unique<impl_type>(capacity,
                                       empty_key_sentinel,
                                       cuco::pair{empty_key_sentinel, empty_value_sentinel},
                                       pred,
@@ -52,6 +63,7 @@ constexpr static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator,
                                       stream)},
     empty_value_sentinel_{empty_value_sentinel}
 {
+  stats_storage_type::reset(stream);
 }
 
 template <class Key,
@@ -61,9 +73,17 @@ template <class Key,
           class KeyEqual,
           class ProbingScheme,
           class Allocator,
-          class Storage>
-void static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::clear(
-  cuda_stream_ref stream) noexcept
+          class Storage,
+          class StatsPolicy>
+void static_map<Key,
+                T,
+                Extent,
+                Scope,
+                KeyEqual,
+                ProbingScheme,
+                Allocator,
+                Storage,
+                StatsPolicy>::clear(cuda_stream_ref stream) noexcept
 {
   impl_->clear(stream);
 }
@@ -75,9 +95,17 @@ template <class Key,
           class KeyEqual,
           class ProbingScheme,
           class Allocator,
-          class Storage>
-void static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::clear_async(
-  cuda_stream_ref stream) noexcept
+          class Storage,
+          class StatsPolicy>
+void static_map<Key,
+                T,
+                Extent,
+                Scope,
+                KeyEqual,
+                ProbingScheme,
+                Allocator,
+                Storage,
+                StatsPolicy>::clear_async(cuda_stream_ref stream) noexcept
 {
   impl_->clear_async(stream);
 }
@@ -89,10 +117,19 @@ template <class Key,
           class KeyEqual,
           class ProbingScheme,
           class Allocator,
-          class Storage>
+          class Storage,
+          class StatsPolicy>
 template <typename InputIt>
-static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::size_type
-static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::insert(
+static_map<Key,
+           T,
+           Extent,
+           Scope,
+           KeyEqual,
+           ProbingScheme,
+           Allocator,
+           Storage,
+           StatsPolicy>::size_type
+static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage, StatsPolicy>::insert(
   InputIt first, InputIt last, cuda_stream_ref stream)
 {
   return impl_->insert(first, last, ref(op::insert), stream);
@@ -105,9 +142,18 @@ template <class Key,
           class KeyEqual,
           class ProbingScheme,
           class Allocator,
-          class Storage>
+          class Storage,
+          class StatsPolicy>
 template <typename InputIt>
-void static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::insert_async(
+void static_map<Key,
+                T,
+                Extent,
+                Scope,
+                KeyEqual,
+                ProbingScheme,
+                Allocator,
+                Storage,
+                StatsPolicy>::insert_async(
   InputIt first, InputIt last, cuda_stream_ref stream) noexcept
 {
   impl_->insert_async(first, last, ref(op::insert), stream);
@@ -120,10 +166,27 @@ template <class Key,
           class KeyEqual,
           class ProbingScheme,
           class Allocator,
-          class Storage>
+          class Storage,
+          class StatsPolicy>
 template <typename InputIt, typename StencilIt, typename Predicate>
-static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::size_type
-static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::insert_if(
+static_map<Key,
+           T,
+           Extent,
+           Scope,
+           KeyEqual,
+           ProbingScheme,
+           Allocator,
+           Storage,
+           StatsPolicy>::size_type
+static_map<Key,
+           T,
+           Extent,
+           Scope,
+           KeyEqual,
+           ProbingScheme,
+           Allocator,
+           Storage,
+           StatsPolicy>::insert_if(
   InputIt first, InputIt last, StencilIt stencil, Predicate pred, cuda_stream_ref stream)
 {
   return impl_->insert_if(first, last, stencil, pred, ref(op::insert), stream);
@@ -136,9 +199,10 @@ template <class Key,
           class KeyEqual,
           class ProbingScheme,
           class Allocator,
-          class Storage>
+          class Storage,
+          class StatsPolicy>
 template <typename InputIt, typename StencilIt, typename Predicate>
-void static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+void static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage, StatsPolicy>::
   insert_if_async(
     InputIt first, InputIt last, StencilIt stencil, Predicate pred, cuda_stream_ref stream) noexcept
 {
@@ -152,11 +216,21 @@ template <class Key,
           class KeyEqual,
           class ProbingScheme,
           class Allocator,
-          class Storage>
+          class Storage,
+          class StatsPolicy>
 template <typename InputIt, typename OutputIt>
-void static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::contains(
+void static_map<Key,
+                T,
+                Extent,
+                Scope,
+                KeyEqual,
+                ProbingScheme,
+                Allocator,
+                Storage,
+                StatsPolicy>::contains(
   InputIt first, InputIt last, OutputIt output_begin, cuda_stream_ref stream) const
 {
+  auto const scope = impl_->trace("contains", cuco::detail::distance(first, last), stream);
   contains_async(first, last, output_begin, stream);
   stream.synchronize();
 }
@@ -168,9 +242,18 @@ template <class Key,
           class KeyEqual,
           class ProbingScheme,
           class Allocator,
-          class Storage>
+          class Storage,
+          class StatsPolicy>
 template <typename InputIt, typename OutputIt>
-void static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::contains_async(
+void static_map<Key,
+                T,
+                Extent,
+                Scope,
+                KeyEqual,
+                ProbingScheme,
+                Allocator,
+                Storage,
+                StatsPolicy>::contains_async(
   InputIt first, InputIt last, OutputIt output_begin, cuda_stream_ref stream) const noexcept
 {
   impl_->contains_async(first, last, output_begin, ref(op::contains), stream);
@@ -183,9 +266,18 @@ template <class Key,
           class KeyEqual,
           class ProbingScheme,
           class Allocator,
-          class Storage>
+          class Storage,
+          class StatsPolicy>
 template <typename InputIt, typename StencilIt, typename Predicate, typename OutputIt>
-void static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::contains_if(
+void static_map<Key,
+                T,
+                Extent,
+                Scope,
+                KeyEqual,
+                ProbingScheme,
+                Allocator,
+                Storage,
+                StatsPolicy>::contains_if(
   InputIt first,
   InputIt last,
   StencilIt stencil,
@@ -193,6 +285,7 @@ void static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Stora
   OutputIt output_begin,
   cuda_stream_ref stream) const
 {
+  auto const scope = impl_->trace("contains_if", cuco::detail::distance(first, last), stream);
   contains_if_async(first, last, stencil, pred, output_begin, stream);
   stream.synchronize();
 }
@@ -204,9 +297,10 @@ template <class Key,
           class KeyEqual,
           class ProbingScheme,
           class Allocator,
-          class Storage>
+          class Storage,
+          class StatsPolicy>
 template <typename InputIt, typename StencilIt, typename Predicate, typename OutputIt>
-void static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+void static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage, StatsPolicy>::
   contains_if_async(InputIt first,
                     InputIt last,
                     StencilIt stencil,
@@ -224,11 +318,21 @@ template <class Key,
           class KeyEqual,
           class ProbingScheme,
           class Allocator,
-          class Storage>
+          class Storage,
+          class StatsPolicy>
 template <typename InputIt, typename OutputIt>
-void static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::find(
+void static_map<Key,
+                T,
+                Extent,
+                Scope,
+                KeyEqual,
+                ProbingScheme,
+                Allocator,
+                Storage,
+                StatsPolicy>::find(
   InputIt first, InputIt last, OutputIt output_begin, cuda_stream_ref stream) const
 {
+  auto const scope = impl_->trace("find", cuco::detail::distance(first, last), stream);
   find_async(first, last, output_begin, stream);
   stream.synchronize();
 }
@@ -240,12 +344,22 @@ template <class Key,
           class KeyEqual,
           class ProbingScheme,
           class Allocator,
-          class Storage>
+          class Storage,
+          class StatsPolicy>
 template <typename InputIt, typename OutputIt>
-void static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::find_async(
+void static_map<Key,
+                T,
+                Extent,
+                Scope,
+                KeyEqual,
+                ProbingScheme,
+                Allocator,
+                Storage,
+                StatsPolicy>::find_async(
   InputIt first, InputIt last, OutputIt output_begin, cuda_stream_ref stream) const
 {
   auto const num_keys = cuco::detail::distance(first, last);
+  auto const scope    = impl_->trace("find_async", num_keys, stream);
   if (num_keys == 0) { return; }
 
   auto const grid_size =
@@ -264,10 +378,19 @@ template <class Key,
           class KeyEqual,
           class ProbingScheme,
           class Allocator,
-          class Storage>
+          class Storage,
+          class StatsPolicy>
 template <typename KeyOut, typename ValueOut>
 std::pair<KeyOut, ValueOut>
-static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::retrieve_all(
+static_map<Key,
+           T,
+           Extent,
+           Scope,
+           KeyEqual,
+           ProbingScheme,
+           Allocator,
+           Storage,
+           StatsPolicy>::retrieve_all(
   KeyOut keys_out, ValueOut values_out, cuda_stream_ref stream) const
 {
   auto const begin = thrust::make_transform_iterator(
@@ -288,9 +411,18 @@ template <class Key,
           class KeyEqual,
           class ProbingScheme,
           class Allocator,
-          class Storage>
-static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::size_type
-static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::size(
+          class Storage,
+          class StatsPolicy>
+static_map<Key,
+           T,
+           Extent,
+           Scope,
+           KeyEqual,
+           ProbingScheme,
+           Allocator,
+           Storage,
+           StatsPolicy>::size_type
+static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage, StatsPolicy>::size(
   cuda_stream_ref stream) const noexcept
 {
   auto const is_filled = static_map_ns::detail::slot_is_filled<Key, T>(this->empty_key_sentinel());
@@ -304,10 +436,64 @@ template <class Key,
           class KeyEqual,
           class ProbingScheme,
           class Allocator,
-          class Storage>
+          class Storage,
+          class StatsPolicy>
+table_analysis static_map<Key,
+                          T,
+                          Extent,
+                          Scope,
+                          KeyEqual,
+                          ProbingScheme,
+                          Allocator,
+                          Storage,
+                          StatsPolicy>::analyze(cuda_stream_ref stream) const
+{
+  auto const is_filled = static_map_ns::detail::slot_is_filled<Key, T>(this->empty_key_sentinel());
+  return impl_->template analyze<key_type>(is_filled, stream);
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage,
+          class StatsPolicy>
+void static_map<Key,
+                T,
+                Extent,
+                Scope,
+                KeyEqual,
+                ProbingScheme,
+                Allocator,
+                Storage,
+                StatsPolicy>::set_tracer(std::shared_ptr<tracer> tracer)
+{
+  auto const is_filled = static_map_ns::detail::slot_is_filled<Key, T>(this->empty_key_sentinel());
+  impl_->set_tracer(std::move(tracer), is_filled);
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage,
+          class StatsPolicy>
 constexpr auto
-static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::capacity()
-  const noexcept
+static_map<Key,
+           T,
+           Extent,
+           Scope,
+           KeyEqual,
+           ProbingScheme,
+           Allocator,
+           Storage,
+           StatsPolicy>::capacity() const noexcept
 {
   return impl_->capacity();
 }
@@ -319,10 +505,26 @@ template <class Key,
           class KeyEqual,
           class ProbingScheme,
           class Allocator,
-          class Storage>
-constexpr static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::key_type
-static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::empty_key_sentinel()
-  const noexcept
+          class Storage,
+          class StatsPolicy>
+constexpr static_map<Key,
+                     T,
+                     Extent,
+                     Scope,
+                     KeyEqual,
+                     ProbingScheme,
+                     Allocator,
+                     Storage,
+                     StatsPolicy>::key_type
+static_map<Key,
+           T,
+           Extent,
+           Scope,
+           KeyEqual,
+           ProbingScheme,
+           Allocator,
+           Storage,
+           StatsPolicy>::empty_key_sentinel() const noexcept
 {
   return impl_->empty_key_sentinel();
 }
@@ -334,11 +536,19 @@ template <class Key,
           class KeyEqual,
           class ProbingScheme,
           class Allocator,
-          class Storage>
-constexpr static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
-  mapped_type
-  static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
-    empty_value_sentinel() const noexcept
+          class Storage,
+          class StatsPolicy>
+constexpr static_map<Key,
+                     T,
+                     Extent,
+                     Scope,
+                     KeyEqual,
+                     ProbingScheme,
+                     Allocator,
+                     Storage,
+                     StatsPolicy>::mapped_type
+static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage, StatsPolicy>::
+  empty_value_sentinel() const noexcept
 {
   return this->empty_value_sentinel_;
 }
@@ -350,17 +560,64 @@ template <class Key,
           class KeyEqual,
           class ProbingScheme,
           class Allocator,
-          class Storage>
+          class Storage,
+          class StatsPolicy>
+probe_stats_summary
+static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage, StatsPolicy>::stats(
+  cuda_stream_ref stream) const
+{
+  static_assert(StatsPolicy::enabled, "Probing statistics are disabled by the StatsPolicy.");
+  return stats_storage_type::load_to_host(stream);
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage,
+          class StatsPolicy>
+void static_map<Key,
+                T,
+                Extent,
+                Scope,
+                KeyEqual,
+                ProbingScheme,
+                Allocator,
+                Storage,
+                StatsPolicy>::reset_stats(cuda_stream_ref stream)
+{
+  stats_storage_type::reset(stream);
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage,
+          class StatsPolicy>
 template <typename... Operators>
-auto static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::ref(
-  Operators...) const noexcept
+auto static_map<Key,
+                T,
+                Extent,
+                Scope,
+                KeyEqual,
+                ProbingScheme,
+                Allocator,
+                Storage,
+                StatsPolicy>::ref(Operators...) const noexcept
 {
   static_assert(sizeof...(Operators), "No operators specified");
   return ref_type<Operators...>{cuco::empty_key<key_type>(this->empty_key_sentinel()),
                                 cuco::empty_value<mapped_type>(this->empty_value_sentinel()),
                                 impl_->key_eq(),
                                 impl_->probing_scheme(),
-                                impl_->storage_ref()};
+                                stats_storage_type::attach(impl_->storage_ref())};
 }
 }  // namespace experimental
 }  // namespace cuco
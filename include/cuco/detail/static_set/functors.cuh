@@ -17,6 +17,8 @@
 
 #include <cuco/detail/bitwise_compare.cuh>
 
+#include <thrust/tuple.h>
+
 namespace cuco {
 namespace experimental {
 namespace static_set_ns {
@@ -53,6 +55,29 @@ struct slot_is_filled {
   }
 };
 
+/**
+ * @brief Device functor building a composite key from a tuple of its two elements.
+ *
+ * @tparam Key The composite key type, constructible from its two elements
+ */
+template <typename Key>
+struct make_composite_key {
+  /**
+   * @brief Builds the composite key made of the two elements of `elements`.
+   *
+   * @tparam Tuple Tuple type, e.g., the element of a `thrust::zip_iterator`
+   *
+   * @param elements The elements of the key
+   *
+   * @return The composite key
+   */
+  template <typename Tuple>
+  __host__ __device__ constexpr Key operator()(Tuple const& elements) const noexcept
+  {
+    return Key{thrust::get<0>(elements), thrust::get<1>(elements)};
+  }
+};
+
 }  // namespace detail
 }  // namespace static_set_ns
 }  // namespace experimental
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+// Lookups of keys from `INPUT_IT<KEY>` writing to `OUTPUT_IT`
+#define CUCO_STATIC_SET_INSTANTIATE_LOOKUP(EXTERN, SET, KEY, INPUT_IT, OUTPUT_IT)                  \
+  EXTERN template void SET<KEY>::contains<INPUT_IT<KEY>, OUTPUT_IT<bool>>(                         \
+    INPUT_IT<KEY>, INPUT_IT<KEY>, OUTPUT_IT<bool>, cuco::cuda_stream_ref) const;                   \
+  EXTERN template void SET<KEY>::contains_async<INPUT_IT<KEY>, OUTPUT_IT<bool>>(                   \
+    INPUT_IT<KEY>, INPUT_IT<KEY>, OUTPUT_IT<bool>, cuco::cuda_stream_ref) const noexcept;          \
+  EXTERN template void SET<KEY>::find<INPUT_IT<KEY>, OUTPUT_IT<KEY>>(                              \
+    INPUT_IT<KEY>, INPUT_IT<KEY>, OUTPUT_IT<KEY>, cuco::cuda_stream_ref) const;                    \
+  EXTERN template void SET<KEY>::find_async<INPUT_IT<KEY>, OUTPUT_IT<KEY>>(                        \
+    INPUT_IT<KEY>, INPUT_IT<KEY>, OUTPUT_IT<KEY>, cuco::cuda_stream_ref) const;
+
+// Insertions and lookups of keys from `INPUT_IT<KEY>`
+#define CUCO_STATIC_SET_INSTANTIATE_INPUT(EXTERN, SET, KEY, INPUT_IT)                              \
+  EXTERN template SET<KEY>::size_type SET<KEY>::insert<INPUT_IT<KEY>>(                             \
+    INPUT_IT<KEY>, INPUT_IT<KEY>, cuco::cuda_stream_ref);                                          \
+  EXTERN template void SET<KEY>::insert_async<INPUT_IT<KEY>>(                                      \
+    INPUT_IT<KEY>, INPUT_IT<KEY>, cuco::cuda_stream_ref) noexcept;                                 \
+  CUCO_STATIC_SET_INSTANTIATE_LOOKUP(EXTERN, SET, KEY, INPUT_IT, detail::pointer)                  \
+  CUCO_STATIC_SET_INSTANTIATE_LOOKUP(EXTERN, SET, KEY, INPUT_IT, detail::device_vector_iterator)
+
+/**
+ * @brief Declares (`EXTERN` is `extern`) or defines (`EXTERN` is empty) the explicit
+ * instantiations of the host bulk operations of `SET<KEY>`.
+ */
+#define CUCO_STATIC_SET_INSTANTIATE(EXTERN, SET, KEY)                                              \
+  EXTERN template void SET<KEY>::clear(cuco::cuda_stream_ref) noexcept;                            \
+  EXTERN template void SET<KEY>::clear_async(cuco::cuda_stream_ref) noexcept;                      \
+  EXTERN template SET<KEY>::size_type SET<KEY>::size(cuco::cuda_stream_ref) const noexcept;        \
+  EXTERN template detail::pointer<KEY> SET<KEY>::retrieve_all<detail::pointer<KEY>>(               \
+    detail::pointer<KEY>, cuco::cuda_stream_ref) const;                                            \
+  EXTERN template detail::device_vector_iterator<KEY>                                              \
+  SET<KEY>::retrieve_all<detail::device_vector_iterator<KEY>>(detail::device_vector_iterator<KEY>, \
+                                                              cuco::cuda_stream_ref) const;        \
+  CUCO_STATIC_SET_INSTANTIATE_INPUT(EXTERN, SET, KEY, detail::const_pointer)                       \
+  CUCO_STATIC_SET_INSTANTIATE_INPUT(EXTERN, SET, KEY, detail::pointer)                             \
+  CUCO_STATIC_SET_INSTANTIATE_INPUT(EXTERN, SET, KEY, detail::device_vector_iterator)              \
+  CUCO_STATIC_SET_INSTANTIATE_INPUT(EXTERN, SET, KEY, detail::device_vector_const_iterator)
+
+/// All `static_set` types precompiled by `cuco_instantiations`
+#define CUCO_STATIC_SET_INSTANTIATIONS(EXTERN)                                                     \
+  CUCO_STATIC_SET_INSTANTIATE(EXTERN, static_set, std::int32_t)                                    \
+  CUCO_STATIC_SET_INSTANTIATE(EXTERN, static_set, std::int64_t)                                    \
+  CUCO_STATIC_SET_INSTANTIATE(EXTERN, linear_probing_static_set, std::int32_t)                     \
+  CUCO_STATIC_SET_INSTANTIATE(EXTERN, linear_probing_static_set, std::int64_t)
+
+#if defined(CUCO_EXTERN_INSTANTIATIONS)
+#include <cuco/detail/instantiations.cuh>
+
+namespace cuco {
+namespace experimental {
+CUCO_STATIC_SET_INSTANTIATIONS(extern)
+}  // namespace experimental
+}  // namespace cuco
+#endif
@@ -22,7 +22,13 @@
 #include <cuco/operator.hpp>
 #include <cuco/static_set_ref.cuh>
 
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/tuple.h>
+
 #include <cstddef>
+#include <memory>
+#include <utility>
 
 namespace cuco {
 namespace experimental {
@@ -33,17 +39,27 @@ template <class Key,
           class KeyEqual,
           class ProbingScheme,
           class Allocator,
-          class Storage>
-constexpr static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::static_set(
+          class Storage,
+          class StatsPolicy>
+constexpr static_set<Key,
+                     Extent,
+                     Scope,
+                     KeyEqual,
+                     ProbingScheme,
+                     Allocator,
+                     Storage,
+                     StatsPolicy>::static_set(
   Extent capacity,
   empty_key<Key> empty_key_sentinel,
   KeyEqual const& pred,
   ProbingScheme const& probing_scheme,
   Allocator const& alloc,
   cuda_stream_ref stream)
-  : impl_{std::make_unique<impl_type>(
+  : stats_storage_type{alloc},
+    impl_{std::make_unique<impl_type>(
       capacity, empty_key_sentinel, empty_key_sentinel, pred, probing_scheme, alloc, stream)}
 {
+  stats_storage_type::reset(stream);
 }
 
 template <class Key,
@@ -52,9 +68,16 @@ template <class Key,
           class KeyEqual,
           class ProbingScheme,
           class Allocator,
-          class Storage>
-void static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::clear(
-  cuda_stream_ref stream) noexcept
+          class Storage,
+          class StatsPolicy>
+void static_set<Key,
+                Extent,
+                Scope,
+                KeyEqual,
+                ProbingScheme,
+                Allocator,
+                Storage,
+                StatsPolicy>::clear(cuda_stream_ref stream) noexcept
 {
   impl_->clear(stream);
 }
@@ -65,9 +88,16 @@ template <class Key,
           class KeyEqual,
           class ProbingScheme,
           class Allocator,
-          class Storage>
-void static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::clear_async(
-  cuda_stream_ref stream) noexcept
+          class Storage,
+          class StatsPolicy>
+void static_set<Key,
+                Extent,
+                Scope,
+                KeyEqual,
+                ProbingScheme,
+                Allocator,
+                Storage,
+                StatsPolicy>::clear_async(cuda_stream_ref stream) noexcept
 {
   impl_->clear_async(stream);
 }
@@ -78,10 +108,11 @@ template <class Key,
           class KeyEqual,
           class ProbingScheme,
           class Allocator,
-          class Storage>
+          class Storage,
+          class StatsPolicy>
 template <typename InputIt>
-static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::size_type
-static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::insert(
+static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage, StatsPolicy>::size_type
+static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage, StatsPolicy>::insert(
   InputIt first, InputIt last, cuda_stream_ref stream)
 {
   return impl_->insert(first, last, ref(op::insert), stream);
@@ -93,9 +124,17 @@ template <class Key,
           class KeyEqual,
           class ProbingScheme,
           class Allocator,
-          class Storage>
+          class Storage,
+          class StatsPolicy>
 template <typename InputIt>
-void static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::insert_async(
+void static_set<Key,
+                Extent,
+                Scope,
+                KeyEqual,
+                ProbingScheme,
+                Allocator,
+                Storage,
+                StatsPolicy>::insert_async(
   InputIt first, InputIt last, cuda_stream_ref stream) noexcept
 {
   impl_->insert_async(first, last, ref(op::insert), stream);
@@ -107,10 +146,30 @@ template <class Key,
           class KeyEqual,
           class ProbingScheme,
           class Allocator,
-          class Storage>
+          class Storage,
+          class StatsPolicy>
+template <typename FirstIt, typename SecondIt, typename>
+static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage, StatsPolicy>::size_type
+static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage, StatsPolicy>::insert(
+  FirstIt first_begin, FirstIt first_end, SecondIt second_begin, cuda_stream_ref stream)
+{
+  auto const keys = thrust::make_transform_iterator(
+    thrust::make_zip_iterator(thrust::make_tuple(first_begin, second_begin)),
+    static_set_ns::detail::make_composite_key<key_type>{});
+  return this->insert(keys, keys + cuco::detail::distance(first_begin, first_end), stream);
+}
+
+template <class Key,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage,
+          class StatsPolicy>
 template <typename InputIt, typename StencilIt, typename Predicate>
-static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::size_type
-static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::insert_if(
+static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage, StatsPolicy>::size_type
+static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage, StatsPolicy>::insert_if(
   InputIt first, InputIt last, StencilIt stencil, Predicate pred, cuda_stream_ref stream)
 {
   return impl_->insert_if(first, last, stencil, pred, ref(op::insert), stream);
@@ -122,9 +181,17 @@ template <class Key,
           class KeyEqual,
           class ProbingScheme,
           class Allocator,
-          class Storage>
+          class Storage,
+          class StatsPolicy>
 template <typename InputIt, typename StencilIt, typename Predicate>
-void static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::insert_if_async(
+void static_set<Key,
+                Extent,
+                Scope,
+                KeyEqual,
+                ProbingScheme,
+                Allocator,
+                Storage,
+                StatsPolicy>::insert_if_async(
   InputIt first, InputIt last, StencilIt stencil, Predicate pred, cuda_stream_ref stream) noexcept
 {
   impl_->insert_if_async(first, last, stencil, pred, ref(op::insert), stream);
@@ -136,11 +203,20 @@ template <class Key,
           class KeyEqual,
           class ProbingScheme,
           class Allocator,
-          class Storage>
+          class Storage,
+          class StatsPolicy>
 template <typename InputIt, typename OutputIt>
-void static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::contains(
+void static_set<Key,
+                Extent,
+                Scope,
+                KeyEqual,
+                ProbingScheme,
+                Allocator,
+                Storage,
+                StatsPolicy>::contains(
   InputIt first, InputIt last, OutputIt output_begin, cuda_stream_ref stream) const
 {
+  auto const scope = impl_->trace("contains", cuco::detail::distance(first, last), stream);
   contains_async(first, last, output_begin, stream);
   stream.synchronize();
 }
@@ -151,9 +227,17 @@ template <class Key,
           class KeyEqual,
           class ProbingScheme,
           class Allocator,
-          class Storage>
+          class Storage,
+          class StatsPolicy>
 template <typename InputIt, typename OutputIt>
-void static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::contains_async(
+void static_set<Key,
+                Extent,
+                Scope,
+                KeyEqual,
+                ProbingScheme,
+                Allocator,
+                Storage,
+                StatsPolicy>::contains_async(
   InputIt first, InputIt last, OutputIt output_begin, cuda_stream_ref stream) const noexcept
 {
   impl_->contains_async(first, last, output_begin, ref(op::contains), stream);
@@ -165,9 +249,40 @@ template <class Key,
           class KeyEqual,
           class ProbingScheme,
           class Allocator,
-          class Storage>
+          class Storage,
+          class StatsPolicy>
+template <typename FirstIt, typename SecondIt, typename OutputIt, typename>
+void static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage, StatsPolicy>::
+  contains(FirstIt first_begin,
+           FirstIt first_end,
+           SecondIt second_begin,
+           OutputIt output_begin,
+           cuda_stream_ref stream) const
+{
+  auto const keys = thrust::make_transform_iterator(
+    thrust::make_zip_iterator(thrust::make_tuple(first_begin, second_begin)),
+    static_set_ns::detail::make_composite_key<key_type>{});
+  this->contains(
+    keys, keys + cuco::detail::distance(first_begin, first_end), output_begin, stream);
+}
+
+template <class Key,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage,
+          class StatsPolicy>
 template <typename InputIt, typename StencilIt, typename Predicate, typename OutputIt>
-void static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::contains_if(
+void static_set<Key,
+                Extent,
+                Scope,
+                KeyEqual,
+                ProbingScheme,
+                Allocator,
+                Storage,
+                StatsPolicy>::contains_if(
   InputIt first,
   InputIt last,
   StencilIt stencil,
@@ -175,6 +290,7 @@ void static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>
   OutputIt output_begin,
   cuda_stream_ref stream) const
 {
+  auto const scope = impl_->trace("contains_if", cuco::detail::distance(first, last), stream);
   contains_if_async(first, last, stencil, pred, output_begin, stream);
   stream.synchronize();
 }
@@ -185,9 +301,17 @@ template <class Key,
           class KeyEqual,
           class ProbingScheme,
           class Allocator,
-          class Storage>
+          class Storage,
+          class StatsPolicy>
 template <typename InputIt, typename StencilIt, typename Predicate, typename OutputIt>
-void static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::contains_if_async(
+void static_set<Key,
+                Extent,
+                Scope,
+                KeyEqual,
+                ProbingScheme,
+                Allocator,
+                Storage,
+                StatsPolicy>::contains_if_async(
   InputIt first,
   InputIt last,
   StencilIt stencil,
@@ -204,11 +328,13 @@ template <class Key,
           class KeyEqual,
           class ProbingScheme,
           class Allocator,
-          class Storage>
+          class Storage,
+          class StatsPolicy>
 template <typename InputIt, typename OutputIt>
-void static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::find(
+void static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage, StatsPolicy>::find(
   InputIt first, InputIt last, OutputIt output_begin, cuda_stream_ref stream) const
 {
+  auto const scope = impl_->trace("find", cuco::detail::distance(first, last), stream);
   find_async(first, last, output_begin, stream);
   stream.synchronize();
 }
@@ -219,12 +345,21 @@ template <class Key,
           class KeyEqual,
           class ProbingScheme,
           class Allocator,
-          class Storage>
+          class Storage,
+          class StatsPolicy>
 template <typename InputIt, typename OutputIt>
-void static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::find_async(
+void static_set<Key,
+                Extent,
+                Scope,
+                KeyEqual,
+                ProbingScheme,
+                Allocator,
+                Storage,
+                StatsPolicy>::find_async(
   InputIt first, InputIt last, OutputIt output_begin, cuda_stream_ref stream) const
 {
   auto const num_keys = cuco::detail::distance(first, last);
+  auto const scope    = impl_->trace("find_async", num_keys, stream);
   if (num_keys == 0) { return; }
 
   auto const grid_size =
@@ -242,10 +377,17 @@ template <class Key,
           class KeyEqual,
           class ProbingScheme,
           class Allocator,
-          class Storage>
+          class Storage,
+          class StatsPolicy>
 template <typename OutputIt>
-OutputIt static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::retrieve_all(
-  OutputIt output_begin, cuda_stream_ref stream) const
+OutputIt static_set<Key,
+                    Extent,
+                    Scope,
+                    KeyEqual,
+                    ProbingScheme,
+                    Allocator,
+                    Storage,
+                    StatsPolicy>::retrieve_all(OutputIt output_begin, cuda_stream_ref stream) const
 {
   auto const begin =
     thrust::make_transform_iterator(thrust::counting_iterator<size_type>{0},
@@ -261,9 +403,10 @@ template <class Key,
           class KeyEqual,
           class ProbingScheme,
           class Allocator,
-          class Storage>
-static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::size_type
-static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::size(
+          class Storage,
+          class StatsPolicy>
+static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage, StatsPolicy>::size_type
+static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage, StatsPolicy>::size(
   cuda_stream_ref stream) const noexcept
 {
   auto const is_filled = static_set_ns::detail::slot_is_filled(this->empty_key_sentinel());
@@ -276,9 +419,47 @@ template <class Key,
           class KeyEqual,
           class ProbingScheme,
           class Allocator,
-          class Storage>
+          class Storage,
+          class StatsPolicy>
+table_analysis
+static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage, StatsPolicy>::analyze(
+  cuda_stream_ref stream) const
+{
+  auto const is_filled = static_set_ns::detail::slot_is_filled(this->empty_key_sentinel());
+  return impl_->template analyze<key_type>(is_filled, stream);
+}
+
+template <class Key,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage,
+          class StatsPolicy>
+void static_set<Key,
+                Extent,
+                Scope,
+                KeyEqual,
+                ProbingScheme,
+                Allocator,
+                Storage,
+                StatsPolicy>::set_tracer(std::shared_ptr<tracer> tracer)
+{
+  auto const is_filled = static_set_ns::detail::slot_is_filled(this->empty_key_sentinel());
+  impl_->set_tracer(std::move(tracer), is_filled);
+}
+
+template <class Key,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage,
+          class StatsPolicy>
 constexpr auto
-static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::capacity()
+static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage, StatsPolicy>::capacity()
   const noexcept
 {
   return impl_->capacity();
@@ -290,10 +471,18 @@ template <class Key,
           class KeyEqual,
           class ProbingScheme,
           class Allocator,
-          class Storage>
-constexpr static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::key_type
-static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::empty_key_sentinel()
-  const noexcept
+          class Storage,
+          class StatsPolicy>
+constexpr static_set<Key,
+                     Extent,
+                     Scope,
+                     KeyEqual,
+                     ProbingScheme,
+                     Allocator,
+                     Storage,
+                     StatsPolicy>::key_type
+static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage, StatsPolicy>::
+  empty_key_sentinel() const noexcept
 {
   return impl_->empty_key_sentinel();
 }
@@ -304,16 +493,53 @@ template <class Key,
           class KeyEqual,
           class ProbingScheme,
           class Allocator,
-          class Storage>
+          class Storage,
+          class StatsPolicy>
+probe_stats_summary
+static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage, StatsPolicy>::stats(
+  cuda_stream_ref stream) const
+{
+  static_assert(StatsPolicy::enabled, "Probing statistics are disabled by the StatsPolicy.");
+  return stats_storage_type::load_to_host(stream);
+}
+
+template <class Key,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage,
+          class StatsPolicy>
+void static_set<Key,
+                Extent,
+                Scope,
+                KeyEqual,
+                ProbingScheme,
+                Allocator,
+                Storage,
+                StatsPolicy>::reset_stats(cuda_stream_ref stream)
+{
+  stats_storage_type::reset(stream);
+}
+
+template <class Key,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage,
+          class StatsPolicy>
 template <typename... Operators>
-auto static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::ref(
+auto static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage, StatsPolicy>::ref(
   Operators...) const noexcept
 {
   static_assert(sizeof...(Operators), "No operators specified");
   return ref_type<Operators...>{cuco::empty_key<key_type>(this->empty_key_sentinel()),
                                 impl_->key_eq(),
                                 impl_->probing_scheme(),
-                                impl_->storage_ref()};
+                                stats_storage_type::attach(impl_->storage_ref())};
 }
 }  // namespace experimental
 }  // namespace cuco
@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cuco/detail/utils.hpp>
+
+#include <cooperative_groups.h>
+
+#include <cstdint>
+#include <type_traits>
+
+namespace cuco {
+namespace experimental {
+namespace detail {
+
+/**
+ * @brief Scans the windows of a container and records their occupancies and the displacements of
+ * their keys.
+ *
+ * @note The displacement of a key is the number of probing steps between the first window of its
+ * probing sequence and the window it is stored in. It is computed by replaying the probing
+ * sequence of the key, in the same way as a lookup with `CGSize` threads would do.
+ *
+ * @tparam CGSize Number of threads in each CG
+ * @tparam BlockSize Number of threads in each block
+ * @tparam Key Type of keys
+ * @tparam StorageRef Type of non-owning ref used to access the slot storage
+ * @tparam ProbingScheme Type of probing scheme
+ * @tparam Predicate Type of predicate indicating if the given slot is filled
+ *
+ * @param storage Non-owning device ref used to access the slot storage
+ * @param probing_scheme Probing scheme of the container
+ * @param is_filled Predicate indicating if the given slot is filled
+ * @param window_occupancy Number of filled slots of each window
+ * @param displacement_histogram Displacement histogram of the keys
+ * @param num_bins Number of histogram bins
+ * @param displacement_sum Sum of the displacements of all keys
+ * @param max_displacement Largest displacement of any key
+ */
+template <int32_t CGSize,
+          int32_t BlockSize,
+          typename Key,
+          typename StorageRef,
+          typename ProbingScheme,
+          typename Predicate>
+__global__ void analyze(StorageRef storage,
+                        ProbingScheme probing_scheme,
+                        Predicate is_filled,
+                        int32_t* window_occupancy,
+                        unsigned long long int* displacement_histogram,
+                        int32_t num_bins,
+                        unsigned long long int* displacement_sum,
+                        unsigned long long int* max_displacement)
+{
+  namespace cg = cooperative_groups;
+
+  auto const tile = cg::tiled_partition<CGSize>(cg::this_thread_block());
+
+  cuco::detail::index_type const loop_stride = gridDim.x * BlockSize / CGSize;
+  cuco::detail::index_type idx               = (BlockSize * blockIdx.x + threadIdx.x) / CGSize;
+
+  auto const num_windows = static_cast<cuco::detail::index_type>(storage.num_windows());
+  auto const max_steps   = static_cast<unsigned long long int>(num_windows);
+  auto const last_bin    = static_cast<unsigned long long int>(num_bins - 1);
+
+  while (idx < num_windows) {
+    auto const window = storage[idx];
+    int32_t occupancy = 0;
+
+    for (auto const& slot : window) {
+      if (not is_filled(slot)) { continue; }
+      ++occupancy;
+
+      auto const key = [&]() {
+        if constexpr (std::is_same_v<Key, std::decay_t<decltype(slot)>>) {
+          return slot;
+        } else {
+          return slot.first;
+        }
+      }();
+
+      // Bounded by the number of windows in case the probing sequence does not cover them all
+      unsigned long long int displacement = 0;
+      if constexpr (CGSize == 1) {
+        auto probing_iter = probing_scheme(key, storage.window_extent());
+        while (static_cast<cuco::detail::index_type>(*probing_iter) != idx and
+               displacement < max_steps) {
+          ++probing_iter;
+          ++displacement;
+        }
+      } else {
+        auto probing_iter = probing_scheme(tile, key, storage.window_extent());
+        while (not tile.any(static_cast<cuco::detail::index_type>(*probing_iter) == idx) and
+               displacement < max_steps) {
+          ++probing_iter;
+          ++displacement;
+        }
+      }
+
+      if (tile.thread_rank() == 0) {
+        auto const bin = displacement < last_bin ? displacement : last_bin;
+        atomicAdd(displacement_histogram + bin, 1ull);
+        atomicAdd(displacement_sum, displacement);
+        atomicMax(max_displacement, displacement);
+      }
+    }
+
+    if (tile.thread_rank() == 0) { window_occupancy[idx] = occupancy; }
+    idx += loop_stride;
+  }
+}
+
+}  // namespace detail
+}  // namespace experimental
+}  // namespace cuco
@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace cuco {
+namespace experimental {
+
+inline std::string table_analysis::to_json() const
+{
+  std::ostringstream json;
+  json.precision(std::numeric_limits<double>::max_digits10);
+
+  json << "{\"capacity\": " << capacity << ", \"num_windows\": " << num_windows
+       << ", \"window_size\": " << window_size << ", \"cg_size\": " << cg_size
+       << ", \"size\": " << size << ", \"load_factor\": " << load_factor
+       << ", \"displacement_histogram\": [";
+  for (std::size_t i = 0; i < displacement_histogram.size(); ++i) {
+    if (i > 0) { json << ", "; }
+    json << displacement_histogram[i];
+  }
+  json << "], \"max_displacement\": " << max_displacement
+       << ", \"mean_displacement\": " << mean_displacement
+       << ", \"longest_cluster\": " << longest_cluster
+       << ", \"full_window_fraction\": " << full_window_fraction
+       << ", \"expected_probes_hit\": " << expected_probes_hit << ", \"expected_probes_miss\": ";
+  if (std::isinf(expected_probes_miss)) {
+    json << "null";
+  } else {
+    json << expected_probes_miss;
+  }
+  json << "}";
+
+  return json.str();
+}
+
+namespace detail {
+
+/**
+ * @brief Builds the health report of a container from its per-window occupancies and key
+ * displacements.
+ *
+ * @param window_occupancy Number of filled slots of each window
+ * @param displacement_histogram Displacement histogram of the keys
+ * @param displacement_sum Sum of the displacements of all keys
+ * @param max_displacement Largest displacement of any key
+ * @param window_size Number of slots per window
+ * @param cg_size Number of windows visited per probing step
+ * @param is_linear_probing Whether the container uses linear probing
+ *
+ * @return Health report of the container
+ */
+inline table_analysis make_table_analysis(std::vector<int32_t> const& window_occupancy,
+                                          std::vector<std::uint64_t> displacement_histogram,
+                                          std::uint64_t displacement_sum,
+                                          std::uint64_t max_displacement,
+                                          int32_t window_size,
+                                          int32_t cg_size,
+                                          bool is_linear_probing)
+{
+  auto const num_windows = window_occupancy.size();
+  auto const capacity    = num_windows * window_size;
+  auto const size        = static_cast<std::size_t>(
+    std::accumulate(window_occupancy.begin(), window_occupancy.end(), std::int64_t{0}));
+  auto const is_full = [&](std::size_t i) { return window_occupancy[i] == window_size; };
+  auto const num_full_windows = static_cast<std::size_t>(
+    std::count(window_occupancy.begin(), window_occupancy.end(), window_size));
+
+  // Runs of full windows wrap around the end of the storage, like the probing sequences do
+  std::size_t longest_cluster = num_full_windows == num_windows ? num_windows : 0;
+  if (num_full_windows < num_windows) {
+    auto start = std::size_t{0};
+    while (is_full(start)) {
+      ++start;
+    }
+    std::size_t run = 0;
+    for (std::size_t i = 1; i <= num_windows; ++i) {
+      run             = is_full((start + i) % num_windows) ? run + 1 : 0;
+      longest_cluster = std::max(longest_cluster, run);
+    }
+  }
+
+  auto const full_window_fraction =
+    num_windows == 0 ? 0. : static_cast<double>(num_full_windows) / num_windows;
+
+  auto expected_probes_miss = std::numeric_limits<double>::infinity();
+  if (num_full_windows < num_windows) {
+    if (is_linear_probing) {
+      // A miss starting at window `i` stops at the first probing step that covers a non-full
+      // window, `distance` windows away
+      std::vector<std::size_t> distance(num_windows);
+      std::size_t next = 0;
+      for (std::size_t k = 2 * num_windows; k-- > 0;) {
+        auto const i = k % num_windows;
+        next         = is_full(i) ? next + 1 : 0;
+        if (k < num_windows) { distance[i] = next; }
+      }
+      double total_steps = 0.;
+      for (auto const d : distance) {
+        total_steps += static_cast<double>(d / cg_size + 1);
+      }
+      expected_probes_miss = total_steps / num_windows;
+    } else {
+      expected_probes_miss = 1. / (1. - std::pow(full_window_fraction, cg_size));
+    }
+  }
+
+  auto const mean_displacement = size == 0 ? 0. : static_cast<double>(displacement_sum) / size;
+
+  return table_analysis{capacity,
+                        num_windows,
+                        window_size,
+                        cg_size,
+                        size,
+                        capacity == 0 ? 0. : static_cast<double>(size) / capacity,
+                        std::move(displacement_histogram),
+                        max_displacement,
+                        mean_displacement,
+                        longest_cluster,
+                        full_window_fraction,
+                        1. + mean_displacement,
+                        expected_probes_miss};
+}
+
+}  // namespace detail
+}  // namespace experimental
+}  // namespace cuco
@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cuco/cuda_stream_ref.hpp>
+#include <cuco/tracing.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <limits>
+
+namespace cuco {
+namespace experimental {
+namespace detail {
+/**
+ * @brief Traces a bulk operation from its construction to its destruction.
+ *
+ * Only the outermost scope of a host thread emits events, so that a public operation implemented
+ * in terms of another one, e.g., `clear` calling `clear_async`, is traced once under its own name.
+ *
+ * @note Tracing never throws: bulk operations may be `noexcept`. An exception thrown while
+ * computing the load factor yields a NaN load factor.
+ */
+class trace_scope {
+ public:
+  /// Type of load factor getters
+  using load_factor_type = std::function<double(cuda_stream_ref)>;
+
+  /**
+   * @brief Emits the begin event of an operation if `tracer` is not null and no other operation
+   * is traced by the calling thread.
+   *
+   * @param tracer Tracer of the container, may be null
+   * @param name Name of the operation
+   * @param num_keys Number of input keys, or of scanned slots
+   * @param capacity Capacity of the container
+   * @param load_factor Getter of the load factor of the container, which must outlive the scope
+   * if `tracer` is not null
+   * @param stream CUDA stream of the operation
+   */
+  trace_scope(cuco::experimental::tracer* tracer,
+              char const* name,
+              std::size_t num_keys,
+              std::size_t capacity,
+              load_factor_type const* load_factor,
+              cuda_stream_ref stream) noexcept
+    : tracer_{depth() == 0 ? tracer : nullptr},
+      event_{name, num_keys, capacity, std::numeric_limits<double>::quiet_NaN(), 0.},
+      load_factor_{load_factor},
+      stream_{stream}
+  {
+    if (tracer_ == nullptr) { return; }
+    ++depth();
+    if (tracer_->wants_load_factor()) { event_.load_factor = this->load_factor(); }
+    tracer_->begin(event_);
+    start_ = std::chrono::steady_clock::now();
+  }
+
+  trace_scope(trace_scope const&) = delete;
+  trace_scope& operator=(trace_scope const&) = delete;
+
+  /**
+   * @brief Emits the end event of the operation if its begin event was emitted.
+   */
+  ~trace_scope()
+  {
+    if (tracer_ == nullptr) { return; }
+    event_.duration =
+      std::chrono::duration<double>(std::chrono::steady_clock::now() - start_).count();
+    if (tracer_->wants_load_factor()) { event_.load_factor = this->load_factor(); }
+    tracer_->end(event_);
+    --depth();
+  }
+
+ private:
+  /**
+   * @brief Gets the number of scopes emitting events on the calling thread.
+   *
+   * @return Reference to the number of active scopes of the calling thread
+   */
+  [[nodiscard]] static int& depth() noexcept
+  {
+    static thread_local int depth = 0;
+    return depth;
+  }
+
+  /**
+   * @brief Computes the load factor of the container.
+   *
+   * @return The load factor, or NaN if it could not be computed
+   */
+  [[nodiscard]] double load_factor() const noexcept
+  {
+    try {
+      return (*load_factor_)(stream_);
+    } catch (...) {
+      return std::numeric_limits<double>::quiet_NaN();
+    }
+  }
+
+  cuco::experimental::tracer* tracer_;           ///< Tracer, null if the scope emits no event
+  trace_event event_;                            ///< Event of the operation
+  load_factor_type const* load_factor_;          ///< Load factor getter
+  cuda_stream_ref stream_;                       ///< CUDA stream of the operation
+  std::chrono::steady_clock::time_point start_;  ///< Start time of the operation
+};
+
+}  // namespace detail
+}  // namespace experimental
+}  // namespace cuco
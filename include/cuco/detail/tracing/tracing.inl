@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cmath>
+#include <functional>
+#include <string>
+#include <thread>
+#include <utility>
+
+#if __has_include(<nvtx3/nvToolsExt.h>)
+#include <nvtx3/nvToolsExt.h>
+#endif
+
+namespace cuco {
+namespace experimental {
+
+inline callback_tracer::callback_tracer(callback_type on_begin,
+                                        callback_type on_end,
+                                        bool with_load_factor)
+  : on_begin_{std::move(on_begin)}, on_end_{std::move(on_end)}, with_load_factor_{with_load_factor}
+{
+}
+
+inline void callback_tracer::begin(trace_event const& event) noexcept
+{
+  try {
+    if (on_begin_) { on_begin_(event); }
+  } catch (...) {
+  }
+}
+
+inline void callback_tracer::end(trace_event const& event) noexcept
+{
+  try {
+    if (on_end_) { on_end_(event); }
+  } catch (...) {
+  }
+}
+
+inline bool callback_tracer::wants_load_factor() const noexcept { return with_load_factor_; }
+
+inline chrome_trace_writer::chrome_trace_writer(std::ostream& out, bool with_load_factor)
+  : out_{out}, origin_{std::chrono::steady_clock::now()}, with_load_factor_{with_load_factor}
+{
+  out_ << "[";
+}
+
+inline chrome_trace_writer::~chrome_trace_writer()
+{
+  out_ << "\n]\n";
+  out_.flush();
+}
+
+inline void chrome_trace_writer::begin(trace_event const& event) noexcept
+{
+  this->write(event, 'B');
+}
+
+inline void chrome_trace_writer::end(trace_event const& event) noexcept { this->write(event, 'E'); }
+
+inline bool chrome_trace_writer::wants_load_factor() const noexcept { return with_load_factor_; }
+
+inline void chrome_trace_writer::write(trace_event const& event, char phase) noexcept
+{
+  auto const timestamp = std::chrono::duration_cast<std::chrono::microseconds>(
+                           std::chrono::steady_clock::now() - origin_)
+                           .count();
+  auto const thread_id = std::hash<std::thread::id>{}(std::this_thread::get_id());
+
+  try {
+    std::lock_guard<std::mutex> lock{mutex_};
+    out_ << (is_first_ ? "\n" : ",\n") << "{\"name\": \"" << event.name
+         << "\", \"cat\": \"cuco\", \"ph\": \"" << phase << "\", \"ts\": " << timestamp
+         << ", \"pid\": 0, \"tid\": " << thread_id
+         << ", \"args\": {\"num_keys\": " << event.num_keys << ", \"capacity\": " << event.capacity;
+    if (not std::isnan(event.load_factor)) { out_ << ", \"load_factor\": " << event.load_factor; }
+    out_ << "}}";
+    is_first_ = false;
+  } catch (...) {
+  }
+}
+
+#if __has_include(<nvtx3/nvToolsExt.h>)
+inline void nvtx_tracer::begin(trace_event const& event) noexcept
+{
+  try {
+    auto const message = std::string{"cuco::"} + event.name +
+                         " (num_keys=" + std::to_string(event.num_keys) +
+                         ", capacity=" + std::to_string(event.capacity) + ")";
+    nvtxRangePushA(message.c_str());
+  } catch (...) {
+    // Keeps ranges balanced with the `nvtxRangePop` of the end event
+    nvtxRangePushA(event.name);
+  }
+}
+
+inline void nvtx_tracer::end(trace_event const&) noexcept { nvtxRangePop(); }
+#endif
+
+}  // namespace experimental
+}  // namespace cuco
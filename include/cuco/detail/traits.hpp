@@ -18,9 +18,14 @@
 #include <thrust/device_reference.h>
 #include <thrust/tuple.h>
 
+#include <cuda/std/array>
 #include <cuda/std/type_traits>
 
+#include <cstdint>
+#include <iterator>
 #include <tuple>
+#include <type_traits>
+#include <utility>
 
 namespace cuco::detail {
 
@@ -56,4 +61,28 @@ struct is_thrust_pair_like
       cuda::std::declval<T>()))>> {
 };
 
+/**
+ * @brief Indicates whether `Hash` returns a 128-bit hash, i.e., two 64-bit halves, for `Key`.
+ *
+ * @tparam Hash Unary callable type
+ * @tparam Key Type of the hashed key
+ */
+template <typename Hash, typename Key>
+inline constexpr bool is_wide_hash_v =
+  std::is_same_v<std::decay_t<decltype(std::declval<Hash const&>()(std::declval<Key const&>()))>,
+                 cuda::std::array<std::uint64_t, 2>>;
+
+/**
+ * @brief Indicates whether `T` is an iterator type, i.e., whether `std::iterator_traits<T>` names
+ * its `value_type`.
+ *
+ * @tparam T Type to check
+ */
+template <typename T, typename = void>
+inline constexpr bool is_iterator_v = false;
+
+template <typename T>
+inline constexpr bool
+  is_iterator_v<T, std::void_t<typename std::iterator_traits<T>::value_type>> = true;
+
 }  // namespace cuco::detail
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cuco/detail/utils.hpp>
+
+#include <cooperative_groups.h>
+
+namespace cuco {
+namespace experimental {
+namespace windowed_set_ns {
+namespace detail {
+
+/**
+ * @brief Indicates whether the keys in the range `[first, first + n)` are contained in any of the
+ * given generations.
+ *
+ * @note If the key `*(first + i)` is contained in any generation, stores `true` to
+ * `(output_begin + i)`. Else, stores `false`. Generations are probed in order, so that the probing
+ * of a key stops at the first generation containing it.
+ *
+ * @tparam CGSize Number of threads in each CG
+ * @tparam BlockSize Number of threads in each block
+ * @tparam InputIt Device accessible input iterator
+ * @tparam OutputIt Device accessible output iterator assignable from `bool`
+ * @tparam Refs Array type of non-owning device refs of the generations
+ *
+ * @param first Beginning of the sequence of keys
+ * @param n Number of keys
+ * @param output_begin Beginning of the sequence of booleans for the presence of each key
+ * @param refs Non-owning device refs of the generations, ordered from the newest to the oldest
+ */
+template <int32_t CGSize, int32_t BlockSize, typename InputIt, typename OutputIt, typename Refs>
+__global__ void contains(InputIt first,
+                         cuco::detail::index_type n,
+                         OutputIt output_begin,
+                         Refs refs)
+{
+  namespace cg = cooperative_groups;
+
+  auto const block      = cg::this_thread_block();
+  auto const thread_idx = block.thread_rank();
+
+  cuco::detail::index_type const loop_stride = gridDim.x * BlockSize / CGSize;
+  cuco::detail::index_type idx               = (BlockSize * blockIdx.x + threadIdx.x) / CGSize;
+
+  __shared__ bool output_buffer[BlockSize / CGSize];
+
+  while (idx - thread_idx < n) {  // the whole thread block falls into the same iteration
+    if constexpr (CGSize == 1) {
+      if (idx < n) {
+        auto const key = *(first + idx);
+        bool found     = false;
+        for (auto const& ref : refs) {
+          if (ref.contains(key)) {
+            found = true;
+            break;
+          }
+        }
+        // Stage results in shared memory for the same reason as `static_set::contains`
+        output_buffer[thread_idx] = found;
+      }
+      block.sync();
+      if (idx < n) { *(output_begin + idx) = output_buffer[thread_idx]; }
+    } else {
+      auto const tile = cg::tiled_partition<CGSize>(cg::this_thread_block());
+      if (idx < n) {
+        auto const key = *(first + idx);
+        bool found     = false;
+        // The result of a CG contains is uniform across the tile, thus so is the early exit
+        for (auto const& ref : refs) {
+          if (ref.contains(tile, key)) {
+            found = true;
+            break;
+          }
+        }
+        if (tile.thread_rank() == 0) { *(output_begin + idx) = found; }
+      }
+    }
+    idx += loop_stride;
+  }
+}
+
+}  // namespace detail
+}  // namespace windowed_set_ns
+}  // namespace experimental
+}  // namespace cuco
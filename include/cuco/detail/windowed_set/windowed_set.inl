@@ -0,0 +1,310 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cuco/cuda_stream_ref.hpp>
+#include <cuco/detail/tuning.cuh>
+#include <cuco/detail/utils.hpp>
+#include <cuco/detail/windowed_set/kernels.cuh>
+#include <cuco/operator.hpp>
+
+#include <cstddef>
+#include <utility>
+
+namespace cuco {
+namespace experimental {
+
+template <class Key,
+          int32_t NumGenerations,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+windowed_set<Key, NumGenerations, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+  windowed_set(Extent capacity,
+               empty_key<Key> empty_key_sentinel,
+               KeyEqual const& pred,
+               ProbingScheme const& probing_scheme,
+               Allocator const& alloc,
+               cuda_stream_ref stream)
+  : current_{0}
+{
+  generations_.reserve(num_generations);
+  for (int32_t i = 0; i < num_generations; ++i) {
+    generations_.emplace_back(capacity, empty_key_sentinel, pred, probing_scheme, alloc, stream);
+  }
+}
+
+template <class Key,
+          int32_t NumGenerations,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+void windowed_set<Key, NumGenerations, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+  clear(cuda_stream_ref stream) noexcept
+{
+  this->clear_async(stream);
+  stream.synchronize();
+}
+
+template <class Key,
+          int32_t NumGenerations,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+void windowed_set<Key, NumGenerations, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+  clear_async(cuda_stream_ref stream) noexcept
+{
+  for (auto& generation : generations_) {
+    generation.clear_async(stream);
+  }
+  current_ = 0;
+}
+
+template <class Key,
+          int32_t NumGenerations,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+void windowed_set<Key, NumGenerations, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+  advance(cuda_stream_ref stream) noexcept
+{
+  this->advance_async(stream);
+  stream.synchronize();
+}
+
+template <class Key,
+          int32_t NumGenerations,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+void windowed_set<Key, NumGenerations, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+  advance_async(cuda_stream_ref stream) noexcept
+{
+  // The oldest generation directly follows the current one in the ring
+  current_ = (current_ + 1) % num_generations;
+  generations_[current_].clear_async(stream);
+}
+
+template <class Key,
+          int32_t NumGenerations,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+template <typename InputIt>
+typename windowed_set<Key,
+                      NumGenerations,
+                      Extent,
+                      Scope,
+                      KeyEqual,
+                      ProbingScheme,
+                      Allocator,
+                      Storage>::size_type
+windowed_set<Key, NumGenerations, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+  insert(InputIt first, InputIt last, cuda_stream_ref stream)
+{
+  return generations_[current_].insert(first, last, stream);
+}
+
+template <class Key,
+          int32_t NumGenerations,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+template <typename InputIt>
+void windowed_set<Key, NumGenerations, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+  insert_async(InputIt first, InputIt last, cuda_stream_ref stream) noexcept
+{
+  generations_[current_].insert_async(first, last, stream);
+}
+
+template <class Key,
+          int32_t NumGenerations,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+template <typename InputIt, typename OutputIt>
+void windowed_set<Key, NumGenerations, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+  contains(InputIt first, InputIt last, OutputIt output_begin, cuda_stream_ref stream) const
+{
+  this->contains_async(first, last, output_begin, stream);
+  stream.synchronize();
+}
+
+template <class Key,
+          int32_t NumGenerations,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+template <typename InputIt, typename OutputIt>
+void windowed_set<Key, NumGenerations, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+  contains_async(InputIt first,
+                 InputIt last,
+                 OutputIt output_begin,
+                 cuda_stream_ref stream) const noexcept
+{
+  auto const num_keys = cuco::detail::distance(first, last);
+  if (num_keys == 0) { return; }
+
+  auto const grid_size =
+    (cg_size * num_keys + detail::CUCO_DEFAULT_STRIDE * detail::CUCO_DEFAULT_BLOCK_SIZE - 1) /
+    (detail::CUCO_DEFAULT_STRIDE * detail::CUCO_DEFAULT_BLOCK_SIZE);
+
+  windowed_set_ns::detail::contains<cg_size, detail::CUCO_DEFAULT_BLOCK_SIZE>
+    <<<grid_size, detail::CUCO_DEFAULT_BLOCK_SIZE, 0, stream>>>(
+      first,
+      num_keys,
+      output_begin,
+      this->generation_refs(std::make_integer_sequence<int32_t, num_generations>{}));
+}
+
+template <class Key,
+          int32_t NumGenerations,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+typename windowed_set<Key,
+                      NumGenerations,
+                      Extent,
+                      Scope,
+                      KeyEqual,
+                      ProbingScheme,
+                      Allocator,
+                      Storage>::size_type
+windowed_set<Key, NumGenerations, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::size(
+  cuda_stream_ref stream) const noexcept
+{
+  return generations_[current_].size(stream);
+}
+
+template <class Key,
+          int32_t NumGenerations,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+constexpr auto
+windowed_set<Key, NumGenerations, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+  capacity() const noexcept
+{
+  return generations_[current_].capacity();
+}
+
+template <class Key,
+          int32_t NumGenerations,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+constexpr typename windowed_set<Key,
+                                NumGenerations,
+                                Extent,
+                                Scope,
+                                KeyEqual,
+                                ProbingScheme,
+                                Allocator,
+                                Storage>::key_type
+windowed_set<Key, NumGenerations, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+  empty_key_sentinel() const noexcept
+{
+  return generations_[current_].empty_key_sentinel();
+}
+
+template <class Key,
+          int32_t NumGenerations,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+typename windowed_set<Key,
+                      NumGenerations,
+                      Extent,
+                      Scope,
+                      KeyEqual,
+                      ProbingScheme,
+                      Allocator,
+                      Storage>::generation_type const&
+windowed_set<Key, NumGenerations, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+  current_generation() const noexcept
+{
+  return generations_[current_];
+}
+
+template <class Key,
+          int32_t NumGenerations,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+template <int32_t... Indices>
+cuda::std::array<
+  typename windowed_set<Key,
+                        NumGenerations,
+                        Extent,
+                        Scope,
+                        KeyEqual,
+                        ProbingScheme,
+                        Allocator,
+                        Storage>::template ref_type<op::contains_tag>,
+  NumGenerations>
+windowed_set<Key, NumGenerations, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+  generation_refs(std::integer_sequence<int32_t, Indices...>) const noexcept
+{
+  // Walks the ring backwards from the current generation
+  return {generations_[(current_ + num_generations - Indices) % num_generations].ref(
+    op::contains)...};
+}
+
+}  // namespace experimental
+}  // namespace cuco
@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <cuco/detail/canonicalize.cuh>
 #include <cuco/detail/dynamic_map_kernels.cuh>
 #include <cuco/hash_functions.cuh>
 #include <cuco/sentinel.cuh>
@@ -45,6 +46,7 @@ namespace cuco {
  * Current limitations:
  * - Requires keys and values that where `cuco::is_bitwise_comparable_v<T>` is true
  *    - Comparisons against the "sentinel" values will always be done with bitwise comparisons.
+ * - Does not support floating-point keys, see `cuco::experimental::static_map` instead
  * - Capacity does not shrink automatically
  * - Requires the user to specify sentinel values for both key and mapped value
  *   to indicate empty slots
@@ -100,6 +102,10 @@ template <typename Key,
 class dynamic_map {
   static_assert(std::is_arithmetic<Key>::value, "Unsupported, non-arithmetic key type.");
 
+  static_assert(not cuco::detail::is_canonicalized_v<Key>,
+                "Floating-point keys are only supported by the experimental containers, e.g., "
+                "cuco::experimental::static_map.");
+
  public:
   using value_type      = cuco::pair<Key, Value>;            ///< Type of key/value pairs
   using key_type        = Key;                               ///< Key type
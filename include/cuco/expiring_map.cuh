@@ -0,0 +1,425 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cuco/detail/__config>
+#include <cuco/detail/open_addressing_impl.cuh>
+#include <cuco/expiring_map_ref.cuh>
+#include <cuco/hash_functions.cuh>
+#include <cuco/pair.cuh>
+#include <cuco/sentinel.cuh>
+#include <cuco/utility/allocator.hpp>
+#include <cuco/utility/traits.hpp>
+
+#include <thrust/functional.h>
+
+#include <cuda/std/atomic>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace cuco {
+namespace experimental {
+/**
+ * @brief A GPU-accelerated, unordered, associative container of key-value pairs with unique keys
+ * whose entries expire after a fixed time-to-live.
+ *
+ * The `expiring_map` is a `static_map` whose slots additionally carry the point in time at which
+ * they were written. Time is expressed by the caller as a monotonically non-decreasing
+ * `timestamp_type` value, e.g., seconds since some epoch or a batch generation counter. Given the
+ * time-to-live `ttl` provided at construction, an entry written at time `t` is alive at time `now`
+ * if `now - t < ttl` and expired otherwise.
+ *
+ * - Lookups (`contains`, `find`) treat expired entries as misses.
+ * - `insert` refreshes an expired entry with an equivalent key in place, and reclaims the first
+ *   tombstone or expired entry along the probing sequence of a new key before falling back to an
+ *   empty slot.
+ * - `expire` sweeps the whole storage and turns every expired entry into a tombstone so that
+ *   `size()` only accounts for alive entries and the slots can be reused by new keys.
+ *
+ * Alive entries are found with exactly the same probing sequence as in `static_map`, thus lookup
+ * and insert throughput match the ones of a `static_map` for fresh entries.
+ *
+ * @note `expire` must not run concurrently with any other operation on the same map.
+ * @note Timestamps share the 8-byte payload word with the mapped value, thus the mapped type can be
+ * at most 4 bytes large.
+ * @note cuCollections data stuctures always place the slot keys on the left-hand side when invoking
+ * the key comparison predicate, i.e., `pred(slot_key, query_key)`. Order-sensitive `KeyEqual`
+ * should be used with caution.
+ * @note `ProbingScheme::cg_size` indicates how many threads are used to handle one independent
+ * device operation. `cg_size == 1` uses the scalar (or non-CG) code paths.
+ *
+ * @throw If the size of the given key type is larger than 8 bytes
+ * @throw If the size of the given payload type is larger than 4 bytes
+ * @throw If the given mapped type doesn't have unique object representations, i.e.,
+ * `cuco::bitwise_comparable_v<T> == false`
+ * @throw If the given key type doesn't have unique object representations, i.e.,
+ * `cuco::bitwise_comparable_v<Key> == false`
+ * @throw If the probing scheme type is not inherited from `cuco::detail::probing_scheme_base`
+ *
+ * @tparam Key Type used for keys. Requires `cuco::is_bitwise_comparable_v<Key>`
+ * @tparam T Type of the mapped values
+ * @tparam Extent Data structure size type
+ * @tparam Scope The scope in which operations will be performed by individual threads.
+ * @tparam KeyEqual Binary callable type used to compare two keys for equality
+ * @tparam ProbingScheme Probing scheme (see `include/cuco/probing_scheme.cuh` for choices)
+ * @tparam Allocator Type of allocator used for device storage
+ * @tparam Storage Slot window storage type
+ */
+template <class Key,
+          class T,
+          class Extent             = cuco::experimental::extent<std::size_t>,
+          cuda::thread_scope Scope = cuda::thread_scope_device,
+          class KeyEqual           = thrust::equal_to<Key>,
+          class ProbingScheme =
+            cuco::experimental::double_hashing<4,  // CG size
+                                               cuco::default_hash_function<Key>>,
+          class Allocator = cuco::cuda_allocator<cuco::pair<Key, T>>,
+          class Storage   = cuco::experimental::aow_storage<1>>
+class expiring_map {
+  static_assert(sizeof(Key) <= 8, "Container does not support key types larger than 8 bytes.");
+
+  static_assert(sizeof(T) <= 4, "Container does not support payload types larger than 4 bytes.");
+
+  static_assert(cuco::is_bitwise_comparable_v<T>,
+                "Mapped type must have unique object representations or have been explicitly "
+                "declared as safe for bitwise comparison via specialization of "
+                "cuco::is_bitwise_comparable_v<T>.");
+
+ public:
+  using timestamp_type = std::uint32_t;  ///< Type of the points in time and of the time-to-live
+
+ private:
+  using payload_type = cuco::pair<T, timestamp_type>;
+  using slot_type    = cuco::pair<Key, payload_type>;
+  using impl_type    = detail::open_addressing_impl<Key,
+                                                    slot_type,
+                                                    Extent,
+                                                    Scope,
+                                                    KeyEqual,
+                                                    ProbingScheme,
+                                                    Allocator,
+                                                    Storage>;
+
+ public:
+  static constexpr auto cg_size      = impl_type::cg_size;       ///< CG size used for probing
+  static constexpr auto window_size  = impl_type::window_size;   ///< Window size used for probing
+  static constexpr auto thread_scope = impl_type::thread_scope;  ///< CUDA thread scope
+
+  using key_type       = typename impl_type::key_type;        ///< Key type
+  using mapped_type    = T;                                   ///< Payload type
+  using value_type     = cuco::pair<key_type, mapped_type>;   ///< Key-value pair type
+  using extent_type    = typename impl_type::extent_type;     ///< Extent type
+  using size_type      = typename impl_type::size_type;       ///< Size type
+  using key_equal      = typename impl_type::key_equal;       ///< Key equality comparator type
+  using allocator_type = typename impl_type::allocator_type;  ///< Allocator type
+  /// Non-owning window storage ref type
+  using storage_ref_type    = typename impl_type::storage_ref_type;
+  using probing_scheme_type = typename impl_type::probing_scheme_type;  ///< Probing scheme type
+
+  template <typename... Operators>
+  using ref_type =
+    cuco::experimental::expiring_map_ref<key_type,
+                                         mapped_type,
+                                         thread_scope,
+                                         key_equal,
+                                         probing_scheme_type,
+                                         storage_ref_type,
+                                         Operators...>;  ///< Non-owning container ref type
+
+  expiring_map(expiring_map const&) = delete;
+  expiring_map& operator=(expiring_map const&) = delete;
+
+  expiring_map(expiring_map&&) = default;  ///< Move constructor
+
+  /**
+   * @brief Replaces the contents of the container with another container.
+   *
+   * @return Reference of the current map object
+   */
+  expiring_map& operator=(expiring_map&&) = default;
+  ~expiring_map()                         = default;
+
+  /**
+   * @brief Constructs a statically-sized expiring map with the specified initial capacity,
+   * sentinel values, time-to-live and CUDA stream.
+   *
+   * The actual map capacity depends on the given `capacity`, the probing scheme, CG size, and the
+   * window size and it is computed via the `make_window_extent` factory. Insert operations will not
+   * automatically grow the map. Attempting to insert more unique alive keys than the capacity of
+   * the map results in undefined behavior.
+   *
+   * @note Any `*_sentinel`s are reserved and behavior is undefined when attempting to insert
+   * this sentinel value.
+   * @note If a non-default CUDA stream is provided, the caller is responsible for synchronizing the
+   * stream before the object is first used.
+   *
+   * @throw std::runtime_error if the empty key sentinel and erased key sentinel are the same value
+   *
+   * @param capacity The requested lower-bound map size
+   * @param empty_key_sentinel The reserved key value for empty slots
+   * @param empty_value_sentinel The reserved mapped value for empty slots
+   * @param erased_key_sentinel The reserved key value for tombstoned slots
+   * @param time_to_live Lifetime of an entry in timestamp units
+   * @param pred Key equality binary predicate
+   * @param probing_scheme Probing scheme
+   * @param alloc Allocator used for allocating device storage
+   * @param stream CUDA stream used to initialize the map
+   */
+  expiring_map(Extent capacity,
+               empty_key<Key> empty_key_sentinel,
+               empty_value<T> empty_value_sentinel,
+               erased_key<Key> erased_key_sentinel,
+               timestamp_type time_to_live,
+               KeyEqual const& pred                = {},
+               ProbingScheme const& probing_scheme = {},
+               Allocator const& alloc              = {},
+               cuda_stream_ref stream              = {});
+
+  /**
+   * @brief Erases all elements from the container. After this call, `size()` returns zero.
+   * Invalidates any references, pointers, or iterators referring to contained elements.
+   *
+   * @param stream CUDA stream this operation is executed in
+   */
+  void clear(cuda_stream_ref stream = {}) noexcept;
+
+  /**
+   * @brief Asynchronously erases all elements from the container. After this call, `size()` returns
+   * zero. Invalidates any references, pointers, or iterators referring to contained elements.
+   *
+   * @param stream CUDA stream this operation is executed in
+   */
+  void clear_async(cuda_stream_ref stream = {}) noexcept;
+
+  /**
+   * @brief Inserts all key-value pairs in the range `[first, last)` stamped with `now` and returns
+   * the number of successful insertions.
+   *
+   * @note A pair whose key is already present refreshes the existing entry if and only if that
+   * entry has expired at `now`. Refreshed entries are counted as successful insertions.
+   * @note This function synchronizes the given stream. For asynchronous execution use
+   * `insert_async`.
+   *
+   * @tparam InputIt Device accessible random access input iterator where
+   * <tt>std::is_convertible<std::iterator_traits<InputIt>::value_type,
+   * expiring_map<K, V>::value_type></tt> is `true`
+   *
+   * @param first Beginning of the sequence of key-value pairs
+   * @param last End of the sequence of key-value pairs
+   * @param now Timestamp of the inserted entries
+   * @param stream CUDA stream used for insert
+   *
+   * @return Number of successful insertions
+   */
+  template <typename InputIt>
+  size_type insert(InputIt first, InputIt last, timestamp_type now, cuda_stream_ref stream = {});
+
+  /**
+   * @brief Asynchonously inserts all key-value pairs in the range `[first, last)` stamped with
+   * `now`.
+   *
+   * @tparam InputIt Device accessible random access input iterator where
+   * <tt>std::is_convertible<std::iterator_traits<InputIt>::value_type,
+   * expiring_map<K, V>::value_type></tt> is `true`
+   *
+   * @param first Beginning of the sequence of key-value pairs
+   * @param last End of the sequence of key-value pairs
+   * @param now Timestamp of the inserted entries
+   * @param stream CUDA stream used for insert
+   */
+  template <typename InputIt>
+  void insert_async(InputIt first,
+                    InputIt last,
+                    timestamp_type now,
+                    cuda_stream_ref stream = {}) noexcept;
+
+  /**
+   * @brief Indicates whether the keys in the range `[first, last)` are contained in the map and
+   * alive at `now`.
+   *
+   * @note This function synchronizes the given stream. For asynchronous execution use
+   * `contains_async`.
+   *
+   * @tparam InputIt Device accessible input iterator
+   * @tparam OutputIt Device accessible output iterator assignable from `bool`
+   *
+   * @param first Beginning of the sequence of keys
+   * @param last End of the sequence of keys
+   * @param output_begin Beginning of the sequence of booleans for the presence of each key
+   * @param now Point in time at which entries are looked up
+   * @param stream Stream used for executing the kernels
+   */
+  template <typename InputIt, typename OutputIt>
+  void contains(InputIt first,
+                InputIt last,
+                OutputIt output_begin,
+                timestamp_type now,
+                cuda_stream_ref stream = {}) const;
+
+  /**
+   * @brief Asynchonously indicates whether the keys in the range `[first, last)` are contained in
+   * the map and alive at `now`.
+   *
+   * @tparam InputIt Device accessible input iterator
+   * @tparam OutputIt Device accessible output iterator assignable from `bool`
+   *
+   * @param first Beginning of the sequence of keys
+   * @param last End of the sequence of keys
+   * @param output_begin Beginning of the sequence of booleans for the presence of each key
+   * @param now Point in time at which entries are looked up
+   * @param stream Stream used for executing the kernels
+   */
+  template <typename InputIt, typename OutputIt>
+  void contains_async(InputIt first,
+                      InputIt last,
+                      OutputIt output_begin,
+                      timestamp_type now,
+                      cuda_stream_ref stream = {}) const noexcept;
+
+  /**
+   * @brief For all keys in the range `[first, last)`, finds a payload with its key equivalent to
+   * the query key and alive at `now`.
+   *
+   * @note This function synchronizes the given stream. For asynchronous execution use `find_async`.
+   * @note If the key `*(first + i)` has an alive matched `element` in the map, copies the payload
+   * of `element` to `(output_begin + i)`. Else, copies the empty value sentinel.
+   *
+   * @tparam InputIt Device accessible input iterator
+   * @tparam OutputIt Device accessible output iterator assignable from the map's `mapped_type`
+   *
+   * @param first Beginning of the sequence of keys
+   * @param last End of the sequence of keys
+   * @param output_begin Beginning of the sequence of payloads retrieved for each key
+   * @param now Point in time at which entries are looked up
+   * @param stream Stream used for executing the kernels
+   */
+  template <typename InputIt, typename OutputIt>
+  void find(InputIt first,
+            InputIt last,
+            OutputIt output_begin,
+            timestamp_type now,
+            cuda_stream_ref stream = {}) const;
+
+  /**
+   * @brief For all keys in the range `[first, last)`, asynchonously finds a payload with its key
+   * equivalent to the query key and alive at `now`.
+   *
+   * @note If the key `*(first + i)` has an alive matched `element` in the map, copies the payload
+   * of `element` to `(output_begin + i)`. Else, copies the empty value sentinel.
+   *
+   * @tparam InputIt Device accessible input iterator
+   * @tparam OutputIt Device accessible output iterator assignable from the map's `mapped_type`
+   *
+   * @param first Beginning of the sequence of keys
+   * @param last End of the sequence of keys
+   * @param output_begin Beginning of the sequence of payloads retrieved for each key
+   * @param now Point in time at which entries are looked up
+   * @param stream Stream used for executing the kernels
+   */
+  template <typename InputIt, typename OutputIt>
+  void find_async(InputIt first,
+                  InputIt last,
+                  OutputIt output_begin,
+                  timestamp_type now,
+                  cuda_stream_ref stream = {}) const noexcept;
+
+  /**
+   * @brief Turns all entries that have expired at `now` into tombstones and returns the number of
+   * expired entries.
+   *
+   * @note Tombstoned slots keep probing sequences of other keys intact and are reclaimed by
+   * subsequent insertions.
+   * @note This function synchronizes the given stream.
+   *
+   * @param now Point in time at which entries are checked for expiration
+   * @param stream CUDA stream used for this operation
+   *
+   * @return Number of entries that have been tombstoned
+   */
+  size_type expire(timestamp_type now, cuda_stream_ref stream = {});
+
+  /**
+   * @brief Gets the number of filled slots in the container, i.e., alive entries and expired
+   * entries that have not been swept by `expire` yet.
+   *
+   * @note This function synchronizes the given stream.
+   *
+   * @param stream CUDA stream used to get the number of inserted elements
+   * @return The number of filled slots in the container
+   */
+  [[nodiscard]] size_type size(cuda_stream_ref stream = {}) const noexcept;
+
+  /**
+   * @brief Gets the maximum number of elements the hash map can hold.
+   *
+   * @return The maximum number of elements the hash map can hold
+   */
+  [[nodiscard]] constexpr auto capacity() const noexcept;
+
+  /**
+   * @brief Gets the sentinel value used to represent an empty key slot.
+   *
+   * @return The sentinel value used to represent an empty key slot
+   */
+  [[nodiscard]] constexpr key_type empty_key_sentinel() const noexcept;
+
+  /**
+   * @brief Gets the sentinel value used to represent an empty value slot.
+   *
+   * @return The sentinel value used to represent an empty value slot
+   */
+  [[nodiscard]] constexpr mapped_type empty_value_sentinel() const noexcept;
+
+  /**
+   * @brief Gets the sentinel value used to represent a tombstoned key slot.
+   *
+   * @return The sentinel value used to represent a tombstoned key slot
+   */
+  [[nodiscard]] constexpr key_type erased_key_sentinel() const noexcept;
+
+  /**
+   * @brief Gets the lifetime of an entry in timestamp units.
+   *
+   * @return The lifetime of an entry
+   */
+  [[nodiscard]] constexpr timestamp_type time_to_live() const noexcept;
+
+  /**
+   * @brief Get device ref observing the map at time `now` with operators.
+   *
+   * @tparam Operators Set of `cuco::op` to be provided by the ref
+   *
+   * @param now Point in time observed by the ref
+   * @param ops List of operators, e.g., `cuco::insert`
+   *
+   * @return Device ref of the current `expiring_map` object
+   */
+  template <typename... Operators>
+  [[nodiscard]] auto ref(timestamp_type now, Operators... ops) const noexcept;
+
+ private:
+  std::unique_ptr<impl_type> impl_;   ///< Open addressing implementation
+  mapped_type empty_value_sentinel_;  ///< Sentinel value that indicates an empty payload
+  key_type erased_key_sentinel_;      ///< Sentinel value that indicates a tombstoned slot
+  timestamp_type time_to_live_;       ///< Lifetime of an entry
+};
+}  // namespace experimental
+}  // namespace cuco
+
+#include <cuco/detail/expiring_map/expiring_map.inl>
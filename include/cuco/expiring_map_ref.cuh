@@ -0,0 +1,277 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cuco/detail/open_addressing_ref_impl.cuh>
+#include <cuco/operator.hpp>
+#include <cuco/pair.cuh>
+#include <cuco/sentinel.cuh>
+
+#include <cuda/std/atomic>
+
+namespace cuco {
+namespace experimental {
+
+/**
+ * @brief Device non-owning "ref" type of `cuco::experimental::expiring_map` that can be used in
+ * device code to perform `insert`, `contains` and `find` operations.
+ *
+ * Every ref observes the map at a fixed point in time, `now()`. An entry stamped at time `t` is
+ * considered expired by the ref if `now() - t >= time_to_live()` (computed with unsigned
+ * wrap-around arithmetic). Lookups treat expired entries as misses. Inserting a key whose entry is
+ * expired refreshes the entry in place, and inserting a new key reclaims the first tombstone left
+ * by `expiring_map::expire` or expired entry along its probing sequence.
+ *
+ * @note Concurrent modify and lookup will be supported if both kinds of operators are specified
+ * during the ref construction.
+ * @note cuCollections data stuctures always place the slot keys on the left-hand
+ * side when invoking the key comparison predicate.
+ * @note Ref types are trivially-copyable and are intended to be passed by value.
+ * @note `ProbingScheme::cg_size` indicates how many threads are used to handle one independent
+ * device operation. `cg_size == 1` uses the scalar (or non-CG) code paths.
+ *
+ * @throw If the size of the given key type is larger than 8 bytes
+ * @throw If the size of the given payload type is larger than 4 bytes
+ * @throw If the given mapped type doesn't have unique object representations, i.e.,
+ * `cuco::bitwise_comparable_v<T> == false`
+ * @throw If the given key type doesn't have unique object representations, i.e.,
+ * `cuco::bitwise_comparable_v<Key> == false`
+ * @throw If the probing scheme type is not inherited from `cuco::detail::probing_scheme_base`
+ *
+ * @tparam Key Type used for keys. Requires `cuco::is_bitwise_comparable_v<Key>` returning true
+ * @tparam T Type used for mapped values
+ * @tparam Scope The scope in which operations will be performed by individual threads.
+ * @tparam KeyEqual Binary callable type used to compare two keys for equality
+ * @tparam ProbingScheme Probing scheme (see `include/cuco/probing_scheme.cuh` for options)
+ * @tparam StorageRef Storage ref type
+ * @tparam Operators Device operator options defined in `include/cuco/operator.hpp`
+ */
+template <typename Key,
+          typename T,
+          cuda::thread_scope Scope,
+          typename KeyEqual,
+          typename ProbingScheme,
+          typename StorageRef,
+          typename... Operators>
+class expiring_map_ref
+  : public detail::operator_impl<
+      Operators,
+      expiring_map_ref<Key, T, Scope, KeyEqual, ProbingScheme, StorageRef, Operators...>>... {
+  using impl_type = detail::open_addressing_ref_impl<Key, Scope, ProbingScheme, StorageRef>;
+
+  static_assert(sizeof(T) <= 4, "Container does not support payload types larger than 4 bytes.");
+
+  static_assert(cuco::is_bitwise_comparable_v<T>,
+                "Mapped type must have unique object representations or have been explicitly "
+                "declared as safe for bitwise comparison via specialization of "
+                "cuco::is_bitwise_comparable_v<T>.");
+
+  static_assert(
+    cuco::is_bitwise_comparable_v<Key>,
+    "Key type must have unique object representations or have been explicitly declared as safe for "
+    "bitwise comparison via specialization of cuco::is_bitwise_comparable_v<Key>.");
+
+ public:
+  using key_type            = Key;                                     ///< Key type
+  using mapped_type         = T;                                       ///< Mapped type
+  using value_type          = cuco::pair<key_type, mapped_type>;       ///< Key-value pair type
+  using probing_scheme_type = ProbingScheme;                           ///< Type of probing scheme
+  using storage_ref_type    = StorageRef;                              ///< Type of storage ref
+  using window_type         = typename storage_ref_type::window_type;  ///< Window type
+  using slot_type           = typename storage_ref_type::value_type;   ///< Storage element type
+  using payload_type        = typename slot_type::second_type;         ///< Timestamped payload type
+  using timestamp_type      = typename payload_type::second_type;      ///< Timestamp type
+  using extent_type         = typename storage_ref_type::extent_type;  ///< Extent type
+  using size_type           = typename storage_ref_type::size_type;    ///< Probing scheme size type
+  using key_equal           = KeyEqual;  ///< Type of key equality binary callable
+  using iterator            = typename storage_ref_type::iterator;   ///< Slot iterator type
+  using const_iterator = typename storage_ref_type::const_iterator;  ///< Const slot iterator type
+
+  static constexpr auto cg_size = probing_scheme_type::cg_size;  ///< Cooperative group size
+  static constexpr auto window_size =
+    storage_ref_type::window_size;  ///< Number of elements handled per window
+
+  /**
+   * @brief Constructs expiring_map_ref.
+   *
+   * @param empty_key_sentinel Sentinel indicating empty key
+   * @param empty_value_sentinel Sentinel indicating empty payload
+   * @param erased_key_sentinel Sentinel indicating an expired and tombstoned key
+   * @param time_to_live Lifetime of an entry in timestamp units
+   * @param now Point in time observed by all operations performed through this ref
+   * @param predicate Key equality binary callable
+   * @param probing_scheme Probing scheme
+   * @param storage_ref Non-owning ref of slot storage
+   */
+  __host__ __device__ explicit constexpr expiring_map_ref(
+    cuco::empty_key<key_type> empty_key_sentinel,
+    cuco::empty_value<mapped_type> empty_value_sentinel,
+    cuco::erased_key<key_type> erased_key_sentinel,
+    timestamp_type time_to_live,
+    timestamp_type now,
+    key_equal const& predicate,
+    probing_scheme_type const& probing_scheme,
+    storage_ref_type storage_ref) noexcept;
+
+  /**
+   * @brief Gets the maximum number of elements the container can hold.
+   *
+   * @return The maximum number of elements the container can hold
+   */
+  [[nodiscard]] __host__ __device__ constexpr auto capacity() const noexcept;
+
+  /**
+   * @brief Gets the sentinel value used to represent an empty key slot.
+   *
+   * @return The sentinel value used to represent an empty key slot
+   */
+  [[nodiscard]] __host__ __device__ constexpr key_type empty_key_sentinel() const noexcept;
+
+  /**
+   * @brief Gets the sentinel value used to represent an empty value slot.
+   *
+   * @return The sentinel value used to represent an empty value slot
+   */
+  [[nodiscard]] __host__ __device__ constexpr mapped_type empty_value_sentinel() const noexcept;
+
+  /**
+   * @brief Gets the sentinel value used to represent a tombstoned key slot.
+   *
+   * @return The sentinel value used to represent a tombstoned key slot
+   */
+  [[nodiscard]] __host__ __device__ constexpr key_type erased_key_sentinel() const noexcept;
+
+  /**
+   * @brief Gets the lifetime of an entry in timestamp units.
+   *
+   * @return The lifetime of an entry
+   */
+  [[nodiscard]] __host__ __device__ constexpr timestamp_type time_to_live() const noexcept;
+
+  /**
+   * @brief Gets the point in time observed by this ref.
+   *
+   * @return The current timestamp of this ref
+   */
+  [[nodiscard]] __host__ __device__ constexpr timestamp_type now() const noexcept;
+
+ private:
+  struct predicate_wrapper;
+
+  /// Three-way insert result enum
+  enum class insert_result : int32_t { CONTINUE = 0, SUCCESS = 1, DUPLICATE = 2 };
+
+  /**
+   * @brief Indicates whether the given slot holds an entry that is visible at `now()`.
+   *
+   * @param slot The slot content
+   *
+   * @return `true` if the entry is neither being inserted nor expired
+   */
+  [[nodiscard]] __device__ constexpr bool is_live(slot_type const& slot) const noexcept;
+
+  /**
+   * @brief Indicates whether the given slot can be reclaimed by an insertion.
+   *
+   * @param slot The slot content
+   *
+   * @return `true` if the slot holds a tombstone or an entry that has expired at `now()`
+   */
+  [[nodiscard]] __device__ constexpr bool is_reusable(slot_type const& slot) const noexcept;
+
+  /**
+   * @brief Claims `slot`, currently holding `expected_key`, for the given key and payload.
+   *
+   * @param slot Pointer to the slot in memory
+   * @param expected_key The key expected to be found in the slot, i.e., empty or erased sentinel
+   * @param key The key to insert
+   * @param payload The timestamped payload to insert
+   *
+   * @return Result of this operation, i.e., success/continue/duplicate
+   */
+  [[nodiscard]] __device__ insert_result attempt_claim(slot_type* slot,
+                                                       key_type const& expected_key,
+                                                       key_type const& key,
+                                                       payload_type const& payload) noexcept;
+
+  /**
+   * @brief Reclaims `slot`, holding a tombstone or an expired entry, for the given key and payload.
+   *
+   * @param slot Pointer to the slot in memory
+   * @param key The key to insert
+   * @param payload The timestamped payload to insert
+   *
+   * @return Result of this operation, i.e., success/continue/duplicate
+   */
+  [[nodiscard]] __device__ insert_result attempt_reuse(slot_type* slot,
+                                                       key_type const& key,
+                                                       payload_type const& payload) noexcept;
+
+  /**
+   * @brief Refreshes the payload of an existing entry if and only if it has expired.
+   *
+   * @param slot Pointer to the slot in memory whose key matches the key to insert
+   * @param payload The timestamped payload to insert
+   *
+   * @return `true` if the expired entry has been refreshed with `payload`
+   */
+  [[nodiscard]] __device__ bool refresh(slot_type* slot, payload_type const& payload) noexcept;
+
+  /**
+   * @brief Compares the content of the address `address` (old value) with the `expected` value and,
+   * only if they are the same, sets the content of `address` to `desired`.
+   *
+   * @tparam U Address content type
+   *
+   * @param address The target address
+   * @param expected The value expected to be found at the target address
+   * @param desired The value to store at the target address if it is as expected
+   *
+   * @return The old value located at address `address`
+   */
+  template <typename U>
+  __device__ constexpr auto compare_and_swap(U* address, U expected, U desired);
+
+  /**
+   * @brief Atomically stores `value` at the given `address`.
+   *
+   * @tparam U Address content type
+   *
+   * @param address The target address
+   * @param value The value to store
+   */
+  template <typename U>
+  __device__ constexpr void atomic_store(U* address, U value);
+
+  impl_type impl_;                      ///< Open addressing ref implementation
+  predicate_wrapper predicate_;         ///< Key equality binary callable
+  mapped_type empty_value_sentinel_;    ///< Empty value sentinel
+  key_type erased_key_sentinel_;        ///< Erased key sentinel
+  timestamp_type time_to_live_;         ///< Lifetime of an entry
+  timestamp_type now_;                  ///< Point in time observed by this ref
+  probing_scheme_type probing_scheme_;  ///< Probing scheme
+  storage_ref_type storage_ref_;        ///< Slot storage ref
+
+  // Mixins need to be friends with this class in order to access private members
+  template <typename Op, typename Ref>
+  friend class detail::operator_impl;
+};
+
+}  // namespace experimental
+}  // namespace cuco
+
+#include <cuco/detail/expiring_map/expiring_map_ref.inl>
@@ -16,7 +16,12 @@
 
 #pragma once
 
+#include <cuco/detail/hash_functions/crc32c.cuh>
+#include <cuco/detail/hash_functions/multiply_shift.cuh>
 #include <cuco/detail/hash_functions/murmurhash3.cuh>
+#include <cuco/detail/hash_functions/rapidhash.cuh>
+#include <cuco/detail/hash_functions/tabulation.cuh>
+#include <cuco/detail/hash_functions/tuple_hash.cuh>
 #include <cuco/detail/hash_functions/xxhash.cuh>
 
 namespace cuco {
@@ -51,6 +56,17 @@ using murmurhash3_fmix_64 = detail::MurmurHash3_fmix64<Key>;
 template <typename Key>
 using murmurhash3_32 = detail::MurmurHash3_32<Key>;
 
+/**
+ * @brief A 128-bit `MurmurHash3` hash function, optimized for 64-bit platforms, to hash the given
+ * argument on host and device.
+ *
+ * The result holds the two 64-bit halves of the hash.
+ *
+ * @tparam Key The type of the values to hash
+ */
+template <typename Key>
+using murmurhash3_x64_128 = detail::MurmurHash3_x64_128<Key>;
+
 /**
  * @brief A 32-bit `XXH32` hash function to hash the given argument on host and device.
  *
@@ -67,9 +83,131 @@ using xxhash_32 = detail::XXHash_32<Key>;
 template <typename Key>
 using xxhash_64 = detail::XXHash_64<Key>;
 
+/**
+ * @brief A 64-bit `XXH3_64bits` hash function to hash the given argument on host and device.
+ *
+ * Keys of up to 16 bytes are hashed by dedicated fast paths, which makes it cheaper than
+ * `xxhash_32` and `xxhash_64` for 4 and 8-byte keys.
+ *
+ * @tparam Key The type of the values to hash
+ */
+template <typename Key>
+using xxhash3_64 = detail::XXHash3_64<Key>;
+
+/**
+ * @brief A 128-bit `XXH3_128bits` hash function to hash the given argument on host and device.
+ *
+ * The result holds the low and high 64 bits of the hash. Both halves can be used as independent
+ * hash values, e.g., for the initial slot and the step size of `double_hashing`.
+ *
+ * @tparam Key The type of the values to hash
+ */
+template <typename Key>
+using xxhash_128 = detail::XXHash3_128<Key>;
+
+/**
+ * @brief A 64-bit `rapidhash` hash function, the successor of `wyhash`, to hash the given argument
+ * on host and device.
+ *
+ * Each 16 bytes of input cost a single folded 64x64->128-bit multiplication, which makes it the
+ * cheapest of the general-purpose hash functions for small keys.
+ *
+ * @tparam Key The type of the values to hash
+ */
+template <typename Key>
+using rapidhash_64 = detail::RapidHash_64<Key>;
+
+/**
+ * @brief A 32-bit `CRC32C` hash function to hash the given argument on host and device.
+ *
+ * Uses the SSE4.2 or ARMv8 CRC32C instructions on hosts providing them, and a portable
+ * implementation yielding identical results on device and on other hosts. The checksum is mixed
+ * with the seed by the `MurmurHash3` 32-bit finalizer.
+ *
+ * @note CRC32C spreads dense integer keys well, which makes it a cheap first-level hash for linear
+ * probing, but its collisions are linear and thus easy to construct. Prefer a general-purpose hash
+ * function for adversarial or highly structured keys.
+ *
+ * @tparam Key The type of the values to hash
+ */
+template <typename Key>
+using crc32c_32 = detail::CRC32C_32<Key>;
+
+/**
+ * @brief A 64-bit multiply-shift (Fibonacci) universal hash function to hash integer keys on host
+ * and device.
+ *
+ * @throw Key type must be an integral type
+ * @throw Key type must be at most 8 bytes in size
+ *
+ * @tparam Key The type of the values to hash
+ */
+template <typename Key>
+using multiply_shift = detail::MultiplyShift<Key>;
+
+/**
+ * @brief A 32-bit twisted tabulation hash function to hash keys of up to 8 bytes on host and
+ * device.
+ *
+ * Its seeded lookup tables are stored in the hash function object. Tabulation hashing gives
+ * strong independence guarantees for any set of keys, e.g., for cuckoo hashing or sketches.
+ *
+ * @throw Key type must be at most 8 bytes in size
+ *
+ * @tparam Key The type of the values to hash
+ */
+template <typename Key>
+using tabulation_32 = detail::TabulationHash<Key>;
+
+/**
+ * @brief An incremental 32-bit `XXH32` hash function to hash a sequence of inputs on host and
+ * device.
+ *
+ * Appending bytes or values with `update` and calling `digest` yields the same hash value as
+ * `xxhash_32` on the concatenation of the inputs.
+ */
+using incremental_xxhash_32 = detail::IncrementalXXHash_32;
+
+/**
+ * @brief An incremental 64-bit `XXH64` hash function to hash a sequence of inputs on host and
+ * device.
+ *
+ * Appending bytes or values with `update` and calling `digest` yields the same hash value as
+ * `xxhash_64` on the concatenation of the inputs.
+ */
+using incremental_xxhash_64 = detail::IncrementalXXHash_64;
+
+/**
+ * @brief An incremental 32-bit `MurmurHash3` hash function to hash a sequence of inputs on host and
+ * device.
+ *
+ * Appending bytes or values with `update` and calling `digest` yields the same hash value as
+ * `murmurhash3_32` on the concatenation of the inputs.
+ */
+using incremental_murmurhash3_32 = detail::IncrementalMurmurHash3_32;
+
+/**
+ * @brief A hash function for `thrust::tuple` and `cuco::pair` keys on host and device.
+ *
+ * The elements are hashed in a single pass by the given incremental hash function, as if their
+ * bytes were concatenated, e.g., `tuple_hash<incremental_xxhash_32>{}(thrust::make_tuple(a, b))`
+ * equals `xxhash_32` of the bytes of `a` followed by the bytes of `b`.
+ *
+ * @tparam Hasher Incremental hash function type
+ */
+template <typename Hasher = incremental_xxhash_32>
+using tuple_hash = detail::TupleHash<Hasher>;
+
 /**
  * @brief Default hash function.
  *
+ * @note `xxhash3_64` and `rapidhash_64` are cheaper for small keys. The default remains
+ * `xxhash_32` so that the hash values, and thus the slot layouts, of existing containers do not
+ * change.
+ *
+ * @note Like all hash functions above but the integer finalizers and `multiply_shift`, it hashes
+ * `float` and `double` keys by value: `-0.0` and `+0.0` hash alike, and so do all NaNs.
+ *
  * @tparam Key The type of the values to hash
  */
 template <typename Key>
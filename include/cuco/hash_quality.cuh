@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cuco/extent.cuh>
+#include <cuco/probing_scheme.cuh>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace cuco {
+namespace experimental {
+
+/**
+ * @brief Distribution of the probe lengths of keys inserted into a simulated table.
+ *
+ * Probe lengths are measured in probing steps, i.e., in the number of windows visited until a
+ * window with a free slot is found. They are also the probe lengths of successful lookups of the
+ * same keys.
+ */
+struct probe_length_report {
+  std::size_t num_keys;                ///< Number of keys inserted
+  std::size_t num_failed;              ///< Number of keys whose probing sequence found no free slot
+  double load_factor;                  ///< Load factor once all keys are inserted
+  double mean_probes;                  ///< Mean number of probing steps of the inserted keys
+  std::size_t max_probes;              ///< Largest number of probing steps of an inserted key
+  std::vector<std::size_t> histogram;  ///< `histogram[i]` keys were inserted after `i + 1` steps
+};
+
+/**
+ * @brief Measures how far the given hash function is from the strict avalanche criterion.
+ *
+ * For every input bit, flipping it in each of the given keys should flip every output bit with
+ * probability 1/2. The bias of an input bit is the distance between 1/2 and the observed ratio of
+ * flipped output bits.
+ *
+ * @note This function runs on the host.
+ *
+ * @tparam Hash Unary hash function type with an integral result
+ * @tparam InputIt Host input iterator type whose value type is integral
+ *
+ * @param hash Hash function
+ * @param first Beginning of the sequence of keys
+ * @param last End of the sequence of keys
+ *
+ * @return The largest bias over all input bits, from 0 (ideal) to 0.5
+ */
+template <typename Hash, typename InputIt>
+[[nodiscard]] double avalanche_bias(Hash const& hash, InputIt first, InputIt last);
+
+/**
+ * @brief Measures how uniformly the given hash function spreads keys over buckets.
+ *
+ * Each key goes to bucket `hash(key) % num_buckets`, as in an open addressing container with
+ * `num_buckets` windows. The chi-square statistic of the bucket sizes is normalized by its
+ * expectation for a uniform random hash function.
+ *
+ * @note This function runs on the host.
+ *
+ * @tparam Hash Unary hash function type with an integral result
+ * @tparam InputIt Host input iterator type
+ *
+ * @param hash Hash function
+ * @param first Beginning of the sequence of keys
+ * @param last End of the sequence of keys
+ * @param num_buckets Number of buckets
+ *
+ * @throw If `num_buckets` is smaller than 2
+ *
+ * @return Normalized chi-square statistic: about 1 for a uniform spread, much larger if keys
+ * cluster into few buckets
+ */
+template <typename Hash, typename InputIt>
+[[nodiscard]] double bucket_chi_square(Hash const& hash,
+                                       InputIt first,
+                                       InputIt last,
+                                       std::size_t num_buckets);
+
+/**
+ * @brief Simulates inserting the given keys into an empty table and measures their probe lengths.
+ *
+ * Keys are inserted one after the other, each into the first window of its probing sequence that
+ * has a free slot. The probing sequence is the one of a single thread, i.e., as if `CGSize` of
+ * the probing scheme were 1. A key whose probing sequence visits `num_windows` windows without
+ * finding a free slot, e.g., because the step size of double hashing and a non-prime extent have a
+ * common factor, is counted as failed and not inserted.
+ *
+ * @note This function runs on the host.
+ *
+ * @tparam ProbingScheme Probing scheme type, e.g., `cuco::experimental::linear_probing`
+ * @tparam InputIt Host input iterator type
+ *
+ * @param probing_scheme Probing scheme
+ * @param first Beginning of the sequence of keys
+ * @param last End of the sequence of keys
+ * @param num_windows Number of windows of the table, e.g., prime or power of two
+ * @param window_size Number of slots per window
+ *
+ * @throw If the table is empty or cannot hold all the keys
+ *
+ * @return Probe length distribution of the inserted keys
+ */
+template <typename ProbingScheme, typename InputIt>
+[[nodiscard]] probe_length_report probe_lengths(ProbingScheme const& probing_scheme,
+                                                InputIt first,
+                                                InputIt last,
+                                                std::size_t num_windows,
+                                                int32_t window_size = 1);
+
+}  // namespace experimental
+}  // namespace cuco
+
+#include <cuco/detail/hash_quality/hash_quality.inl>
@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cuco/cuda_stream_ref.hpp>
+#include <cuco/hash_functions.cuh>
+
+#include <cstdint>
+
+namespace cuco {
+namespace experimental {
+
+/**
+ * @brief Computes the MinHash signatures of all sets stored in the compressed sparse format
+ * described by `[offsets_first, offsets_last)` and `elements_first`.
+ *
+ * The elements of the `s`-th set are `[elements_first + offsets[s], elements_first +
+ * offsets[s + 1])`. The `i`-th component of the signature of a set is the minimum of `Hash<T>(i)`
+ * over all elements of the set, where `T` is the value type of `InputIt`, and is written to
+ * `(output_begin + s * num_hashes + i)`. The fraction of equal components of the signatures of two
+ * sets estimates their Jaccard similarity. The signature of an empty set consists of the maximum
+ * value of `Hash<T>::result_type`.
+ *
+ * Each set is processed by a tile of threads that load chunks of elements with coalesced reads and
+ * broadcast them to all threads of the tile, each of which computes a different hash function.
+ *
+ * @note This function synchronizes the given stream. For asynchronous execution use
+ * `minhash_async`.
+ *
+ * @tparam Hash Seeded hash function template, e.g., `cuco::xxhash_64` or `cuco::murmurhash3_32`,
+ * whose instances are constructible from a `std::uint32_t` seed
+ * @tparam OffsetIt Device accessible random access input iterator of set offsets
+ * @tparam InputIt Device accessible random access input iterator of set elements
+ * @tparam OutputIt Device accessible random access output iterator assignable from
+ * `Hash<T>::result_type`
+ *
+ * @param offsets_first Beginning of the sequence of `num_sets + 1` set offsets
+ * @param offsets_last End of the sequence of set offsets
+ * @param elements_first Beginning of the sequence of set elements
+ * @param num_hashes Number of hash functions, i.e., length of each signature
+ * @param output_begin Beginning of the sequence of `num_sets * num_hashes` signature components
+ * @param stream CUDA stream used for this operation
+ */
+template <template <typename> class Hash = cuco::xxhash_64,
+          typename OffsetIt,
+          typename InputIt,
+          typename OutputIt>
+void minhash(OffsetIt offsets_first,
+             OffsetIt offsets_last,
+             InputIt elements_first,
+             int32_t num_hashes,
+             OutputIt output_begin,
+             cuda_stream_ref stream = {});
+
+/**
+ * @brief Asynchronously computes the MinHash signatures of all sets stored in the compressed sparse
+ * format described by `[offsets_first, offsets_last)` and `elements_first`.
+ *
+ * @note See `minhash` for the layout of the input and output sequences.
+ *
+ * @tparam Hash Seeded hash function template, e.g., `cuco::xxhash_64` or `cuco::murmurhash3_32`,
+ * whose instances are constructible from a `std::uint32_t` seed
+ * @tparam OffsetIt Device accessible random access input iterator of set offsets
+ * @tparam InputIt Device accessible random access input iterator of set elements
+ * @tparam OutputIt Device accessible random access output iterator assignable from
+ * `Hash<T>::result_type`
+ *
+ * @param offsets_first Beginning of the sequence of `num_sets + 1` set offsets
+ * @param offsets_last End of the sequence of set offsets
+ * @param elements_first Beginning of the sequence of set elements
+ * @param num_hashes Number of hash functions, i.e., length of each signature
+ * @param output_begin Beginning of the sequence of `num_sets * num_hashes` signature components
+ * @param stream CUDA stream used for this operation
+ */
+template <template <typename> class Hash = cuco::xxhash_64,
+          typename OffsetIt,
+          typename InputIt,
+          typename OutputIt>
+void minhash_async(OffsetIt offsets_first,
+                   OffsetIt offsets_last,
+                   InputIt elements_first,
+                   int32_t num_hashes,
+                   OutputIt output_begin,
+                   cuda_stream_ref stream = {}) noexcept;
+
+}  // namespace experimental
+}  // namespace cuco
+
+#include <cuco/detail/minhash/minhash.inl>
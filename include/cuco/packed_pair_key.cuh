@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cuco/detail/traits.hpp>
+#include <cuco/utility/traits.hpp>
+
+#include <thrust/device_reference.h>
+#include <thrust/tuple.h>
+
+#include <cstdint>
+#include <type_traits>
+
+namespace cuco {
+
+/**
+ * @brief A composite key of two 4-byte integers packed into 8 bytes, e.g., the source and
+ * destination vertices of a graph edge.
+ *
+ * The key fits the 8-byte key limit of the containers without manual packing. It has no padding,
+ * so `cuco::is_bitwise_comparable_v` holds, and byte-wise hash functions such as
+ * `cuco::default_hash_function` hash it like the 8-byte integer returned by `pack()`. Two keys are
+ * equal if both of their elements are equal.
+ *
+ * Keys can be built on the fly from two separate columns, e.g., from a `thrust::zip_iterator`,
+ * without materializing the packed keys.
+ *
+ * @tparam First Type of the first element, a 4-byte integer
+ * @tparam Second Type of the second element, a 4-byte integer
+ */
+template <typename First = std::int32_t, typename Second = std::int32_t>
+struct alignas(8) packed_pair_key {
+  static_assert(std::is_integral_v<First> and sizeof(First) == 4,
+                "First element type must be a 4-byte integer.");
+  static_assert(std::is_integral_v<Second> and sizeof(Second) == 4,
+                "Second element type must be a 4-byte integer.");
+
+  using first_type  = First;   ///< Type of the first element
+  using second_type = Second;  ///< Type of the second element
+
+  packed_pair_key() = default;
+
+  /**
+   * @brief Constructs a key from its two elements.
+   *
+   * @param f The first element
+   * @param s The second element
+   */
+  __host__ __device__ constexpr packed_pair_key(First f, Second s) noexcept;
+
+  /**
+   * @brief Constructs a key from the given thrust::pair-like `p`, e.g., the element of a
+   * `thrust::zip_iterator` over two columns.
+   *
+   * @tparam T Type of the pair to copy from
+   *
+   * @param p The input pair to copy from
+   */
+  template <typename T, std::enable_if_t<detail::is_thrust_pair_like<T>::value>* = nullptr>
+  __host__ __device__ constexpr packed_pair_key(T const& p)
+    : packed_pair_key{static_cast<First>(thrust::get<0>(thrust::raw_reference_cast(p))),
+                      static_cast<Second>(thrust::get<1>(thrust::raw_reference_cast(p)))}
+  {
+  }
+
+  /**
+   * @brief Returns the key as a single 8-byte integer.
+   *
+   * The first element makes up the low 32 bits and the second element the high 32 bits, which is
+   * also the object representation of the key on little-endian hosts and devices.
+   *
+   * @return The packed key
+   */
+  [[nodiscard]] __host__ __device__ constexpr std::uint64_t pack() const noexcept;
+
+  /**
+   * @brief Returns the key packed into the given 8-byte integer by `pack()`.
+   *
+   * @param packed The packed key
+   * @return The unpacked key
+   */
+  [[nodiscard]] __host__ __device__ static constexpr packed_pair_key unpack(
+    std::uint64_t packed) noexcept;
+
+  First first;    ///< The first element
+  Second second;  ///< The second element
+};
+
+/**
+ * @brief Tests if both elements of lhs and rhs are equal
+ *
+ * @tparam First Type of the first element
+ * @tparam Second Type of the second element
+ *
+ * @param lhs Left-hand side key
+ * @param rhs Right-hand side key
+ *
+ * @return True if the two keys are equal. False otherwise
+ */
+template <typename First, typename Second>
+__host__ __device__ constexpr bool operator==(packed_pair_key<First, Second> const& lhs,
+                                              packed_pair_key<First, Second> const& rhs) noexcept;
+
+/**
+ * @brief Tests if any element of lhs and rhs differs
+ *
+ * @tparam First Type of the first element
+ * @tparam Second Type of the second element
+ *
+ * @param lhs Left-hand side key
+ * @param rhs Right-hand side key
+ *
+ * @return True if the two keys are not equal. False otherwise
+ */
+template <typename First, typename Second>
+__host__ __device__ constexpr bool operator!=(packed_pair_key<First, Second> const& lhs,
+                                              packed_pair_key<First, Second> const& rhs) noexcept;
+
+}  // namespace cuco
+
+#include <cuco/detail/packed_pair_key.inl>
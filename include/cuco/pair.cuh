@@ -18,6 +18,7 @@
 
 #include <cuco/detail/traits.hpp>
 #include <cuco/detail/utils.cuh>
+#include <cuco/utility/traits.hpp>
 
 #include <thrust/device_reference.h>
 #include <thrust/tuple.h>
@@ -141,6 +142,19 @@ template <class T1, class T2, class U1, class U2>
 __host__ __device__ constexpr bool operator==(cuco::pair<T1, T2> const& lhs,
                                               cuco::pair<U1, U2> const& rhs) noexcept;
 
+/**
+ * @brief A pair of bitwise comparable elements without padding is bitwise comparable, e.g., a
+ * `float` key with an `int32_t` payload.
+ */
+template <typename First, typename Second>
+struct is_bitwise_comparable<
+  pair<First, Second>,
+  std::enable_if_t<not std::has_unique_object_representations_v<pair<First, Second>> and
+                   is_bitwise_comparable_v<First> and is_bitwise_comparable_v<Second> and
+                   sizeof(pair<First, Second>) == sizeof(First) + sizeof(Second)>>
+  : std::true_type {
+};
+
 }  // namespace cuco
 
 #include <cuco/detail/pair.inl>
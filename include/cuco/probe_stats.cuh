@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace cuco {
+namespace experimental {
+/**
+ * @brief Disabled probing statistics policy.
+ *
+ * This is the default statistics policy of the open addressing containers: no counters are
+ * allocated and the instrumentation compiles away entirely.
+ */
+class no_probe_stats {
+ public:
+  static constexpr bool enabled = false;  ///< Whether statistics are collected
+};
+
+/**
+ * @brief Probing statistics policy collecting probe-length histograms and CAS statistics.
+ *
+ * When used as the `StatsPolicy` of an open addressing container, every device operation records
+ * the number of windows it visited, and every insertion records its failed CAS attempts and
+ * whether its key was already present, either found in the container or inserted concurrently by
+ * another thread. Device counters are updated with warp-aggregated atomics. The accumulated
+ * counters can be retrieved with the `stats()` member function of the container after bulk
+ * operations.
+ *
+ * @note Probe lengths are counted in windows, i.e., a probe length of `1` means that the operation
+ * completed in the first window of its probing sequence.
+ *
+ * @tparam NumBins Number of histogram bins. The last bin counts all operations visiting at least
+ * `NumBins` windows
+ */
+template <int32_t NumBins = 16>
+class probe_stats {
+  static_assert(NumBins > 0, "The number of histogram bins must be positive.");
+
+ public:
+  static constexpr bool enabled     = true;     ///< Whether statistics are collected
+  static constexpr int32_t num_bins = NumBins;  ///< Number of histogram bins
+};
+
+/**
+ * @brief Probing statistics retrieved from an instrumented container.
+ *
+ * @note Bin `i` of a histogram counts the operations that visited `i + 1` windows, except for the
+ * last bin that also counts all longer probing sequences.
+ */
+struct probe_stats_summary {
+  std::vector<std::uint64_t> insert_probe_lengths;  ///< Probe-length histogram of insertions
+  std::vector<std::uint64_t> lookup_probe_lengths;  ///< Probe-length histogram of lookups
+  std::uint64_t num_cas_failures;  ///< Number of CAS attempts that lost a race to another key
+  std::uint64_t num_duplicates;    ///< Number of insertions of a key already present
+};
+
+}  // namespace experimental
+}  // namespace cuco
+
+#include <cuco/detail/probe_stats/probe_stats.cuh>
@@ -92,6 +92,10 @@ class linear_probing : private detail::probing_scheme_base<CGSize> {
  *
  * @note `Hash2` needs to be able to construct from an integer value to avoid secondary clustering.
  *
+ * @note If `Hash1` returns a 128-bit hash as two 64-bit halves, e.g., `cuco::xxhash_128` or
+ * `cuco::murmurhash3_x64_128`, the initial slot and the step size are derived from the two halves
+ * of a single `Hash1` evaluation and `Hash2` is not evaluated.
+ *
  * @tparam CGSize Size of CUDA Cooperative Groups
  * @tparam Hash1 Unary callable type
  * @tparam Hash2 Unary callable type
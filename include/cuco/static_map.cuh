@@ -17,12 +17,16 @@
 #pragma once
 
 #include <cuco/detail/__config>
+#include <cuco/detail/canonicalize.cuh>
 #include <cuco/detail/open_addressing_impl.cuh>
 #include <cuco/detail/static_map_kernels.cuh>
 #include <cuco/hash_functions.cuh>
+#include <cuco/probe_stats.cuh>
 #include <cuco/pair.cuh>
 #include <cuco/sentinel.cuh>
 #include <cuco/static_map_ref.cuh>
+#include <cuco/table_analysis.hpp>
+#include <cuco/tracing.hpp>
 #include <cuco/utility/allocator.hpp>
 #include <cuco/utility/traits.hpp>
 
@@ -83,6 +87,7 @@ namespace experimental {
  * @tparam ProbingScheme Probing scheme (see `include/cuco/probing_scheme.cuh` for choices)
  * @tparam Allocator Type of allocator used for device storage
  * @tparam Storage Slot window storage type
+ * @tparam StatsPolicy Probing statistics policy (see `include/cuco/probe_stats.cuh` for choices)
  */
 
 template <class Key,
@@ -93,9 +98,11 @@ template <class Key,
           class ProbingScheme =
             cuco::experimental::double_hashing<4,  // CG size
                                                cuco::default_hash_function<Key>>,
-          class Allocator = cuco::cuda_allocator<cuco::pair<Key, T>>,
-          class Storage   = cuco::experimental::aow_storage<1>>
-class static_map {
+          class Allocator   = cuco::cuda_allocator<cuco::pair<Key, T>>,
+          class Storage     = cuco::experimental::aow_storage<1>,
+          class StatsPolicy = cuco::experimental::no_probe_stats>
+class static_map
+  : private detail::probe_stats_traits<StatsPolicy>::template storage_type<Allocator> {
   static_assert(sizeof(Key) <= 8, "Container does not support key types larger than 8 bytes.");
 
   static_assert(sizeof(T) <= 8, "Container does not support payload types larger than 8 bytes.");
@@ -113,6 +120,12 @@ class static_map {
                                                  ProbingScheme,
                                                  Allocator,
                                                  Storage>;
+  /// Probing statistics storage type, an empty base if statistics are disabled
+  using stats_storage_type =
+    typename detail::probe_stats_traits<StatsPolicy>::template storage_type<Allocator>;
+  /// Non-owning storage ref type of device refs, carrying the statistics ref if enabled
+  using ref_storage_type = typename detail::probe_stats_traits<
+    StatsPolicy>::template storage_ref_type<typename impl_type::storage_ref_type>;
 
  public:
   static constexpr auto cg_size      = impl_type::cg_size;       ///< CG size used for probing
@@ -128,6 +141,7 @@ class static_map {
   /// Non-owning window storage ref type
   using storage_ref_type    = typename impl_type::storage_ref_type;
   using probing_scheme_type = typename impl_type::probing_scheme_type;  ///< Probing scheme type
+  using stats_policy_type   = StatsPolicy;                              ///< Statistics policy type
 
   using mapped_type = T;  ///< Payload type
   template <typename... Operators>
@@ -137,7 +151,7 @@ class static_map {
                                        thread_scope,
                                        key_equal,
                                        probing_scheme_type,
-                                       storage_ref_type,
+                                       ref_storage_type,
                                        Operators...>;  ///< Non-owning container ref type
 
   static_map(static_map const&) = delete;
@@ -467,6 +481,28 @@ class static_map {
    */
   [[nodiscard]] size_type size(cuda_stream_ref stream = {}) const noexcept;
 
+  /**
+   * @brief Builds a health report of the container, e.g., its load factor, the displacement
+   * distribution of its keys, and the expected number of probing steps of a lookup.
+   *
+   * @note This function synchronizes the given stream.
+   *
+   * @param stream CUDA stream used for this operation
+   * @return Health report of the container
+   */
+  [[nodiscard]] table_analysis analyze(cuda_stream_ref stream = {}) const;
+
+  /**
+   * @brief Attaches a tracer receiving a begin and an end event for every bulk operation of the
+   * container.
+   *
+   * @note Bulk operations are not traced by default. See `include/cuco/tracing.hpp` for the
+   * available tracers.
+   *
+   * @param tracer Tracer to attach, or null to detach the current one
+   */
+  void set_tracer(std::shared_ptr<tracer> tracer);
+
   /**
    * @brief Gets the maximum number of elements the hash map can hold.
    *
@@ -488,6 +524,25 @@ class static_map {
    */
   [[nodiscard]] constexpr mapped_type empty_value_sentinel() const noexcept;
 
+  /**
+   * @brief Gets the probing statistics accumulated since construction or the last call to
+   * `reset_stats`.
+   *
+   * @note This function synchronizes the given stream.
+   * @note Only available if `StatsPolicy` collects statistics, e.g., `cuco::probe_stats<>`.
+   *
+   * @param stream CUDA stream used to copy the statistics to the host
+   * @return Probe-length histograms and CAS statistics
+   */
+  [[nodiscard]] probe_stats_summary stats(cuda_stream_ref stream = {}) const;
+
+  /**
+   * @brief Asynchronously resets the probing statistics to zero.
+   *
+   * @param stream CUDA stream this operation is executed in
+   */
+  void reset_stats(cuda_stream_ref stream = {});
+
   /**
    * @brief Get device ref with operators.
    *
@@ -504,6 +559,24 @@ class static_map {
   std::unique_ptr<impl_type> impl_;   ///< Static map implementation
   mapped_type empty_value_sentinel_;  ///< Sentinel value that indicates an empty payload
 };
+
+/**
+ * @brief `static_map` with scalar linear probing.
+ *
+ * The host bulk operations of `linear_probing_static_map<int32_t, int32_t>` and
+ * `linear_probing_static_map<int64_t, int64_t>` are precompiled by the optional
+ * `cuco_instantiations` library.
+ *
+ * @tparam Key Type used for keys. Requires `cuco::is_bitwise_comparable_v<Key>`
+ * @tparam T Type of the mapped values
+ */
+template <typename Key, typename T>
+using linear_probing_static_map = static_map<Key,
+                                             T,
+                                             extent<std::size_t>,
+                                             cuda::thread_scope_device,
+                                             thrust::equal_to<Key>,
+                                             linear_probing<1, cuco::default_hash_function<Key>>>;
 }  // namespace experimental
 
 template <typename Key, typename Value, cuda::thread_scope Scope, typename Allocator>
@@ -520,6 +593,7 @@ class dynamic_map;
  * Current limitations:
  * - Requires keys and values that where `cuco::is_bitwise_comparable_v<T>` is true
  *    - Comparisons against the "sentinel" values will always be done with bitwise comparisons.
+ * - Does not support floating-point keys, see `cuco::experimental::static_map` instead
  * - Capacity is fixed and will not grow automatically
  * - Requires the user to specify sentinel values for both key and mapped value to indicate empty
  * slots
@@ -600,6 +674,10 @@ class static_map {
                 "declared as safe for bitwise comparison via specialization of "
                 "cuco::is_bitwise_comparable_v<Value>.");
 
+  static_assert(not cuco::detail::is_canonicalized_v<Key>,
+                "Floating-point keys are only supported by the experimental containers, e.g., "
+                "cuco::experimental::static_map.");
+
   friend class dynamic_map<Key, Value, Scope, Allocator>;  ///< Dynamic map as friend class
 
  public:
@@ -1893,3 +1971,4 @@ class static_map {
 
 #include <cuco/detail/static_map.inl>
 #include <cuco/detail/static_map/static_map.inl>
+#include <cuco/detail/static_map/instantiations.inl>
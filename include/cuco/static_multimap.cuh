@@ -17,6 +17,7 @@
 #pragma once
 
 #include <cuco/detail/__config>
+#include <cuco/detail/canonicalize.cuh>
 #include <cuco/detail/prime.hpp>
 #include <cuco/hash_functions.cuh>
 #include <cuco/probe_sequences.cuh>
@@ -53,6 +54,7 @@ namespace cuco {
  * - Requires keys and values where `cuco::is_bitwise_comparable_v<T>` is true
  * - Comparisons against the "sentinel" values will always be done with bitwise comparisons
  * Therefore, the objects must have unique, bitwise object representations (e.g., no padding bits).
+ * - Does not support floating-point keys
  * - Does not support erasing keys
  * - Capacity is fixed and will not grow automatically
  * - Requires the user to specify sentinel values for both key and mapped value
@@ -142,6 +144,10 @@ class static_multimap {
     "Value type must have unique object representations or have been explicitly declared as safe "
     "for bitwise comparison via specialization of cuco::is_bitwise_comparable_v<Value>.");
 
+  static_assert(not cuco::detail::is_canonicalized_v<Key>,
+                "Floating-point keys are only supported by the experimental containers, e.g., "
+                "cuco::experimental::static_map.");
+
   static_assert(
     std::is_base_of_v<cuco::detail::probe_sequence_base<ProbeSequence::cg_size>, ProbeSequence>,
     "ProbeSequence must be a specialization of either cuco::double_hashing or "
@@ -18,12 +18,17 @@
 
 #include <cuco/cuda_stream_ref.hpp>
 #include <cuco/detail/open_addressing_impl.cuh>
+#include <cuco/detail/traits.hpp>
 #include <cuco/extent.cuh>
 #include <cuco/hash_functions.cuh>
+#include <cuco/packed_pair_key.cuh>
+#include <cuco/probe_stats.cuh>
 #include <cuco/probing_scheme.cuh>
 #include <cuco/sentinel.cuh>
 #include <cuco/static_set_ref.cuh>
 #include <cuco/storage.cuh>
+#include <cuco/table_analysis.hpp>
+#include <cuco/tracing.hpp>
 #include <cuco/utility/allocator.hpp>
 #include <cuco/utility/traits.hpp>
 
@@ -36,6 +41,7 @@
 #endif
 
 #include <cstddef>
+#include <memory>
 #include <type_traits>
 
 namespace cuco {
@@ -78,6 +84,7 @@ namespace experimental {
  * @tparam ProbingScheme Probing scheme (see `include/cuco/probing_scheme.cuh` for choices)
  * @tparam Allocator Type of allocator used for device storage
  * @tparam Storage Slot window storage type
+ * @tparam StatsPolicy Probing statistics policy (see `include/cuco/probe_stats.cuh` for choices)
  */
 
 template <class Key,
@@ -87,10 +94,18 @@ template <class Key,
           class ProbingScheme      = experimental::double_hashing<4,  // CG size
                                                              cuco::default_hash_function<Key>>,
           class Allocator          = cuco::cuda_allocator<Key>,
-          class Storage            = cuco::experimental::aow_storage<1>>
-class static_set {
+          class Storage            = cuco::experimental::aow_storage<1>,
+          class StatsPolicy        = cuco::experimental::no_probe_stats>
+class static_set
+  : private detail::probe_stats_traits<StatsPolicy>::template storage_type<Allocator> {
   using impl_type = detail::
     open_addressing_impl<Key, Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>;
+  /// Probing statistics storage type, an empty base if statistics are disabled
+  using stats_storage_type =
+    typename detail::probe_stats_traits<StatsPolicy>::template storage_type<Allocator>;
+  /// Non-owning storage ref type of device refs, carrying the statistics ref if enabled
+  using ref_storage_type = typename detail::probe_stats_traits<
+    StatsPolicy>::template storage_ref_type<typename impl_type::storage_ref_type>;
 
  public:
   static constexpr auto cg_size      = impl_type::cg_size;       ///< CG size used for probing
@@ -106,6 +121,7 @@ class static_set {
   /// Non-owning window storage ref type
   using storage_ref_type    = typename impl_type::storage_ref_type;
   using probing_scheme_type = typename impl_type::probing_scheme_type;  ///< Probing scheme type
+  using stats_policy_type   = StatsPolicy;                              ///< Statistics policy type
 
   template <typename... Operators>
   using ref_type =
@@ -113,7 +129,7 @@ class static_set {
                                        thread_scope,
                                        key_equal,
                                        probing_scheme_type,
-                                       storage_ref_type,
+                                       ref_storage_type,
                                        Operators...>;  ///< Non-owning container ref type
 
   static_set(static_set const&) = delete;
@@ -207,6 +223,35 @@ class static_set {
   template <typename InputIt>
   void insert_async(InputIt first, InputIt last, cuda_stream_ref stream = {}) noexcept;
 
+  /**
+   * @brief Inserts the composite keys made of the elements of two separate columns and returns the
+   * number of successful insertions.
+   *
+   * The `i`-th key is constructed as `key_type{*(first_begin + i), *(second_begin + i)}` on the
+   * fly, e.g., a `cuco::packed_pair_key` from the source and destination columns of an edge list,
+   * so the composite keys are never materialized in memory.
+   *
+   * @note This function synchronizes the given stream.
+   *
+   * @tparam FirstIt Device accessible random access input iterator of the first elements
+   * @tparam SecondIt Device accessible random access input iterator of the second elements
+   *
+   * @param first_begin Beginning of the sequence of first elements
+   * @param first_end End of the sequence of first elements
+   * @param second_begin Beginning of the sequence of second elements
+   * @param stream CUDA stream used for insert
+   *
+   * @return Number of successfully inserted keys
+   */
+  template <typename FirstIt,
+            typename SecondIt,
+            typename = std::enable_if_t<cuco::detail::is_iterator_v<SecondIt> and
+                                        not std::is_convertible_v<SecondIt, cuda_stream_ref>>>
+  size_type insert(FirstIt first_begin,
+                   FirstIt first_end,
+                   SecondIt second_begin,
+                   cuda_stream_ref stream = {});
+
   /**
    * @brief Inserts keys in the range `[first, last)` if `pred` of the corresponding stencil returns
    * true.
@@ -300,6 +345,37 @@ class static_set {
                       OutputIt output_begin,
                       cuda_stream_ref stream = {}) const noexcept;
 
+  /**
+   * @brief Indicates whether the composite keys made of the elements of two separate columns are
+   * contained in the set.
+   *
+   * The `i`-th key is constructed as `key_type{*(first_begin + i), *(second_begin + i)}` on the
+   * fly, so the composite keys are never materialized in memory.
+   *
+   * @note This function synchronizes the given stream.
+   *
+   * @tparam FirstIt Device accessible random access input iterator of the first elements
+   * @tparam SecondIt Device accessible random access input iterator of the second elements
+   * @tparam OutputIt Device accessible output iterator assignable from `bool`
+   *
+   * @param first_begin Beginning of the sequence of first elements
+   * @param first_end End of the sequence of first elements
+   * @param second_begin Beginning of the sequence of second elements
+   * @param output_begin Beginning of the sequence of booleans for the presence of each key
+   * @param stream Stream used for executing the kernels
+   */
+  template <typename FirstIt,
+            typename SecondIt,
+            typename OutputIt,
+            typename = std::enable_if_t<cuco::detail::is_iterator_v<SecondIt> and
+                                        cuco::detail::is_iterator_v<OutputIt> and
+                                        not std::is_convertible_v<OutputIt, cuda_stream_ref>>>
+  void contains(FirstIt first_begin,
+                FirstIt first_end,
+                SecondIt second_begin,
+                OutputIt output_begin,
+                cuda_stream_ref stream = {}) const;
+
   /**
    * @brief Indicates whether the keys in the range `[first, last)` are contained in the set if
    * `pred` of the corresponding stencil returns true.
@@ -434,6 +510,28 @@ class static_set {
    */
   [[nodiscard]] size_type size(cuda_stream_ref stream = {}) const noexcept;
 
+  /**
+   * @brief Builds a health report of the container, e.g., its load factor, the displacement
+   * distribution of its keys, and the expected number of probing steps of a lookup.
+   *
+   * @note This function synchronizes the given stream.
+   *
+   * @param stream CUDA stream used for this operation
+   * @return Health report of the container
+   */
+  [[nodiscard]] table_analysis analyze(cuda_stream_ref stream = {}) const;
+
+  /**
+   * @brief Attaches a tracer receiving a begin and an end event for every bulk operation of the
+   * container.
+   *
+   * @note Bulk operations are not traced by default. See `include/cuco/tracing.hpp` for the
+   * available tracers.
+   *
+   * @param tracer Tracer to attach, or null to detach the current one
+   */
+  void set_tracer(std::shared_ptr<tracer> tracer);
+
   /**
    * @brief Gets the maximum number of elements the hash map can hold.
    *
@@ -448,6 +546,25 @@ class static_set {
    */
   [[nodiscard]] constexpr key_type empty_key_sentinel() const noexcept;
 
+  /**
+   * @brief Gets the probing statistics accumulated since construction or the last call to
+   * `reset_stats`.
+   *
+   * @note This function synchronizes the given stream.
+   * @note Only available if `StatsPolicy` collects statistics, e.g., `cuco::probe_stats<>`.
+   *
+   * @param stream CUDA stream used to copy the statistics to the host
+   * @return Probe-length histograms and CAS statistics
+   */
+  [[nodiscard]] probe_stats_summary stats(cuda_stream_ref stream = {}) const;
+
+  /**
+   * @brief Asynchronously resets the probing statistics to zero.
+   *
+   * @param stream CUDA stream this operation is executed in
+   */
+  void reset_stats(cuda_stream_ref stream = {});
+
   /**
    * @brief Get device ref with operators.
    *
@@ -463,7 +580,24 @@ class static_set {
  private:
   std::unique_ptr<impl_type> impl_;
 };
+
+/**
+ * @brief `static_set` with scalar linear probing.
+ *
+ * The host bulk operations of `linear_probing_static_set<int32_t>` and
+ * `linear_probing_static_set<int64_t>` are precompiled by the optional `cuco_instantiations`
+ * library.
+ *
+ * @tparam Key Type used for keys. Requires `cuco::is_bitwise_comparable_v<Key>`
+ */
+template <typename Key>
+using linear_probing_static_set = static_set<Key,
+                                             extent<std::size_t>,
+                                             cuda::thread_scope_device,
+                                             thrust::equal_to<Key>,
+                                             linear_probing<1, cuco::default_hash_function<Key>>>;
 }  // namespace experimental
 }  // namespace cuco
 
 #include <cuco/detail/static_set/static_set.inl>
+#include <cuco/detail/static_set/instantiations.inl>
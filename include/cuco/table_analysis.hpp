@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace cuco {
+namespace experimental {
+/**
+ * @brief Health report of an open addressing container, as returned by its `analyze()` member
+ * function.
+ *
+ * Displacements and probe counts are measured in probing steps, i.e., in the number of windows a
+ * thread (or a CG of `cg_size` threads) visits: a key stored in the first window of its probing
+ * sequence has a displacement of `0` and is found with `1` probing step.
+ *
+ * @note `expected_probes_miss` is exact for `cuco::experimental::linear_probing`. For other probing
+ * schemes it is estimated from `full_window_fraction`, assuming that the windows visited by a
+ * probing sequence are full independently of each other.
+ */
+struct table_analysis {
+  /// Number of bins of the displacement histogram
+  static constexpr int32_t num_displacement_bins = 32;
+
+  std::size_t capacity;     ///< Number of slots
+  std::size_t num_windows;  ///< Number of windows
+  int32_t window_size;      ///< Number of slots per window
+  int32_t cg_size;          ///< Number of windows visited per probing step
+  std::size_t size;         ///< Number of filled slots
+  double load_factor;       ///< Ratio of filled slots to slots
+  /// Bin `i` counts the keys with a displacement of `i`, the last bin also counts all larger
+  /// displacements
+  std::vector<std::uint64_t> displacement_histogram;
+  std::uint64_t max_displacement;  ///< Largest displacement of any key
+  double mean_displacement;        ///< Mean displacement of the keys
+  std::size_t longest_cluster;     ///< Longest run of consecutive full windows
+  double full_window_fraction;     ///< Ratio of full windows to windows
+  double expected_probes_hit;      ///< Mean number of probing steps of a successful lookup
+  double expected_probes_miss;     ///< Expected number of probing steps of an unsuccessful lookup
+
+  /**
+   * @brief Serializes the report as a JSON object.
+   *
+   * @note An infinite `expected_probes_miss`, i.e., of a table without any empty slot, is written
+   * as `null`.
+   *
+   * @return JSON representation of the report
+   */
+  [[nodiscard]] std::string to_json() const;
+};
+
+}  // namespace experimental
+}  // namespace cuco
+
+#include <cuco/detail/table_analysis/table_analysis.inl>
@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <ostream>
+
+namespace cuco {
+namespace experimental {
+/**
+ * @brief Begin or end event of a traced bulk operation.
+ */
+struct trace_event {
+  char const* name;      ///< Name of the operation, e.g., `"insert_async"`
+  std::size_t num_keys;  ///< Number of input keys, or of scanned slots for whole-container ops
+  std::size_t capacity;  ///< Capacity of the container
+  double load_factor;    ///< Load factor of the container, NaN unless requested by the tracer
+  double duration;       ///< Host wall-clock duration in seconds, `0` for begin events
+};
+
+/**
+ * @brief Base class of the tracing backends of open addressing containers.
+ *
+ * Once attached to a container with `set_tracer`, a tracer receives a begin and an end event for
+ * every bulk operation of the container. Without a tracer, tracing costs a null check per bulk
+ * operation.
+ *
+ * @note The duration of an operation is the host wall-clock time of the call. For asynchronous
+ * operations it only covers launching the work, not executing it. For synchronous operations it
+ * includes the final stream synchronization.
+ * @note A public operation implemented in terms of another one, e.g., `clear` calling
+ * `clear_async`, is traced once under its own name, i.e., the name of the outermost operation.
+ * @note Events are delivered on the calling host thread. Since bulk operations may be `noexcept`,
+ * the event handlers are `noexcept` as well.
+ */
+class tracer {
+ public:
+  virtual ~tracer() = default;
+
+  /**
+   * @brief Called before a bulk operation.
+   *
+   * @param event Event of the operation
+   */
+  virtual void begin(trace_event const& event) noexcept = 0;
+
+  /**
+   * @brief Called after a bulk operation.
+   *
+   * @param event Event of the operation
+   */
+  virtual void end(trace_event const& event) noexcept = 0;
+
+  /**
+   * @brief Indicates whether events should carry the load factor of the container.
+   *
+   * @note Computing the load factor launches a `size` kernel and synchronizes the stream of the
+   * operation before and after it, which serializes asynchronous operations.
+   *
+   * @return `true` if events should carry the load factor
+   */
+  [[nodiscard]] virtual bool wants_load_factor() const noexcept { return false; }
+};
+
+/**
+ * @brief Tracer forwarding events to user callbacks.
+ *
+ * @note Exceptions thrown by the callbacks are caught and discarded.
+ */
+class callback_tracer : public tracer {
+ public:
+  using callback_type = std::function<void(trace_event const&)>;  ///< Type of event callbacks
+
+  /**
+   * @brief Constructs a tracer invoking the given callbacks.
+   *
+   * @param on_begin Callback invoked with begin events, may be empty
+   * @param on_end Callback invoked with end events, may be empty
+   * @param with_load_factor Whether events should carry the load factor of the container
+   */
+  callback_tracer(callback_type on_begin, callback_type on_end, bool with_load_factor = false);
+
+  void begin(trace_event const& event) noexcept override;
+  void end(trace_event const& event) noexcept override;
+  [[nodiscard]] bool wants_load_factor() const noexcept override;
+
+ private:
+  callback_type on_begin_;  ///< Callback of begin events
+  callback_type on_end_;    ///< Callback of end events
+  bool with_load_factor_;   ///< Whether events carry the load factor
+};
+
+/**
+ * @brief Tracer writing events in the Chrome trace event format, viewable in `chrome://tracing`
+ * or Perfetto.
+ *
+ * Events of all host threads are written as duration events of a single process, with the keys
+ * count, capacity and load factor as arguments. The output is a JSON array that is closed when the
+ * writer is destroyed.
+ */
+class chrome_trace_writer : public tracer {
+ public:
+  /**
+   * @brief Constructs a writer and opens the JSON array of events.
+   *
+   * @param out Output stream, which must outlive the writer
+   * @param with_load_factor Whether events should carry the load factor of the container
+   */
+  explicit chrome_trace_writer(std::ostream& out, bool with_load_factor = false);
+
+  chrome_trace_writer(chrome_trace_writer const&) = delete;
+  chrome_trace_writer& operator=(chrome_trace_writer const&) = delete;
+
+  /**
+   * @brief Closes the JSON array of events.
+   */
+  ~chrome_trace_writer() override;
+
+  void begin(trace_event const& event) noexcept override;
+  void end(trace_event const& event) noexcept override;
+  [[nodiscard]] bool wants_load_factor() const noexcept override;
+
+ private:
+  /**
+   * @brief Writes an event of the given phase, `'B'` for begin or `'E'` for end. The event is
+   * dropped if writing it throws.
+   */
+  void write(trace_event const& event, char phase) noexcept;
+
+  std::ostream& out_;                             ///< Output stream
+  std::mutex mutex_;                              ///< Serializes writes of concurrent threads
+  std::chrono::steady_clock::time_point origin_;  ///< Time origin of the timestamps
+  bool is_first_{true};                           ///< Whether no event was written yet
+  bool with_load_factor_;                         ///< Whether events carry the load factor
+};
+
+#if __has_include(<nvtx3/nvToolsExt.h>)
+/**
+ * @brief Tracer emitting an NVTX range per operation, visible in Nsight Systems.
+ *
+ * The range message holds the operation name, keys count and capacity, e.g.,
+ * `"cuco::insert_async (num_keys=1000, capacity=2048)"`.
+ */
+class nvtx_tracer : public tracer {
+ public:
+  void begin(trace_event const& event) noexcept override;
+  void end(trace_event const& event) noexcept override;
+};
+#endif
+
+}  // namespace experimental
+}  // namespace cuco
+
+#include <cuco/detail/tracing/tracing.inl>
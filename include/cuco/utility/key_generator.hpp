@@ -29,6 +29,8 @@
 #include <thrust/transform.h>
 #include <thrust/type_traits/is_execution_policy.h>
 
+#include <algorithm>
+#include <cmath>
 #include <cstdint>
 #include <iterator>
 #include <time.h>
@@ -70,8 +72,130 @@ struct gaussian : public cuco::detail::strong_type<double> {
   }
 };
 
+/**
+ * @brief Tag struct representing a Zipfian distribution.
+ *
+ * The `i`-th most frequent key, `i` in `[0, N)`, is drawn with a probability proportional to
+ * `1 / (i + 1)^alpha`.
+ */
+struct zipf : public cuco::detail::strong_type<double> {
+  /**
+   * @param alpha Exponent of the distribution. The larger, the more skewed the distribution is.
+   */
+  zipf(double alpha) : cuco::detail::strong_type<double>{alpha}
+  {
+    CUCO_EXPECTS(alpha > 0, "Exponent must be greater than 0");
+  }
+};
+
+/**
+ * @brief Tag struct representing a hot-set distribution.
+ *
+ * Keys are drawn uniformly from a hot set of `fraction * N` keys with the given probability, and
+ * uniformly from the remaining keys otherwise.
+ */
+struct hotset {
+  /**
+   * @param fraction Fraction of the key range forming the hot set, in `(0, 1]`
+   * @param probability Probability that a key is drawn from the hot set, in `[0, 1]`
+   */
+  hotset(double fraction, double probability) : fraction{fraction}, probability{probability}
+  {
+    CUCO_EXPECTS(fraction > 0.0 and fraction <= 1.0, "Fraction needs to be in (0, 1]");
+    CUCO_EXPECTS(probability >= 0.0 and probability <= 1.0,
+                 "Probability needs to be between 0 and 1");
+  }
+
+  double fraction;     ///< Fraction of the key range forming the hot set
+  double probability;  ///< Probability that a key is drawn from the hot set
+};
+
 }  // namespace distribution
 
+namespace detail {
+
+/**
+ * @brief Draws ranks in `[1, n]` from a Zipfian distribution with rejection-inversion sampling.
+ *
+ * @note See W. Hormann and G. Derflinger, "Rejection-inversion to generate variates from monotone
+ * discrete distributions", ACM TOMACS 6(3), 1996. Sampling takes a constant expected number of
+ * iterations for any exponent and range size, and needs no precomputed table.
+ */
+class zipf_sampler {
+ public:
+  /**
+   * @brief Constructs a Zipfian sampler.
+   *
+   * @param alpha Exponent of the distribution
+   * @param n Number of ranks
+   */
+  __host__ __device__ zipf_sampler(double alpha, double n)
+    : alpha_{alpha},
+      n_{n},
+      h_integral_x1_{h_integral(1.5) - 1.0},
+      h_integral_n_{h_integral(n + 0.5)},
+      s_{2.0 - h_integral_inverse(h_integral(2.5) - h(2.0))}
+  {
+  }
+
+  /**
+   * @brief Draws a rank.
+   *
+   * @tparam RNG Pseudo-random number generator
+   *
+   * @param rng Random number generator
+   *
+   * @return Rank in `[1, n]`
+   */
+  template <typename RNG>
+  __host__ __device__ int64_t operator()(RNG& rng) const
+  {
+    thrust::uniform_real_distribution<double> uniform_dist(0.0, 1.0);
+    while (true) {
+      auto const u = h_integral_n_ + uniform_dist(rng) * (h_integral_x1_ - h_integral_n_);
+      auto const x = h_integral_inverse(u);
+      auto const k = x + 0.5 < 1.0 ? 1.0 : (x + 0.5 > n_ ? n_ : ::floor(x + 0.5));
+      if (k - x <= s_ or u >= h_integral(k + 0.5) - h(k)) { return static_cast<int64_t>(k); }
+    }
+  }
+
+ private:
+  __host__ __device__ double h(double x) const { return ::exp(-alpha_ * ::log(x)); }
+
+  __host__ __device__ double h_integral(double x) const
+  {
+    auto const log_x = ::log(x);
+    return helper2((1.0 - alpha_) * log_x) * log_x;
+  }
+
+  __host__ __device__ double h_integral_inverse(double x) const
+  {
+    auto t = x * (1.0 - alpha_);
+    if (t < -1.0) { t = -1.0; }
+    return ::exp(helper1(t) * x);
+  }
+
+  // log1p(x) / x, continuous at 0
+  __host__ __device__ static double helper1(double x)
+  {
+    return ::fabs(x) > 1e-8 ? ::log1p(x) / x : 1.0 - x * (0.5 - x * (1.0 / 3.0 - 0.25 * x));
+  }
+
+  // expm1(x) / x, continuous at 0
+  __host__ __device__ static double helper2(double x)
+  {
+    return ::fabs(x) > 1e-8 ? ::expm1(x) / x : 1.0 + x * 0.5 * (1.0 + x / 3.0 * (1.0 + 0.25 * x));
+  }
+
+  double alpha_;          ///< Exponent of the distribution
+  double n_;              ///< Number of ranks
+  double h_integral_x1_;  ///< Integral of the hat function up to the first rank
+  double h_integral_n_;   ///< Integral of the hat function up to the last rank
+  double s_;              ///< Squeeze bound accepting samples without evaluating the hat function
+};
+
+}  // namespace detail
+
 /**
  * @brief Random key generator.
  *
@@ -150,6 +274,42 @@ class key_generator {
                           }
                           return val;
                         });
+    } else if constexpr (std::is_same_v<Dist, distribution::zipf>) {
+      size_t num_keys = thrust::distance(out_begin, out_end);
+
+      thrust::counting_iterator<size_t> seeds(this->rng_());
+      auto const sampler = detail::zipf_sampler{dist.value, static_cast<double>(num_keys)};
+
+      thrust::transform(exec_policy,
+                        seeds,
+                        seeds + num_keys,
+                        out_begin,
+                        [sampler] __host__ __device__(size_t const seed) {
+                          RNG rng;
+                          rng.seed(seed);
+                          return static_cast<value_type>(sampler(rng) - 1);
+                        });
+    } else if constexpr (std::is_same_v<Dist, distribution::hotset>) {
+      size_t num_keys = thrust::distance(out_begin, out_end);
+      size_t hot_size = std::max(static_cast<size_t>(num_keys * dist.fraction), size_t{1});
+
+      thrust::counting_iterator<size_t> seeds(this->rng_());
+
+      thrust::transform(exec_policy,
+                        seeds,
+                        seeds + num_keys,
+                        out_begin,
+                        [dist, num_keys, hot_size] __host__ __device__(size_t const seed) {
+                          RNG rng;
+                          thrust::uniform_real_distribution<double> rate_dist(0.0, 1.0);
+                          rng.seed(seed);
+                          auto const is_hot =
+                            rate_dist(rng) < dist.probability or hot_size >= num_keys;
+                          thrust::uniform_int_distribution<value_type> key_dist(
+                            is_hot ? 0 : static_cast<value_type>(hot_size),
+                            static_cast<value_type>((is_hot ? hot_size : num_keys) - 1));
+                          return key_dist(rng);
+                        });
     } else {
       CUCO_FAIL("Unexpected distribution type");
     }
@@ -27,9 +27,9 @@ namespace cuco {
  * @brief Customization point that can be specialized to indicate that it is safe to perform bitwise
  * equality comparisons on the object-representation of objects of type `T`.
  *
- * By default, only types where `std::has_unique_object_representations_v<T>` is true are safe for
- * bitwise equality. However, this can be too restrictive for some types, e.g., floating point
- * types.
+ * By default, only types where `std::has_unique_object_representations_v<T>` is true, as well as
+ * `float` and `double`, are considered safe for bitwise equality. However, this can be too
+ * restrictive for some types, e.g., structs with padding bytes that are always zeroed.
  *
  * User-defined specializations of `is_bitwise_comparable` are allowed, but it is the users
  * responsibility to ensure values do not occur that would lead to unexpected behavior. For example,
@@ -47,6 +47,21 @@ struct is_bitwise_comparable<T, std::enable_if_t<std::has_unique_object_represen
   : std::true_type {
 };
 
+/**
+ * @brief `float` and `double` are bitwise comparable so that their sentinel values can be compared
+ * bitwise.
+ *
+ * This does not make their keys safe for bitwise equality: equal keys such as `0.0` and `-0.0`, or
+ * NaNs with different payloads, have different object representations. Only the experimental
+ * containers canonicalize floating-point keys before hashing and comparing them; the legacy
+ * `cuco::static_map`, `cuco::static_multimap` and `cuco::dynamic_map` reject them.
+ */
+template <typename T>
+struct is_bitwise_comparable<
+  T,
+  std::enable_if_t<std::is_same_v<T, float> or std::is_same_v<T, double>>> : std::true_type {
+};
+
 template <typename T>
 inline constexpr bool is_bitwise_comparable_v = is_bitwise_comparable<T>::value;
 
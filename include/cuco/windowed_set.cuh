@@ -0,0 +1,295 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cuco/cuda_stream_ref.hpp>
+#include <cuco/extent.cuh>
+#include <cuco/hash_functions.cuh>
+#include <cuco/operator.hpp>
+#include <cuco/probing_scheme.cuh>
+#include <cuco/sentinel.cuh>
+#include <cuco/static_set.cuh>
+#include <cuco/storage.cuh>
+#include <cuco/utility/allocator.hpp>
+
+#include <thrust/functional.h>
+
+#include <cuda/atomic>
+#include <cuda/std/array>
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace cuco {
+namespace experimental {
+/**
+ * @brief A GPU-accelerated set of unique keys over a sliding window of time, built from a ring of
+ * `NumGenerations` `cuco::experimental::static_set`s.
+ *
+ * The `windowed_set` answers questions like "has this key been seen in the last hour?" without
+ * storing per-key timestamps: time is divided into generations, e.g., of ten minutes each, and
+ * every generation is stored in its own `static_set`.
+ *
+ * - `insert` inserts keys into the current generation only.
+ * - `contains` probes all live generations, from the newest to the oldest, in a single kernel.
+ * - `advance` makes the oldest generation the new current one and empties it with `clear_async`,
+ *   which retires all keys that have not been inserted again since.
+ *
+ * Thus a key is contained if it has been inserted since the last `NumGenerations - 1` calls to
+ * `advance`, and the memory footprint stays bounded by `NumGenerations` times the capacity of a
+ * generation.
+ *
+ * @note The capacity is per generation: attempting to insert more unique keys into a generation
+ * than its capacity results in undefined behavior.
+ * @note The generation bookkeeping is host-side: bulk operations must be issued in the order in
+ * which they should take effect, e.g., on a single stream.
+ *
+ * @throw If the size of the given key type is larger than 8 bytes
+ * @throw If the given key type doesn't have unique object representations, i.e.,
+ * `cuco::bitwise_comparable_v<Key> == false`
+ * @throw If the probing scheme type is not inherited from `cuco::detail::probing_scheme_base`
+ *
+ * @tparam Key Type used for keys. Requires `cuco::is_bitwise_comparable_v<Key>`
+ * @tparam NumGenerations Number of generations kept in the ring
+ * @tparam Extent Data structure size type
+ * @tparam Scope The scope in which operations will be performed by individual threads.
+ * @tparam KeyEqual Binary callable type used to compare two keys for equality
+ * @tparam ProbingScheme Probing scheme (see `include/cuco/probing_scheme.cuh` for choices)
+ * @tparam Allocator Type of allocator used for device storage
+ * @tparam Storage Slot window storage type
+ */
+template <class Key,
+          int32_t NumGenerations,
+          class Extent             = cuco::experimental::extent<std::size_t>,
+          cuda::thread_scope Scope = cuda::thread_scope_device,
+          class KeyEqual           = thrust::equal_to<Key>,
+          class ProbingScheme      = experimental::double_hashing<4,  // CG size
+                                                             cuco::default_hash_function<Key>>,
+          class Allocator          = cuco::cuda_allocator<Key>,
+          class Storage            = cuco::experimental::aow_storage<1>>
+class windowed_set {
+  static_assert(NumGenerations > 1, "A windowed set requires at least two generations.");
+
+ public:
+  /// Type of the set storing each generation
+  using generation_type =
+    static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>;
+
+  static constexpr auto num_generations = NumGenerations;  ///< Number of generations
+  /// CG size used for probing
+  static constexpr auto cg_size = generation_type::cg_size;
+  /// CUDA thread scope
+  static constexpr auto thread_scope = generation_type::thread_scope;
+
+  using key_type       = typename generation_type::key_type;        ///< Key type
+  using value_type     = typename generation_type::value_type;      ///< Key type
+  using extent_type    = typename generation_type::extent_type;     ///< Extent type
+  using size_type      = typename generation_type::size_type;       ///< Size type
+  using key_equal      = typename generation_type::key_equal;       ///< Key equality type
+  using allocator_type = typename generation_type::allocator_type;  ///< Allocator type
+
+  /// Non-owning ref type of a single generation
+  template <typename... Operators>
+  using ref_type = typename generation_type::template ref_type<Operators...>;
+
+  windowed_set(windowed_set const&) = delete;
+  windowed_set& operator=(windowed_set const&) = delete;
+
+  windowed_set(windowed_set&&) = default;  ///< Move constructor
+
+  /**
+   * @brief Replaces the contents of the container with another container.
+   *
+   * @return Reference of the current set object
+   */
+  windowed_set& operator=(windowed_set&&) = default;
+  ~windowed_set()                         = default;
+
+  /**
+   * @brief Constructs a windowed set whose generations have the specified initial capacity.
+   *
+   * The actual capacity of each generation is computed as for `static_set`.
+   *
+   * @param capacity The requested lower-bound capacity of each generation
+   * @param empty_key_sentinel The reserved key value for empty slots
+   * @param pred Key equality binary predicate
+   * @param probing_scheme Probing scheme
+   * @param alloc Allocator used for allocating device storage
+   * @param stream CUDA stream used to initialize the generations
+   */
+  windowed_set(Extent capacity,
+               empty_key<Key> empty_key_sentinel,
+               KeyEqual const& pred                = {},
+               ProbingScheme const& probing_scheme = {},
+               Allocator const& alloc              = {},
+               cuda_stream_ref stream              = {});
+
+  /**
+   * @brief Erases all elements from all generations.
+   *
+   * @param stream CUDA stream this operation is executed in
+   */
+  void clear(cuda_stream_ref stream = {}) noexcept;
+
+  /**
+   * @brief Asynchronously erases all elements from all generations.
+   *
+   * @param stream CUDA stream this operation is executed in
+   */
+  void clear_async(cuda_stream_ref stream = {}) noexcept;
+
+  /**
+   * @brief Retires the oldest generation and makes it the new, empty current generation.
+   *
+   * @param stream CUDA stream this operation is executed in
+   */
+  void advance(cuda_stream_ref stream = {}) noexcept;
+
+  /**
+   * @brief Asynchronously retires the oldest generation and makes it the new, empty current
+   * generation.
+   *
+   * @param stream CUDA stream this operation is executed in
+   */
+  void advance_async(cuda_stream_ref stream = {}) noexcept;
+
+  /**
+   * @brief Inserts all keys in the range `[first, last)` into the current generation.
+   *
+   * @note This function synchronizes the given stream. For asynchronous execution use
+   * `insert_async`.
+   *
+   * @tparam InputIt Device accessible random access input iterator where
+   * <tt>std::is_convertible<std::iterator_traits<InputIt>::value_type,
+   * windowed_set<K, G>::value_type></tt> is `true`
+   *
+   * @param first Beginning of the sequence of keys
+   * @param last End of the sequence of keys
+   * @param stream CUDA stream used for insert
+   *
+   * @return Number of keys newly inserted into the current generation
+   */
+  template <typename InputIt>
+  size_type insert(InputIt first, InputIt last, cuda_stream_ref stream = {});
+
+  /**
+   * @brief Asynchronously inserts all keys in the range `[first, last)` into the current
+   * generation.
+   *
+   * @tparam InputIt Device accessible random access input iterator where
+   * <tt>std::is_convertible<std::iterator_traits<InputIt>::value_type,
+   * windowed_set<K, G>::value_type></tt> is `true`
+   *
+   * @param first Beginning of the sequence of keys
+   * @param last End of the sequence of keys
+   * @param stream CUDA stream used for insert
+   */
+  template <typename InputIt>
+  void insert_async(InputIt first, InputIt last, cuda_stream_ref stream = {}) noexcept;
+
+  /**
+   * @brief Indicates whether the keys in the range `[first, last)` are contained in any live
+   * generation.
+   *
+   * @note This function synchronizes the given stream. For asynchronous execution use
+   * `contains_async`.
+   *
+   * @tparam InputIt Device accessible input iterator
+   * @tparam OutputIt Device accessible output iterator assignable from `bool`
+   *
+   * @param first Beginning of the sequence of keys
+   * @param last End of the sequence of keys
+   * @param output_begin Beginning of the sequence of booleans for the presence of each key
+   * @param stream Stream used for executing the kernels
+   */
+  template <typename InputIt, typename OutputIt>
+  void contains(InputIt first,
+                InputIt last,
+                OutputIt output_begin,
+                cuda_stream_ref stream = {}) const;
+
+  /**
+   * @brief Asynchronously indicates whether the keys in the range `[first, last)` are contained in
+   * any live generation.
+   *
+   * @tparam InputIt Device accessible input iterator
+   * @tparam OutputIt Device accessible output iterator assignable from `bool`
+   *
+   * @param first Beginning of the sequence of keys
+   * @param last End of the sequence of keys
+   * @param output_begin Beginning of the sequence of booleans for the presence of each key
+   * @param stream Stream used for executing the kernels
+   */
+  template <typename InputIt, typename OutputIt>
+  void contains_async(InputIt first,
+                      InputIt last,
+                      OutputIt output_begin,
+                      cuda_stream_ref stream = {}) const noexcept;
+
+  /**
+   * @brief Gets the number of elements in the current generation.
+   *
+   * @note This function synchronizes the given stream.
+   *
+   * @param stream CUDA stream used to get the number of inserted elements
+   * @return The number of elements in the current generation
+   */
+  [[nodiscard]] size_type size(cuda_stream_ref stream = {}) const noexcept;
+
+  /**
+   * @brief Gets the maximum number of elements each generation can hold.
+   *
+   * @return The maximum number of elements each generation can hold
+   */
+  [[nodiscard]] constexpr auto capacity() const noexcept;
+
+  /**
+   * @brief Gets the sentinel value used to represent an empty key slot.
+   *
+   * @return The sentinel value used to represent an empty key slot
+   */
+  [[nodiscard]] constexpr key_type empty_key_sentinel() const noexcept;
+
+  /**
+   * @brief Gets the current generation.
+   *
+   * @return The set storing the current generation
+   */
+  [[nodiscard]] generation_type const& current_generation() const noexcept;
+
+ private:
+  /**
+   * @brief Gets the `contains` refs of all generations, ordered from the newest to the oldest.
+   *
+   * @tparam Indices Sequence of generation ages `0, 1, ..., NumGenerations - 1`
+   *
+   * @return Array of generation refs
+   */
+  template <int32_t... Indices>
+  [[nodiscard]] cuda::std::array<ref_type<op::contains_tag>, num_generations> generation_refs(
+    std::integer_sequence<int32_t, Indices...>) const noexcept;
+
+  std::vector<generation_type> generations_;  ///< Ring of generations
+  int32_t current_;                           ///< Index of the current generation in the ring
+};
+
+}  // namespace experimental
+}  // namespace cuco
+
+#include <cuco/detail/windowed_set/windowed_set.inl>
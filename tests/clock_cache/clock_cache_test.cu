@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utils.hpp>
+
+#include <cuco/clock_cache.cuh>
+
+#include <thrust/count.h>
+#include <thrust/device_vector.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/sequence.h>
+#include <thrust/tuple.h>
+
+#include <catch2/catch_template_test_macros.hpp>
+
+#include <cstdint>
+
+using size_type = int32_t;
+
+// Maps every key to the first window so that eviction order is deterministic
+template <typename Key>
+struct constant_hash {
+  __host__ __device__ constexpr std::uint32_t operator()(Key const&) const noexcept { return 0; }
+};
+
+TEMPLATE_TEST_CASE_SIG("Clock cache find_or_insert",
+                       "",
+                       ((typename Key, typename Value), Key, Value),
+                       (int32_t, int32_t),
+                       (int64_t, int32_t))
+{
+  constexpr size_type num_keys{400};
+
+  // Large enough for no home window to overflow
+  auto cache = cuco::experimental::clock_cache<Key, Value, cuco::experimental::extent<size_type>>{
+    100 * num_keys, cuco::empty_key<Key>{-1}, cuco::empty_value<Value>{-1}};
+
+  thrust::device_vector<Key> d_keys(num_keys);
+  thrust::sequence(thrust::device, d_keys.begin(), d_keys.end());
+
+  auto pairs_begin =
+    thrust::make_transform_iterator(thrust::make_counting_iterator<size_type>(0),
+                                    [] __device__(auto i) { return cuco::pair<Key, Value>(i, i); });
+  thrust::device_vector<Value> d_results(num_keys);
+  thrust::device_vector<bool> d_misses(num_keys);
+
+  auto zip_equal = [] __device__(auto const& p) { return thrust::get<0>(p) == thrust::get<1>(p); };
+
+  REQUIRE(cache.find_or_insert(
+            pairs_begin, pairs_begin + num_keys, d_results.begin(), d_misses.begin()) == num_keys);
+  REQUIRE(cache.size() == num_keys);
+
+  SECTION("First lookups should all miss and return the inserted payloads.")
+  {
+    REQUIRE(cuco::test::all_of(d_misses.begin(), d_misses.end(), thrust::identity{}));
+
+    auto zip = thrust::make_zip_iterator(thrust::make_tuple(d_results.begin(), d_keys.begin()));
+    REQUIRE(cuco::test::all_of(zip, zip + num_keys, zip_equal));
+  }
+
+  SECTION("Repeated lookups should all hit and return the cached payloads.")
+  {
+    auto new_pairs_begin = thrust::make_transform_iterator(
+      thrust::make_counting_iterator<size_type>(0),
+      [] __device__(auto i) { return cuco::pair<Key, Value>(i, i + 1); });
+
+    REQUIRE(cache.find_or_insert(new_pairs_begin,
+                                 new_pairs_begin + num_keys,
+                                 d_results.begin(),
+                                 d_misses.begin()) == 0);
+    REQUIRE(cuco::test::none_of(d_misses.begin(), d_misses.end(), thrust::identity{}));
+
+    auto zip = thrust::make_zip_iterator(thrust::make_tuple(d_results.begin(), d_keys.begin()));
+    REQUIRE(cuco::test::all_of(zip, zip + num_keys, zip_equal));
+  }
+
+  SECTION("All cached keys should be contained and found.")
+  {
+    thrust::device_vector<bool> d_contained(num_keys);
+    cache.contains(d_keys.begin(), d_keys.end(), d_contained.begin());
+    REQUIRE(cuco::test::all_of(d_contained.begin(), d_contained.end(), thrust::identity{}));
+
+    cache.find(d_keys.begin(), d_keys.end(), d_results.begin());
+    auto zip = thrust::make_zip_iterator(thrust::make_tuple(d_results.begin(), d_keys.begin()));
+    REQUIRE(cuco::test::all_of(zip, zip + num_keys, zip_equal));
+  }
+}
+
+TEMPLATE_TEST_CASE_SIG("Clock cache eviction",
+                       "",
+                       ((typename Key, typename Value), Key, Value),
+                       (int32_t, int32_t),
+                       (int64_t, int32_t))
+{
+  constexpr size_type window_size{8};
+
+  using probe = cuco::experimental::linear_probing<1, constant_hash<Key>>;
+
+  auto cache = cuco::experimental::clock_cache<Key,
+                                               Value,
+                                               cuco::experimental::extent<size_type>,
+                                               cuda::thread_scope_device,
+                                               thrust::equal_to<Key>,
+                                               probe,
+                                               cuco::cuda_allocator<std::byte>,
+                                               cuco::experimental::aow_storage<window_size>>{
+    window_size, cuco::empty_key<Key>{-1}, cuco::empty_value<Value>{-1}};
+
+  auto pairs_begin =
+    thrust::make_transform_iterator(thrust::make_counting_iterator<size_type>(0),
+                                    [] __device__(auto i) { return cuco::pair<Key, Value>(i, i); });
+
+  auto const num_contained = [&](size_type first, size_type last) {
+    thrust::device_vector<bool> d_contained(last - first);
+    cache.contains(thrust::make_counting_iterator<Key>(first),
+                   thrust::make_counting_iterator<Key>(last),
+                   d_contained.begin());
+    return thrust::count(thrust::device, d_contained.begin(), d_contained.end(), true);
+  };
+
+  SECTION("The home window should never hold more keys than its size.")
+  {
+    constexpr size_type num_keys{100};
+    for (size_type i = 0; i < num_keys; i += 10) {
+      REQUIRE(cache.insert(pairs_begin + i, pairs_begin + i + 10) == 10);
+    }
+    REQUIRE(cache.size() == window_size);
+    REQUIRE(num_contained(0, num_keys) == window_size);
+  }
+
+  SECTION("Consecutive evictions should advance the clock hand.")
+  {
+    // Inserted one at a time, the `i`-th key is stored in the `i`-th slot
+    for (size_type i = 0; i < window_size; ++i) {
+      REQUIRE(cache.insert(pairs_begin + i, pairs_begin + i + 1) == 1);
+    }
+
+    // The first eviction clears every reference flag, then each eviction resumes after the
+    // previous victim, so the oldest key is evicted and never the one inserted just before
+    for (size_type i = window_size; i < 2 * window_size; ++i) {
+      REQUIRE(cache.insert(pairs_begin + i, pairs_begin + i + 1) == 1);
+      REQUIRE(num_contained(0, i - window_size + 1) == 0);
+      REQUIRE(num_contained(i - window_size + 1, i + 1) == window_size);
+    }
+  }
+
+  SECTION("Unreferenced keys should be evicted first.")
+  {
+    REQUIRE(cache.insert(pairs_begin, pairs_begin + window_size) == window_size);
+    REQUIRE(num_contained(0, window_size) == window_size);
+
+    // Every key is referenced on insert: the first sweep clears all flags and the second one evicts
+    // the first slot
+    REQUIRE(cache.insert(pairs_begin + window_size, pairs_begin + window_size + 1) == 1);
+    REQUIRE(cache.size() == window_size);
+    REQUIRE(num_contained(0, window_size) == window_size - 1);
+
+    // Reference half of the old keys
+    thrust::device_vector<Value> d_results(window_size / 2);
+    cache.find(thrust::make_counting_iterator<Key>(0),
+               thrust::make_counting_iterator<Key>(window_size / 2),
+               d_results.begin());
+    auto const num_referenced = num_contained(0, window_size / 2);
+
+    REQUIRE(cache.insert(pairs_begin + window_size + 1, pairs_begin + window_size + 2) == 1);
+    REQUIRE(cache.size() == window_size);
+
+    // The victim is one of the unreferenced old keys
+    REQUIRE(num_contained(0, window_size / 2) == num_referenced);
+    REQUIRE(num_contained(window_size / 2, window_size) ==
+            window_size - 2 - static_cast<size_type>(num_referenced));
+    REQUIRE(num_contained(window_size, window_size + 2) == 2);
+  }
+}
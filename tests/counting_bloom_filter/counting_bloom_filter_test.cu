@@ -0,0 +1,218 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utils.hpp>
+
+#include <cuco/counting_bloom_filter.cuh>
+
+#include <thrust/count.h>
+#include <thrust/device_vector.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/counting_iterator.h>
+
+#include <catch2/catch_template_test_macros.hpp>
+
+#include <cstdint>
+
+using size_type = int32_t;
+
+TEMPLATE_TEST_CASE_SIG("Counting Bloom filter add, remove and contains",
+                       "",
+                       ((typename Key, int32_t NumHashes), Key, NumHashes),
+                       (int32_t, 1),
+                       (int32_t, 4),
+                       (int64_t, 1),
+                       (int64_t, 4))
+{
+  constexpr size_type num_keys{1'000};
+  // Sparse enough for no counter to saturate
+  constexpr size_type num_blocks{10 * num_keys};
+
+  auto filter = cuco::experimental::counting_bloom_filter<Key>{num_blocks, NumHashes};
+
+  REQUIRE(filter.num_blocks() == num_blocks);
+  REQUIRE(filter.num_hashes() == NumHashes);
+
+  auto keys_begin = thrust::make_counting_iterator<Key>(0);
+  thrust::device_vector<bool> d_contained(num_keys);
+
+  filter.contains(keys_begin, keys_begin + num_keys, d_contained.begin());
+  REQUIRE(cuco::test::none_of(d_contained.begin(), d_contained.end(), thrust::identity{}));
+
+  filter.add(keys_begin, keys_begin + num_keys);
+
+  SECTION("All added keys should be contained.")
+  {
+    filter.contains(keys_begin, keys_begin + num_keys, d_contained.begin());
+    REQUIRE(cuco::test::all_of(d_contained.begin(), d_contained.end(), thrust::identity{}));
+  }
+
+  SECTION("Few non-added keys should be reported as contained.")
+  {
+    filter.contains(keys_begin + num_keys, keys_begin + 2 * num_keys, d_contained.begin());
+    REQUIRE(thrust::count(thrust::device, d_contained.begin(), d_contained.end(), true) <
+            num_keys / 100);
+  }
+
+  SECTION("Removed keys should no longer be contained.")
+  {
+    filter.remove(keys_begin, keys_begin + num_keys / 2);
+
+    filter.contains(keys_begin + num_keys / 2, keys_begin + num_keys, d_contained.begin());
+    REQUIRE(cuco::test::all_of(
+      d_contained.begin(), d_contained.begin() + num_keys / 2, thrust::identity{}));
+
+    filter.remove(keys_begin + num_keys / 2, keys_begin + num_keys);
+
+    filter.contains(keys_begin, keys_begin + num_keys, d_contained.begin());
+    REQUIRE(cuco::test::none_of(d_contained.begin(), d_contained.end(), thrust::identity{}));
+  }
+
+  SECTION("Cleared filter should not contain any key.")
+  {
+    filter.clear();
+
+    filter.contains(keys_begin, keys_begin + num_keys, d_contained.begin());
+    REQUIRE(cuco::test::none_of(d_contained.begin(), d_contained.end(), thrust::identity{}));
+  }
+}
+
+TEMPLATE_TEST_CASE_SIG("Counting Bloom filter with a 128-bit hash function",
+                       "",
+                       ((typename Key), Key),
+                       (int32_t),
+                       (int64_t))
+{
+  constexpr size_type num_keys{1'000};
+  constexpr size_type num_blocks{10 * num_keys};
+  constexpr size_type num_hashes{4};
+
+  using filter_type = cuco::experimental::counting_bloom_filter<Key,
+                                                                cuco::experimental::extent<size_t>,
+                                                                cuda::thread_scope_device,
+                                                                cuco::xxhash_128<Key>>;
+  auto filter       = filter_type{num_blocks, num_hashes};
+
+  auto keys_begin = thrust::make_counting_iterator<Key>(0);
+  thrust::device_vector<bool> d_contained(num_keys);
+
+  filter.add(keys_begin, keys_begin + num_keys);
+
+  SECTION("All added keys should be contained.")
+  {
+    filter.contains(keys_begin, keys_begin + num_keys, d_contained.begin());
+    REQUIRE(cuco::test::all_of(d_contained.begin(), d_contained.end(), thrust::identity{}));
+  }
+
+  SECTION("Few non-added keys should be reported as contained.")
+  {
+    filter.contains(keys_begin + num_keys, keys_begin + 2 * num_keys, d_contained.begin());
+    REQUIRE(thrust::count(thrust::device, d_contained.begin(), d_contained.end(), true) <
+            num_keys / 100);
+  }
+
+  SECTION("Removed keys should no longer be contained.")
+  {
+    filter.remove(keys_begin, keys_begin + num_keys);
+
+    filter.contains(keys_begin, keys_begin + num_keys, d_contained.begin());
+    REQUIRE(cuco::test::none_of(d_contained.begin(), d_contained.end(), thrust::identity{}));
+  }
+}
+
+TEMPLATE_TEST_CASE_SIG("Counting Bloom filter with a 32-bit hash function",
+                       "",
+                       ((typename Key), Key),
+                       (int32_t),
+                       (int64_t))
+{
+  constexpr size_type num_keys{1'000};
+  constexpr size_type num_blocks{10 * num_keys};
+  constexpr size_type num_hashes{4};
+
+  using filter_type = cuco::experimental::counting_bloom_filter<Key,
+                                                                cuco::experimental::extent<size_t>,
+                                                                cuda::thread_scope_device,
+                                                                cuco::murmurhash3_32<Key>>;
+  using block_type  = typename filter_type::block_type;
+  auto filter       = filter_type{num_blocks, num_hashes};
+
+  auto keys_begin = thrust::make_counting_iterator<Key>(0);
+  thrust::device_vector<bool> d_contained(num_keys);
+
+  filter.add(keys_begin, keys_begin + num_keys);
+
+  SECTION("Keys should be spread over many blocks.")
+  {
+    auto const num_touched =
+      thrust::count_if(thrust::device,
+                       filter.data(),
+                       filter.data() + filter.num_blocks(),
+                       [] __device__(block_type const& block) {
+                         for (int32_t i = 0; i < filter_type::words_per_block; ++i) {
+                           if (block[i] != 0) { return true; }
+                         }
+                         return false;
+                       });
+    REQUIRE(num_touched > num_keys / 2);
+  }
+
+  SECTION("Few non-added keys should be reported as contained.")
+  {
+    filter.contains(keys_begin + num_keys, keys_begin + 2 * num_keys, d_contained.begin());
+    REQUIRE(thrust::count(thrust::device, d_contained.begin(), d_contained.end(), true) <
+            num_keys / 100);
+  }
+}
+
+TEMPLATE_TEST_CASE_SIG("Counting Bloom filter saturation",
+                       "",
+                       ((typename Key), Key),
+                       (int32_t),
+                       (int64_t))
+{
+  constexpr size_type num_blocks{1'000};
+  constexpr size_type num_hashes{4};
+
+  auto filter = cuco::experimental::counting_bloom_filter<Key>{num_blocks, num_hashes};
+
+  auto const key           = Key{42};
+  auto const num_contained = [&]() {
+    thrust::device_vector<bool> d_contained(1);
+    filter.contains(thrust::make_constant_iterator(key),
+                    thrust::make_constant_iterator(key) + 1,
+                    d_contained.begin());
+    return thrust::count(thrust::device, d_contained.begin(), d_contained.end(), true);
+  };
+
+  SECTION("Keys added fewer times than the saturation threshold should be removable.")
+  {
+    filter.add(thrust::make_constant_iterator(key), thrust::make_constant_iterator(key) + 14);
+    filter.remove(thrust::make_constant_iterator(key), thrust::make_constant_iterator(key) + 13);
+    REQUIRE(num_contained() == 1);
+
+    filter.remove(thrust::make_constant_iterator(key), thrust::make_constant_iterator(key) + 1);
+    REQUIRE(num_contained() == 0);
+  }
+
+  SECTION("Saturated counters should never be decremented.")
+  {
+    filter.add(thrust::make_constant_iterator(key), thrust::make_constant_iterator(key) + 20);
+    filter.remove(thrust::make_constant_iterator(key), thrust::make_constant_iterator(key) + 20);
+    REQUIRE(num_contained() == 1);
+  }
+}
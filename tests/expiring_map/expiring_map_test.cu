@@ -0,0 +1,199 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utils.hpp>
+
+#include <cuco/expiring_map.cuh>
+
+#include <thrust/device_vector.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/sequence.h>
+#include <thrust/tuple.h>
+
+#include <catch2/catch_template_test_macros.hpp>
+
+using size_type = int32_t;
+
+template <typename Map>
+__inline__ void test_expiration(Map& map, size_type num_keys)
+{
+  using Key   = typename Map::key_type;
+  using Value = typename Map::mapped_type;
+
+  thrust::device_vector<Key> d_keys(num_keys);
+  thrust::sequence(thrust::device, d_keys.begin(), d_keys.end());
+
+  auto keys_begin = d_keys.begin();
+  auto pairs_begin =
+    thrust::make_transform_iterator(thrust::make_counting_iterator<size_type>(0),
+                                    [] __device__(auto i) { return cuco::pair<Key, Value>(i, i); });
+  thrust::device_vector<bool> d_contained(num_keys);
+  thrust::device_vector<Value> d_results(num_keys);
+
+  auto zip_equal = [] __device__(auto const& p) { return thrust::get<0>(p) == thrust::get<1>(p); };
+
+  auto const ttl = map.time_to_live();
+
+  REQUIRE(map.insert(pairs_begin, pairs_begin + num_keys, 0) == num_keys);
+  REQUIRE(map.size() == num_keys);
+
+  SECTION("Alive entries should be contained and found.")
+  {
+    map.contains(keys_begin, keys_begin + num_keys, d_contained.begin(), ttl - 1);
+    REQUIRE(cuco::test::all_of(d_contained.begin(), d_contained.end(), thrust::identity{}));
+
+    map.find(keys_begin, keys_begin + num_keys, d_results.begin(), ttl - 1);
+    auto zip = thrust::make_zip_iterator(thrust::make_tuple(d_results.begin(), keys_begin));
+    REQUIRE(cuco::test::all_of(zip, zip + num_keys, zip_equal));
+  }
+
+  SECTION("Expired entries should be neither contained nor found.")
+  {
+    map.contains(keys_begin, keys_begin + num_keys, d_contained.begin(), ttl);
+    REQUIRE(cuco::test::none_of(d_contained.begin(), d_contained.end(), thrust::identity{}));
+
+    map.find(keys_begin, keys_begin + num_keys, d_results.begin(), ttl);
+    auto zip = thrust::make_zip_iterator(thrust::make_tuple(
+      d_results.begin(), thrust::constant_iterator<Value>{map.empty_value_sentinel()}));
+    REQUIRE(cuco::test::all_of(zip, zip + num_keys, zip_equal));
+  }
+
+  SECTION("Alive entries should not be refreshed.")
+  {
+    REQUIRE(map.insert(pairs_begin, pairs_begin + num_keys, ttl - 1) == 0);
+
+    // The original timestamps are kept
+    map.contains(keys_begin, keys_begin + num_keys, d_contained.begin(), ttl);
+    REQUIRE(cuco::test::none_of(d_contained.begin(), d_contained.end(), thrust::identity{}));
+  }
+
+  SECTION("Expired entries should be refreshed in place.")
+  {
+    REQUIRE(map.insert(pairs_begin, pairs_begin + num_keys, 2 * ttl) == num_keys);
+    REQUIRE(map.size() == num_keys);
+
+    map.contains(keys_begin, keys_begin + num_keys, d_contained.begin(), 3 * ttl - 1);
+    REQUIRE(cuco::test::all_of(d_contained.begin(), d_contained.end(), thrust::identity{}));
+  }
+
+  SECTION("Expire should tombstone expired entries only.")
+  {
+    auto odd_pairs_begin = thrust::make_transform_iterator(
+      thrust::make_counting_iterator<size_type>(0),
+      [] __device__(auto i) { return cuco::pair<Key, Value>(2 * i + 1, 2 * i + 1); });
+    // Refresh the odd keys so that only the even keys remain expired
+    REQUIRE(map.insert(odd_pairs_begin, odd_pairs_begin + num_keys / 2, ttl) == num_keys / 2);
+
+    REQUIRE(map.expire(ttl) == num_keys / 2);
+    REQUIRE(map.size() == num_keys / 2);
+
+    map.contains(keys_begin, keys_begin + num_keys, d_contained.begin(), ttl);
+    REQUIRE(cuco::test::equal(d_contained.begin(),
+                              d_contained.end(),
+                              thrust::counting_iterator<size_type>(0),
+                              [] __device__(auto const& contained, auto const& idx) {
+                                return ((idx % 2) == 1) == contained;
+                              }));
+  }
+
+  SECTION("New keys should reclaim expired entries.")
+  {
+    auto new_pairs_begin = thrust::make_transform_iterator(
+      thrust::make_counting_iterator<size_type>(0),
+      [num_keys] __device__(auto i) { return cuco::pair<Key, Value>(i + num_keys, i); });
+    // Succeeds only if expired entries are reclaimed since the map has no room left otherwise
+    REQUIRE(map.capacity() < 2 * num_keys);
+    REQUIRE(map.insert(new_pairs_begin, new_pairs_begin + num_keys, ttl) == num_keys);
+
+    map.contains(keys_begin, keys_begin + num_keys, d_contained.begin(), ttl);
+    REQUIRE(cuco::test::none_of(d_contained.begin(), d_contained.end(), thrust::identity{}));
+
+    auto new_keys_begin = thrust::make_transform_iterator(
+      thrust::make_counting_iterator<size_type>(0),
+      [num_keys] __device__(auto i) { return static_cast<Key>(i + num_keys); });
+    map.contains(new_keys_begin, new_keys_begin + num_keys, d_contained.begin(), ttl);
+    REQUIRE(cuco::test::all_of(d_contained.begin(), d_contained.end(), thrust::identity{}));
+  }
+
+  SECTION("New keys should reuse tombstones.")
+  {
+    REQUIRE(map.expire(ttl) == num_keys);
+    REQUIRE(map.size() == 0);
+
+    auto new_pairs_begin = thrust::make_transform_iterator(
+      thrust::make_counting_iterator<size_type>(0),
+      [num_keys] __device__(auto i) { return cuco::pair<Key, Value>(i + num_keys, i); });
+    // Succeeds only if tombstones are reclaimed since the map has no room left otherwise
+    REQUIRE(map.insert(new_pairs_begin, new_pairs_begin + num_keys, ttl) == num_keys);
+    REQUIRE(map.size() == num_keys);
+
+    map.contains(keys_begin, keys_begin + num_keys, d_contained.begin(), ttl);
+    REQUIRE(cuco::test::none_of(d_contained.begin(), d_contained.end(), thrust::identity{}));
+
+    auto new_keys_begin = thrust::make_transform_iterator(
+      thrust::make_counting_iterator<size_type>(0),
+      [num_keys] __device__(auto i) { return static_cast<Key>(i + num_keys); });
+    map.find(new_keys_begin, new_keys_begin + num_keys, d_results.begin(), ttl);
+    auto zip = thrust::make_zip_iterator(
+      thrust::make_tuple(d_results.begin(), thrust::counting_iterator<Value>(0)));
+    REQUIRE(cuco::test::all_of(zip, zip + num_keys, zip_equal));
+  }
+}
+
+TEMPLATE_TEST_CASE_SIG(
+  "Expiring map",
+  "",
+  ((typename Key, cuco::test::probe_sequence Probe, int CGSize), Key, Probe, CGSize),
+  (int32_t, cuco::test::probe_sequence::double_hashing, 1),
+  (int32_t, cuco::test::probe_sequence::double_hashing, 2),
+  (int64_t, cuco::test::probe_sequence::double_hashing, 1),
+  (int64_t, cuco::test::probe_sequence::double_hashing, 2),
+  (int32_t, cuco::test::probe_sequence::linear_probing, 1),
+  (int32_t, cuco::test::probe_sequence::linear_probing, 2),
+  (int64_t, cuco::test::probe_sequence::linear_probing, 1),
+  (int64_t, cuco::test::probe_sequence::linear_probing, 2))
+{
+  using Value = int32_t;
+
+  constexpr size_type num_keys{400};
+
+  using probe =
+    std::conditional_t<Probe == cuco::test::probe_sequence::linear_probing,
+                       cuco::experimental::linear_probing<CGSize, cuco::murmurhash3_32<Key>>,
+                       cuco::experimental::double_hashing<CGSize,
+                                                          cuco::murmurhash3_32<Key>,
+                                                          cuco::murmurhash3_32<Key>>>;
+
+  auto map = cuco::experimental::expiring_map<Key,
+                                              Value,
+                                              cuco::experimental::extent<size_type>,
+                                              cuda::thread_scope_device,
+                                              thrust::equal_to<Key>,
+                                              probe,
+                                              cuco::cuda_allocator<std::byte>,
+                                              cuco::experimental::aow_storage<2>>{
+    num_keys,
+    cuco::empty_key<Key>{-1},
+    cuco::empty_value<Value>{-1},
+    cuco::erased_key<Key>{-2},
+    10};
+
+  test_expiration(map, num_keys);
+}
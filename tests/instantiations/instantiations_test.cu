@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utils.hpp>
+
+#include <cuco/static_map.cuh>
+#include <cuco/static_set.cuh>
+
+#include <thrust/device_vector.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+
+#include <catch2/catch_template_test_macros.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+
+#if !defined(CUCO_EXTERN_INSTANTIATIONS)
+#error "Targets linking against cuco_instantiations are compiled with CUCO_EXTERN_INSTANTIATIONS"
+#endif
+
+TEMPLATE_TEST_CASE_SIG("Precompiled static_set instantiations",
+                       "",
+                       ((typename Set), Set),
+                       (cuco::experimental::static_set<int32_t>),
+                       (cuco::experimental::static_set<int64_t>),
+                       (cuco::experimental::linear_probing_static_set<int32_t>),
+                       (cuco::experimental::linear_probing_static_set<int64_t>))
+{
+  using Key = typename Set::key_type;
+
+  constexpr std::size_t num_keys{400};
+
+  thrust::device_vector<Key> keys(num_keys);
+  thrust::sequence(keys.begin(), keys.end());
+  thrust::device_vector<bool> contained(num_keys);
+
+  auto set = Set{num_keys * 2, cuco::empty_key<Key>{-1}};
+
+  SECTION("Operations on device vector iterators should link against the library.")
+  {
+    REQUIRE(set.insert(keys.begin(), keys.end()) == num_keys);
+    REQUIRE(set.size() == num_keys);
+
+    set.contains(keys.begin(), keys.end(), contained.begin());
+    REQUIRE(cuco::test::all_of(contained.begin(), contained.end(), thrust::identity{}));
+
+    thrust::device_vector<Key> retrieved(num_keys);
+    auto const retrieved_end = set.retrieve_all(retrieved.begin());
+    thrust::sort(retrieved.begin(), retrieved_end);
+    REQUIRE(cuco::test::equal(retrieved.begin(),
+                              retrieved_end,
+                              thrust::counting_iterator<Key>(0),
+                              thrust::equal_to<Key>{}));
+
+    set.clear();
+    REQUIRE(set.size() == 0);
+  }
+
+  SECTION("Operations on raw pointers should link against the library.")
+  {
+    Key const* const first = keys.data().get();
+    REQUIRE(set.insert(first, first + num_keys) == num_keys);
+
+    thrust::device_vector<Key> found(num_keys);
+    set.find(first, first + num_keys, found.data().get());
+    REQUIRE(cuco::test::equal(found.begin(), found.end(), keys.begin(), thrust::equal_to<Key>{}));
+  }
+}
+
+TEMPLATE_TEST_CASE_SIG("Precompiled static_map instantiations",
+                       "",
+                       ((typename Map), Map),
+                       (cuco::experimental::static_map<int32_t, int32_t>),
+                       (cuco::experimental::static_map<int64_t, int64_t>),
+                       (cuco::experimental::linear_probing_static_map<int32_t, int32_t>),
+                       (cuco::experimental::linear_probing_static_map<int64_t, int64_t>))
+{
+  using Key   = typename Map::key_type;
+  using Value = typename Map::mapped_type;
+
+  constexpr std::size_t num_keys{400};
+
+  thrust::device_vector<Key> keys(num_keys);
+  thrust::sequence(keys.begin(), keys.end());
+  thrust::device_vector<cuco::pair<Key, Value>> pairs(num_keys);
+  thrust::transform(keys.begin(), keys.end(), pairs.begin(), [] __device__(Key k) {
+    return cuco::pair<Key, Value>{k, static_cast<Value>(k * 2)};
+  });
+
+  auto map = Map{num_keys * 2, cuco::empty_key<Key>{-1}, cuco::empty_value<Value>{-1}};
+
+  SECTION("Operations on device vector iterators should link against the library.")
+  {
+    REQUIRE(map.insert(pairs.cbegin(), pairs.cend()) == num_keys);
+    REQUIRE(map.size() == num_keys);
+
+    thrust::device_vector<Value> found(num_keys);
+    map.find(keys.begin(), keys.end(), found.begin());
+    REQUIRE(cuco::test::equal(found.begin(),
+                              found.end(),
+                              keys.begin(),
+                              [] __device__(Value v, Key k) { return v == k * 2; }));
+
+    thrust::device_vector<Key> retrieved_keys(num_keys);
+    thrust::device_vector<Value> retrieved_values(num_keys);
+    auto const [keys_end, values_end] =
+      map.retrieve_all(retrieved_keys.begin(), retrieved_values.begin());
+    REQUIRE(static_cast<std::size_t>(std::distance(retrieved_keys.begin(), keys_end)) == num_keys);
+    REQUIRE(static_cast<std::size_t>(std::distance(retrieved_values.begin(), values_end)) ==
+            num_keys);
+  }
+
+  SECTION("Operations on raw pointers should link against the library.")
+  {
+    cuco::pair<Key, Value> const* const first = pairs.data().get();
+    REQUIRE(map.insert(first, first + num_keys) == num_keys);
+
+    thrust::device_vector<bool> contained(num_keys);
+    map.contains(keys.data().get(), keys.data().get() + num_keys, contained.data().get());
+    REQUIRE(cuco::test::all_of(contained.begin(), contained.end(), thrust::identity{}));
+  }
+}
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utils.hpp>
+
+#include <cuco/static_map.cuh>
+
+#include <thrust/device_vector.h>
+#include <thrust/functional.h>
+
+#include <catch2/catch_template_test_macros.hpp>
+
+#include <climits>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+template <typename Key>
+Key make_nan_with_payload()
+{
+  using bits_type = std::conditional_t<sizeof(Key) == 4, std::uint32_t, std::uint64_t>;
+
+  Key const nan = std::numeric_limits<Key>::quiet_NaN();
+  bits_type bits;
+  std::memcpy(&bits, &nan, sizeof(Key));
+  // flip the sign bit and set a payload
+  bits ^= bits_type{1} << (sizeof(Key) * CHAR_BIT - 1);
+  bits |= bits_type{0x1234};
+
+  Key key;
+  std::memcpy(&key, &bits, sizeof(Key));
+  return key;
+}
+
+TEST_CASE("Floating-point keys are rejected by the legacy containers", "")
+{
+  STATIC_REQUIRE(cuco::detail::is_legacy_key_v<int32_t>);
+  STATIC_REQUIRE(cuco::detail::is_legacy_key_v<int64_t>);
+  STATIC_REQUIRE(not cuco::detail::is_legacy_key_v<float>);
+  STATIC_REQUIRE(not cuco::detail::is_legacy_key_v<double>);
+}
+
+TEMPLATE_TEST_CASE_SIG("Floating-point keys",
+                       "",
+                       ((typename Key, typename Value), Key, Value),
+                       (float, int32_t),
+                       (double, int32_t),
+                       (double, int64_t))
+{
+  auto const nan       = std::numeric_limits<Key>::quiet_NaN();
+  auto const other_nan = make_nan_with_payload<Key>();
+
+  // keys that compare equal and NaNs are given the same value, i.e., group-by semantics
+  std::vector<cuco::pair<Key, Value>> const h_pairs{{Key{0}, 1},
+                                                    {-Key{0}, 1},
+                                                    {nan, 2},
+                                                    {other_nan, 2},
+                                                    {Key{1.5}, 3},
+                                                    {-Key{1.5}, 4}};
+  std::vector<Key> const h_queries{-Key{0}, Key{0}, other_nan, nan, Key{1.5}, -Key{1.5}, Key{2.5}};
+  std::vector<Value> const h_expected{1, 1, 2, 2, 3, 4, -1};
+
+  thrust::device_vector<cuco::pair<Key, Value>> const pairs(h_pairs);
+  thrust::device_vector<Key> const queries(h_queries);
+  thrust::device_vector<Value> const expected(h_expected);
+
+  auto map = cuco::experimental::static_map<Key, Value>{
+    100, cuco::empty_key<Key>{-1}, cuco::empty_value<Value>{-1}};
+
+  SECTION("Equal keys and NaNs should be inserted once.")
+  {
+    REQUIRE(map.insert(pairs.begin(), pairs.end()) == 4);
+    REQUIRE(map.size() == 4);
+  }
+
+  SECTION("Equal keys and NaNs should find each other.")
+  {
+    map.insert(pairs.begin(), pairs.end());
+
+    thrust::device_vector<Value> found(queries.size());
+    map.find(queries.begin(), queries.end(), found.begin());
+    REQUIRE(cuco::test::equal(
+      found.begin(), found.end(), expected.begin(), thrust::equal_to<Value>{}));
+
+    thrust::device_vector<bool> contained(queries.size());
+    map.contains(queries.begin(), queries.end(), contained.begin());
+    REQUIRE(cuco::test::all_of(contained.begin(), contained.end() - 1, thrust::identity{}));
+    REQUIRE(cuco::test::none_of(contained.end() - 1, contained.end(), thrust::identity{}));
+  }
+}
@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utils.hpp>
+
+#include <cuco/static_set.cuh>
+#include <cuco/table_analysis.hpp>
+
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+
+#include <catch2/catch_template_test_macros.hpp>
+
+#include <cmath>
+#include <cstdint>
+#include <numeric>
+#include <string>
+
+// Maps every key to the same probing start, so that keys are stored in consecutive windows
+template <typename Key>
+struct constant_hash {
+  __device__ uint32_t operator()(Key const&) const noexcept { return 0; }
+};
+
+TEMPLATE_TEST_CASE_SIG(
+  "Table analysis",
+  "",
+  ((typename Key, int CGSize), Key, CGSize),
+  (int32_t, 1),
+  (int32_t, 2),
+  (int64_t, 1),
+  (int64_t, 2))
+{
+  constexpr std::size_t num_keys{400};
+
+  using probe    = cuco::experimental::linear_probing<CGSize, constant_hash<Key>>;
+  using set_type = cuco::experimental::static_set<Key,
+                                                  cuco::experimental::extent<std::size_t>,
+                                                  cuda::thread_scope_device,
+                                                  thrust::equal_to<Key>,
+                                                  probe,
+                                                  cuco::cuda_allocator<Key>,
+                                                  cuco::experimental::aow_storage<1>>;
+
+  set_type set{num_keys * 2, cuco::empty_key<Key>{-1}};
+
+  SECTION("An empty container has no displacement and no cluster.")
+  {
+    auto const report = set.analyze();
+    REQUIRE(report.capacity == set.capacity());
+    REQUIRE(report.size == 0);
+    REQUIRE(report.load_factor == 0.);
+    REQUIRE(report.max_displacement == 0);
+    REQUIRE(report.longest_cluster == 0);
+    REQUIRE(report.expected_probes_hit == 1.);
+    REQUIRE(report.expected_probes_miss == 1.);
+  }
+
+  auto const keys_begin = thrust::counting_iterator<Key>(0);
+  set.insert(keys_begin, keys_begin + num_keys);
+  auto const report = set.analyze();
+
+  SECTION("Occupancy matches the content of the container.")
+  {
+    REQUIRE(report.size == num_keys);
+    REQUIRE(report.load_factor == static_cast<double>(num_keys) / set.capacity());
+    REQUIRE(report.displacement_histogram.size() ==
+            cuco::experimental::table_analysis::num_displacement_bins);
+    REQUIRE(std::accumulate(report.displacement_histogram.begin(),
+                            report.displacement_histogram.end(),
+                            std::uint64_t{0}) == num_keys);
+  }
+
+  SECTION("Colliding keys form a single cluster of full windows.")
+  {
+    REQUIRE(report.longest_cluster == num_keys);
+    REQUIRE(report.full_window_fraction == static_cast<double>(num_keys) / report.num_windows);
+    REQUIRE(report.max_displacement == (num_keys - 1) / CGSize);
+    REQUIRE(report.expected_probes_hit > 1.);
+    REQUIRE(report.expected_probes_miss > 1.);
+    REQUIRE(std::isfinite(report.expected_probes_miss));
+  }
+
+  SECTION("The report serializes to JSON.")
+  {
+    auto const json = report.to_json();
+    REQUIRE(json.front() == '{');
+    REQUIRE(json.back() == '}');
+    REQUIRE(json.find("\"load_factor\": ") != std::string::npos);
+    REQUIRE(json.find("\"displacement_histogram\": [") != std::string::npos);
+    REQUIRE(json.find("\"expected_probes_miss\": null") == std::string::npos);
+  }
+}
@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utils.hpp>
+
+#include <cuco/hash_functions.cuh>
+#include <cuco/packed_pair_key.cuh>
+#include <cuco/static_set.cuh>
+
+#include <thrust/device_vector.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/tuple.h>
+
+#include <catch2/catch_template_test_macros.hpp>
+
+#include <cstdint>
+#include <vector>
+
+TEMPLATE_TEST_CASE("Packed pair key test",
+                   "",
+                   (cuco::packed_pair_key<int32_t, int32_t>),
+                   (cuco::packed_pair_key<uint32_t, int32_t>))
+{
+  using key_type = TestType;
+
+  static_assert(cuco::is_bitwise_comparable_v<key_type>);
+  static_assert(sizeof(key_type) == 8);
+
+  SECTION("Packing and unpacking should round-trip.")
+  {
+    auto const key = key_type{7, -9};
+    REQUIRE(key_type::unpack(key.pack()) == key);
+    REQUIRE(key.pack() == ((std::uint64_t{0xfffffff7} << 32) | 7));
+    REQUIRE(key_type{7, 9} != key_type{9, 7});
+  }
+
+  SECTION("Keys should hash like their packed representation.")
+  {
+    auto const key = key_type{123456789, -42};
+    REQUIRE(cuco::default_hash_function<key_type>{}(key) ==
+            cuco::default_hash_function<std::uint64_t>{}(key.pack()));
+    REQUIRE(cuco::xxhash_64<key_type>{42}(key) == cuco::xxhash_64<std::uint64_t>{42}(key.pack()));
+  }
+}
+
+TEST_CASE("Packed pair key static_set test", "")
+{
+  using key_type = cuco::packed_pair_key<int32_t, int32_t>;
+
+  // edge list with duplicate and reversed edges
+  std::vector<int32_t> const h_src{0, 1, 2, 0, 1, 3, 0};
+  std::vector<int32_t> const h_dst{1, 2, 3, 1, 2, 0, 2};
+  // (0, 1), (1, 2), (2, 3), (3, 0) and (0, 2) are unique
+  constexpr std::size_t num_unique_edges = 5;
+
+  thrust::device_vector<int32_t> const src(h_src);
+  thrust::device_vector<int32_t> const dst(h_dst);
+
+  auto set = cuco::experimental::static_set<key_type>{
+    100, cuco::empty_key<key_type>{key_type{-1, -1}}};
+
+  SECTION("Inserting two columns should deduplicate the composite keys.")
+  {
+    REQUIRE(set.insert(src.begin(), src.end(), dst.begin()) == num_unique_edges);
+    REQUIRE(set.size() == num_unique_edges);
+  }
+
+  SECTION("Columns and zipped columns should produce the same keys.")
+  {
+    auto const edges = thrust::make_zip_iterator(thrust::make_tuple(src.begin(), dst.begin()));
+    REQUIRE(set.insert(edges, edges + src.size()) == num_unique_edges);
+    REQUIRE(set.insert(src.begin(), src.end(), dst.begin()) == 0);
+  }
+
+  SECTION("Passing a stream should not select the two-column overloads.")
+  {
+    auto const edges = thrust::make_zip_iterator(thrust::make_tuple(src.begin(), dst.begin()));
+    REQUIRE(set.insert(edges, edges + src.size(), cudaStream_t{nullptr}) == num_unique_edges);
+
+    thrust::device_vector<bool> contained(src.size());
+    set.contains(edges, edges + src.size(), contained.begin(), cudaStream_t{nullptr});
+    REQUIRE(cuco::test::all_of(contained.begin(), contained.end(), thrust::identity{}));
+  }
+
+  SECTION("Inserted edges, and only them, should be contained.")
+  {
+    set.insert(src.begin(), src.end(), dst.begin());
+
+    thrust::device_vector<bool> contained(src.size());
+    set.contains(src.begin(), src.end(), dst.begin(), contained.begin());
+    REQUIRE(cuco::test::all_of(contained.begin(), contained.end(), thrust::identity{}));
+
+    // no reversed edge was inserted
+    set.contains(dst.begin(), dst.end(), src.begin(), contained.begin());
+    REQUIRE(cuco::test::none_of(contained.begin(), contained.end(), thrust::identity{}));
+  }
+}
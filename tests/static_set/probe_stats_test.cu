@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utils.hpp>
+
+#include <cuco/probe_stats.cuh>
+#include <cuco/static_set.cuh>
+
+#include <thrust/device_vector.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+
+#include <catch2/catch_template_test_macros.hpp>
+
+#include <cstdint>
+#include <numeric>
+
+// Maps every key to the same probing start, so that probe lengths grow with the number of keys
+template <typename Key>
+struct constant_hash {
+  __device__ uint32_t operator()(Key const&) const noexcept { return 0; }
+};
+
+TEMPLATE_TEST_CASE_SIG(
+  "Probing statistics",
+  "",
+  ((typename Key, int CGSize), Key, CGSize),
+  (int32_t, 1),
+  (int32_t, 2),
+  (int64_t, 1),
+  (int64_t, 2))
+{
+  constexpr std::size_t num_keys{400};
+  constexpr int32_t num_bins{8};
+
+  using probe    = cuco::experimental::linear_probing<CGSize, constant_hash<Key>>;
+  using stats    = cuco::experimental::probe_stats<num_bins>;
+  using set_type = cuco::experimental::static_set<Key,
+                                                  cuco::experimental::extent<std::size_t>,
+                                                  cuda::thread_scope_device,
+                                                  thrust::equal_to<Key>,
+                                                  probe,
+                                                  cuco::cuda_allocator<Key>,
+                                                  cuco::experimental::aow_storage<1>,
+                                                  stats>;
+
+  auto const sum = [](auto const& histogram) {
+    return std::accumulate(histogram.begin(), histogram.end(), std::uint64_t{0});
+  };
+
+  set_type set{num_keys * 2, cuco::empty_key<Key>{-1}};
+
+  auto const keys_begin = thrust::counting_iterator<Key>(0);
+  auto const keys_end   = thrust::counting_iterator<Key>(num_keys);
+  thrust::device_vector<bool> d_contained(num_keys);
+
+  auto const initial = set.stats();
+  REQUIRE(initial.insert_probe_lengths.size() == num_bins);
+  REQUIRE(initial.lookup_probe_lengths.size() == num_bins);
+  REQUIRE(sum(initial.insert_probe_lengths) == 0);
+  REQUIRE(sum(initial.lookup_probe_lengths) == 0);
+
+  set.insert(keys_begin, keys_end);
+  set.contains(keys_begin, keys_end, d_contained.begin());
+  REQUIRE(cuco::test::all_of(d_contained.begin(), d_contained.end(), thrust::identity{}));
+
+  auto const summary = set.stats();
+
+  SECTION("Every operation records exactly one probe length.")
+  {
+    REQUIRE(sum(summary.insert_probe_lengths) == num_keys);
+    REQUIRE(sum(summary.lookup_probe_lengths) == num_keys);
+  }
+
+  SECTION("Colliding keys are recorded as long probing sequences.")
+  {
+    REQUIRE(summary.insert_probe_lengths.back() > 0);
+    REQUIRE(summary.lookup_probe_lengths.back() > 0);
+  }
+
+  SECTION("Inserting present keys records one duplicate per key.")
+  {
+    REQUIRE(summary.num_duplicates == 0);
+
+    set.reset_stats();
+    REQUIRE(set.insert(keys_begin, keys_end) == 0);
+    REQUIRE(set.stats().num_duplicates == num_keys);
+  }
+
+  SECTION("Resetting the statistics zeroes all counters.")
+  {
+    set.reset_stats();
+    auto const reset = set.stats();
+    REQUIRE(sum(reset.insert_probe_lengths) == 0);
+    REQUIRE(sum(reset.lookup_probe_lengths) == 0);
+    REQUIRE(reset.num_cas_failures == 0);
+    REQUIRE(reset.num_duplicates == 0);
+  }
+}
@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cuco/static_set.cuh>
+#include <cuco/tracing.hpp>
+
+#include <thrust/device_vector.h>
+#include <thrust/execution_policy.h>
+#include <thrust/sequence.h>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cmath>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+TEST_CASE("Tracing of bulk operations", "")
+{
+  constexpr std::size_t num_keys{400};
+
+  cuco::experimental::static_set<int> set{cuco::experimental::extent<std::size_t>{800},
+                                          cuco::empty_key{-1}};
+
+  thrust::device_vector<int> d_keys(num_keys);
+  thrust::device_vector<bool> d_contained(num_keys);
+  thrust::device_vector<int> d_found(num_keys);
+
+  thrust::sequence(thrust::device, d_keys.begin(), d_keys.end());
+
+  SECTION("Without a tracer, bulk operations are not traced.")
+  {
+    REQUIRE(set.insert(d_keys.begin(), d_keys.end()) == num_keys);
+  }
+
+  SECTION("A callback tracer receives a begin and an end event per bulk operation.")
+  {
+    std::vector<cuco::experimental::trace_event> begins;
+    std::vector<cuco::experimental::trace_event> ends;
+    set.set_tracer(std::make_shared<cuco::experimental::callback_tracer>(
+      [&](auto const& event) { begins.push_back(event); },
+      [&](auto const& event) { ends.push_back(event); }));
+
+    set.insert(d_keys.begin(), d_keys.end());
+    set.find(d_keys.begin(), d_keys.end(), d_found.begin());
+    set.contains(d_keys.begin(), d_keys.end(), d_contained.begin());
+    set.contains_async(d_keys.begin(), d_keys.end(), d_contained.begin());
+
+    REQUIRE(begins.size() == 4);
+    REQUIRE(ends.size() == 4);
+    REQUIRE(std::string{ends[0].name} == "insert");
+    REQUIRE(std::string{ends[1].name} == "find");
+    REQUIRE(std::string{ends[2].name} == "contains");
+    REQUIRE(std::string{ends[3].name} == "contains_async");
+    for (auto const& event : ends) {
+      REQUIRE(event.num_keys == num_keys);
+      REQUIRE(event.capacity == set.capacity());
+      REQUIRE(std::isnan(event.load_factor));
+      REQUIRE(event.duration >= 0.);
+    }
+
+    set.set_tracer(nullptr);
+    set.contains(d_keys.begin(), d_keys.end(), d_contained.begin());
+
+    REQUIRE(ends.size() == 4);
+  }
+
+  SECTION("Operations implemented in terms of others are traced once under their own name.")
+  {
+    std::vector<std::string> names;
+    set.set_tracer(std::make_shared<cuco::experimental::callback_tracer>(
+      [&](auto const& event) { names.emplace_back(event.name); }, nullptr));
+
+    set.clear();
+    set.clear_async();
+
+    std::vector<std::string> const expected{"clear", "clear_async"};
+    REQUIRE(names == expected);
+  }
+
+  SECTION("Exceptions thrown by callbacks do not escape bulk operations.")
+  {
+    set.set_tracer(std::make_shared<cuco::experimental::callback_tracer>(
+      [](auto const&) { throw std::runtime_error{"begin"}; },
+      [](auto const&) { throw std::runtime_error{"end"}; }));
+
+    REQUIRE_NOTHROW(set.insert_async(d_keys.begin(), d_keys.end()));
+    REQUIRE(set.size() == num_keys);
+  }
+
+  SECTION("A tracer requesting load factors gets them before and after each operation.")
+  {
+    std::vector<double> load_factors;
+    auto const record = [&](auto const& event) { load_factors.push_back(event.load_factor); };
+    set.set_tracer(std::make_shared<cuco::experimental::callback_tracer>(record, record, true));
+
+    set.insert(d_keys.begin(), d_keys.end());
+
+    REQUIRE(load_factors.size() == 2);
+    REQUIRE(load_factors[0] == 0.);
+    REQUIRE(load_factors[1] == static_cast<double>(num_keys) / set.capacity());
+  }
+
+  SECTION("The Chrome trace writer writes a JSON array of duration events.")
+  {
+    std::ostringstream out;
+    {
+      auto writer = std::make_shared<cuco::experimental::chrome_trace_writer>(out);
+      set.set_tracer(writer);
+      set.insert(d_keys.begin(), d_keys.end());
+      set.set_tracer(nullptr);
+    }
+    auto const json = out.str();
+
+    REQUIRE(json.front() == '[');
+    REQUIRE(json.find("\"name\": \"insert\"") != std::string::npos);
+    REQUIRE(json.find("\"ph\": \"B\"") != std::string::npos);
+    REQUIRE(json.find("\"ph\": \"E\"") != std::string::npos);
+    REQUIRE(json.find("\"num_keys\": 400") != std::string::npos);
+    REQUIRE(json.rfind(']') != std::string::npos);
+  }
+}
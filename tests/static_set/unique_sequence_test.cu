@@ -150,3 +150,30 @@ TEMPLATE_TEST_CASE_SIG(
 
   test_unique_sequence(set, num_keys);
 }
+
+TEMPLATE_TEST_CASE_SIG(
+  "Unique sequence with double hashing from a single 128-bit hash",
+  "",
+  ((typename Key, typename Hash, int CGSize), Key, Hash, CGSize),
+  (int32_t, cuco::xxhash_128<int32_t>, 1),
+  (int32_t, cuco::xxhash_128<int32_t>, 2),
+  (int64_t, cuco::xxhash_128<int64_t>, 1),
+  (int64_t, cuco::xxhash_128<int64_t>, 2),
+  (int32_t, cuco::murmurhash3_x64_128<int32_t>, 1),
+  (int64_t, cuco::murmurhash3_x64_128<int64_t>, 2))
+{
+  constexpr size_type num_keys{400};
+
+  using probe = cuco::experimental::double_hashing<CGSize, Hash>;
+
+  auto set = cuco::experimental::static_set<Key,
+                                            cuco::experimental::extent<size_type>,
+                                            cuda::thread_scope_device,
+                                            thrust::equal_to<Key>,
+                                            probe,
+                                            cuco::cuda_allocator<std::byte>,
+                                            cuco::experimental::aow_storage<2>>{
+    num_keys, cuco::empty_key<Key>{-1}};
+
+  test_unique_sequence(set, num_keys);
+}
@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utils.hpp>
+
+#include <cuco/capacity_plan.cuh>
+#include <cuco/static_set.cuh>
+
+#include <thrust/functional.h>
+
+#include <catch2/catch_template_test_macros.hpp>
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+TEMPLATE_TEST_CASE_SIG("Capacity plan tests", "", ((typename Key), Key), (int32_t), (int64_t))
+{
+  std::size_t constexpr num_keys       = 617;
+  double constexpr target_load         = 0.5;
+  std::size_t constexpr gold_reference = 314;  // 157 x 2, i.e., make_window_extent<2, 4>(1234)
+  auto constexpr cg_size               = 2;
+  auto constexpr window_size           = 4;
+
+  using probe    = cuco::experimental::linear_probing<cg_size, cuco::default_hash_function<Key>>;
+  using set_type = cuco::experimental::static_set<Key,
+                                                  cuco::experimental::extent<std::size_t>,
+                                                  cuda::thread_scope_device,
+                                                  thrust::equal_to<Key>,
+                                                  probe,
+                                                  cuco::cuda_allocator<Key>,
+                                                  cuco::experimental::aow_storage<window_size>>;
+
+  auto const is_close = [](double lhs, double rhs) { return std::abs(lhs - rhs) < 1e-6; };
+
+  SECTION("Container plan matches the container capacity.")
+  {
+    auto const result = cuco::experimental::plan<set_type>(num_keys, target_load);
+    REQUIRE(result.cg_size == cg_size);
+    REQUIRE(result.window_size == window_size);
+    REQUIRE(result.model == cuco::experimental::probing_model::LINEAR);
+    REQUIRE(result.num_windows == gold_reference);
+    REQUIRE(result.capacity == gold_reference * window_size);
+    REQUIRE(result.bytes == result.capacity * sizeof(Key));
+    REQUIRE(result.load_factor <= target_load);
+  }
+
+  SECTION("Run-time plan matches the container plan.")
+  {
+    auto const expected = cuco::experimental::plan<set_type>(num_keys, target_load);
+    auto const result   = cuco::experimental::plan(num_keys,
+                                                 target_load,
+                                                 cg_size,
+                                                 window_size,
+                                                 sizeof(Key),
+                                                 cuco::experimental::probing_model::LINEAR);
+    REQUIRE(result.num_windows == expected.num_windows);
+    REQUIRE(result.bytes == expected.bytes);
+    REQUIRE(result.expected_probes_miss == expected.expected_probes_miss);
+  }
+
+  SECTION("Single slot probing steps follow the classical estimates.")
+  {
+    auto const linear = cuco::experimental::plan(
+      num_keys, target_load, 1, 1, sizeof(Key), cuco::experimental::probing_model::LINEAR);
+    auto const load = linear.load_factor;
+    REQUIRE(is_close(linear.expected_probes_hit, 0.5 * (1. + 1. / (1. - load))));
+    REQUIRE(is_close(linear.expected_probes_miss, 0.5 * (1. + 1. / ((1. - load) * (1. - load)))));
+
+    auto const uniform = cuco::experimental::plan(
+      num_keys, target_load, 1, 1, sizeof(Key), cuco::experimental::probing_model::UNIFORM);
+    REQUIRE(is_close(uniform.expected_probes_hit, std::log(1. / (1. - load)) / load));
+    REQUIRE(is_close(uniform.expected_probes_miss, 1. / (1. - load)));
+  }
+
+  SECTION("Minimal memory plan stays within the probe budget.")
+  {
+    for (auto const model : {cuco::experimental::probing_model::LINEAR,
+                             cuco::experimental::probing_model::UNIFORM}) {
+      auto const tight = cuco::experimental::min_memory_plan(num_keys, 1.5, sizeof(Key), model);
+      auto const loose = cuco::experimental::min_memory_plan(num_keys, 4., sizeof(Key), model);
+      REQUIRE(tight.expected_probes_miss <= 1.5);
+      REQUIRE(loose.expected_probes_miss <= 4.);
+      REQUIRE(loose.bytes <= tight.bytes);
+      REQUIRE(tight.capacity >= num_keys);
+    }
+  }
+
+  SECTION("Invalid parameters are rejected.")
+  {
+    REQUIRE_THROWS_AS(cuco::experimental::plan<set_type>(num_keys, 0.), cuco::logic_error);
+    REQUIRE_THROWS_AS(cuco::experimental::plan<set_type>(num_keys, 1.5), cuco::logic_error);
+    REQUIRE_THROWS_AS(cuco::experimental::min_memory_plan(
+                        num_keys, 1., sizeof(Key), cuco::experimental::probing_model::UNIFORM),
+                      cuco::logic_error);
+  }
+}
@@ -0,0 +1,196 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utils.hpp>
+
+#include <cuco/extent.cuh>
+#include <cuco/hash_functions.cuh>
+#include <cuco/hash_quality.cuh>
+#include <cuco/probing_scheme.cuh>
+
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+namespace {
+template <typename Key>
+struct identity_hash {
+  constexpr Key __host__ __device__ operator()(Key const& key) const noexcept { return key; }
+};
+
+enum class key_pattern { SEQUENTIAL, STRIDED, CLUSTERED };
+
+std::vector<int32_t> generate_keys(key_pattern pattern, std::size_t num_keys)
+{
+  std::vector<int32_t> keys(num_keys);
+  for (std::size_t i = 0; i < num_keys; ++i) {
+    auto const key = static_cast<int32_t>(i);
+    switch (pattern) {
+      case key_pattern::SEQUENTIAL: keys[i] = key; break;
+      case key_pattern::STRIDED: keys[i] = key << 8; break;
+      // runs of 16 consecutive keys, 4096 apart
+      case key_pattern::CLUSTERED: keys[i] = (key / 16) * 4096 + key % 16; break;
+    }
+  }
+  return keys;
+}
+}  // namespace
+
+TEMPLATE_TEST_CASE("Hash quality test",
+                   "",
+                   cuco::xxhash_32<int32_t>,
+                   cuco::xxhash_64<int32_t>,
+                   cuco::xxhash3_64<int32_t>,
+                   cuco::murmurhash3_32<int32_t>,
+                   cuco::crc32c_32<int32_t>,
+                   cuco::multiply_shift<int32_t>,
+                   cuco::tabulation_32<int32_t>)
+{
+  using hash_type = TestType;
+
+  constexpr std::size_t pow2_windows = 8192;
+  auto const prime_windows           = cuco::experimental::make_window_extent<1, 1>(pow2_windows);
+  constexpr std::size_t num_keys     = pow2_windows / 2;
+  constexpr double max_chi_square    = 1.1;
+  // 25% above the expected 1/2 (1 + 1/(1 - 0.5)) probes of a random hash at load factor 0.5
+  constexpr double max_mean_probes = 1.25 * 1.5;
+
+  auto const pattern =
+    GENERATE(key_pattern::SEQUENTIAL, key_pattern::STRIDED, key_pattern::CLUSTERED);
+  auto const keys = generate_keys(pattern, num_keys);
+
+  for (auto const num_windows : {prime_windows, pow2_windows}) {
+    INFO("pattern " << static_cast<int>(pattern) << ", " << num_windows << " windows");
+
+    auto const chi_square =
+      cuco::experimental::bucket_chi_square(hash_type{}, keys.begin(), keys.end(), num_windows);
+    REQUIRE(chi_square < max_chi_square);
+
+    auto const report =
+      cuco::experimental::probe_lengths(cuco::experimental::linear_probing<1, hash_type>{},
+                                        keys.begin(),
+                                        keys.end(),
+                                        num_windows);
+    REQUIRE(report.num_failed == 0);
+    REQUIRE(report.num_keys == num_keys);
+    REQUIRE(report.mean_probes < max_mean_probes);
+    REQUIRE(std::accumulate(report.histogram.begin(), report.histogram.end(), std::size_t{0}) ==
+            num_keys);
+  }
+}
+
+TEMPLATE_TEST_CASE("Avalanche test",
+                   "",
+                   cuco::xxhash_32<int32_t>,
+                   cuco::xxhash_64<int32_t>,
+                   cuco::xxhash3_64<int32_t>,
+                   cuco::murmurhash3_32<int32_t>)
+{
+  auto const keys = generate_keys(key_pattern::SEQUENTIAL, 4096);
+
+  REQUIRE(cuco::experimental::avalanche_bias(TestType{}, keys.begin(), keys.end()) < 0.02);
+}
+
+TEST_CASE("Bad hash and extent combination test", "")
+{
+  using hash_type = identity_hash<int32_t>;
+
+  constexpr std::size_t pow2_windows = 8192;
+  auto const prime_windows           = cuco::experimental::make_window_extent<1, 1>(pow2_windows);
+  auto const keys                    = generate_keys(key_pattern::STRIDED, pow2_windows / 2);
+
+  SECTION("The identity hash should not avalanche.")
+  {
+    REQUIRE(cuco::experimental::avalanche_bias(hash_type{}, keys.begin(), keys.end()) > 0.4);
+  }
+
+  SECTION("Strided keys should cluster into few power-of-two buckets.")
+  {
+    REQUIRE(cuco::experimental::bucket_chi_square(
+              hash_type{}, keys.begin(), keys.end(), prime_windows) < 1.1);
+    REQUIRE(cuco::experimental::bucket_chi_square(
+              hash_type{}, keys.begin(), keys.end(), pow2_windows) > 10.);
+  }
+
+  SECTION("Linear probing over a power-of-two extent should degrade to long probe sequences.")
+  {
+    auto const probing_scheme = cuco::experimental::linear_probing<1, hash_type>{};
+
+    auto const prime_report =
+      cuco::experimental::probe_lengths(probing_scheme, keys.begin(), keys.end(), prime_windows);
+    REQUIRE(prime_report.max_probes == 1);
+
+    auto const pow2_report =
+      cuco::experimental::probe_lengths(probing_scheme, keys.begin(), keys.end(), pow2_windows);
+    REQUIRE(pow2_report.num_failed == 0);
+    REQUIRE(pow2_report.mean_probes > 10.);
+    REQUIRE(pow2_report.max_probes > 100);
+  }
+
+  SECTION("Double hashing over a power-of-two extent should fail to insert keys.")
+  {
+    // most step sizes are multiples of 256, i.e., their probing sequences visit only 32 windows
+    auto const probing_scheme = cuco::experimental::double_hashing<1, hash_type, hash_type>{};
+
+    auto const prime_report =
+      cuco::experimental::probe_lengths(probing_scheme, keys.begin(), keys.end(), prime_windows);
+    REQUIRE(prime_report.num_failed == 0);
+
+    auto const pow2_report =
+      cuco::experimental::probe_lengths(probing_scheme, keys.begin(), keys.end(), pow2_windows);
+    REQUIRE(pow2_report.num_failed > 0);
+    REQUIRE(pow2_report.num_keys + pow2_report.num_failed == keys.size());
+  }
+}
+
+TEST_CASE("Probe length report test", "")
+{
+  using probing_scheme_type =
+    cuco::experimental::linear_probing<1, cuco::default_hash_function<int32_t>>;
+
+  auto const keys = generate_keys(key_pattern::SEQUENTIAL, 1000);
+
+  SECTION("Load factor should account for all slots of the windows.")
+  {
+    auto const report =
+      cuco::experimental::probe_lengths(probing_scheme_type{}, keys.begin(), keys.end(), 1009, 2);
+    REQUIRE(report.num_keys == keys.size());
+    REQUIRE(report.load_factor == static_cast<double>(keys.size()) / (2 * 1009));
+    REQUIRE(report.histogram.size() == report.max_probes);
+  }
+
+  SECTION("A table filled to capacity should still hold every key.")
+  {
+    auto const report =
+      cuco::experimental::probe_lengths(probing_scheme_type{}, keys.begin(), keys.end(), 1000);
+    REQUIRE(report.num_failed == 0);
+    REQUIRE(report.load_factor == 1.);
+  }
+
+  SECTION("Tables that cannot hold all keys should be rejected.")
+  {
+    REQUIRE_THROWS_AS(cuco::experimental::probe_lengths(
+                        probing_scheme_type{}, keys.begin(), keys.end(), 999),
+                      cuco::logic_error);
+    REQUIRE_THROWS_AS(cuco::experimental::bucket_chi_square(
+                        cuco::default_hash_function<int32_t>{}, keys.begin(), keys.end(), 1),
+                      cuco::logic_error);
+  }
+}
@@ -24,7 +24,15 @@
 #include <catch2/catch_template_test_macros.hpp>
 #include <catch2/catch_test_macros.hpp>
 
+#include <bitset>
+#include <climits>
+#include <cmath>
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include <vector>
 
 template <int32_t Words>
 struct large_key {
@@ -39,9 +47,9 @@ struct large_key {
   int32_t data_[Words];
 };
 
-template <typename Hash>
+template <typename Hash, typename Seed>
 __host__ __device__ bool check_hash_result(typename Hash::argument_type const& key,
-                                           typename Hash::result_type seed,
+                                           Seed seed,
                                            typename Hash::result_type expected) noexcept
 {
   Hash h(seed);
@@ -175,6 +183,490 @@ TEST_CASE("Test cuco::xxhash_32", "")
   }
 }
 
+template <typename OutputIter>
+__global__ void check_hash_result_kernel_xxhash3_64(OutputIter result)
+{
+  int i = 0;
+
+  result[i++] = check_hash_result<cuco::xxhash3_64<char>>(0, 0, 14144645293874801883);
+  result[i++] = check_hash_result<cuco::xxhash3_64<char>>(42, 0, 8777568547874204941);
+  result[i++] = check_hash_result<cuco::xxhash3_64<char>>(0, 42, 6697150685477982789);
+
+  result[i++] = check_hash_result<cuco::xxhash3_64<int32_t>>(0, 0, 5238470482016868669);
+  result[i++] = check_hash_result<cuco::xxhash3_64<int32_t>>(0, 42, 14325386350854113765);
+  result[i++] = check_hash_result<cuco::xxhash3_64<int32_t>>(42, 0, 2392174772787195229);
+  result[i++] = check_hash_result<cuco::xxhash3_64<int32_t>>(123456789, 0, 5186869424260940993);
+
+  result[i++] = check_hash_result<cuco::xxhash3_64<int64_t>>(0, 0, 14374147212387527897);
+  result[i++] = check_hash_result<cuco::xxhash3_64<int64_t>>(0, 42, 5014318936221084462);
+  result[i++] = check_hash_result<cuco::xxhash3_64<int64_t>>(42, 0, 15395265915043915720);
+  result[i++] = check_hash_result<cuco::xxhash3_64<int64_t>>(123456789, 0, 2817400364357085909);
+
+#if defined(CUCO_HAS_INT128)
+  result[i++] = check_hash_result<cuco::xxhash3_64<__int128>>(123456789, 0, 7602280935813847626);
+#endif
+
+  result[i++] =
+    check_hash_result<cuco::xxhash3_64<large_key<32>>>(123456789, 0, 9278458725499332637);
+  result[i++] =
+    check_hash_result<cuco::xxhash3_64<large_key<64>>>(123456789, 0, 15962532058857181731);
+}
+
+TEST_CASE("Test cuco::xxhash3_64", "")
+{
+  // Reference hash values were computed using https://github.com/Cyan4973/xxHash
+  SECTION("Check if host-generated hash values match the reference implementation.")
+  {
+    CHECK(check_hash_result<cuco::xxhash3_64<char>>(0, 0, 14144645293874801883));
+    CHECK(check_hash_result<cuco::xxhash3_64<char>>(42, 0, 8777568547874204941));
+    CHECK(check_hash_result<cuco::xxhash3_64<char>>(0, 42, 6697150685477982789));
+
+    CHECK(check_hash_result<cuco::xxhash3_64<int32_t>>(0, 0, 5238470482016868669));
+    CHECK(check_hash_result<cuco::xxhash3_64<int32_t>>(0, 42, 14325386350854113765));
+    CHECK(check_hash_result<cuco::xxhash3_64<int32_t>>(42, 0, 2392174772787195229));
+    CHECK(check_hash_result<cuco::xxhash3_64<int32_t>>(123456789, 0, 5186869424260940993));
+
+    CHECK(check_hash_result<cuco::xxhash3_64<int64_t>>(0, 0, 14374147212387527897));
+    CHECK(check_hash_result<cuco::xxhash3_64<int64_t>>(0, 42, 5014318936221084462));
+    CHECK(check_hash_result<cuco::xxhash3_64<int64_t>>(42, 0, 15395265915043915720));
+    CHECK(check_hash_result<cuco::xxhash3_64<int64_t>>(123456789, 0, 2817400364357085909));
+
+#if defined(CUCO_HAS_INT128)
+    CHECK(check_hash_result<cuco::xxhash3_64<__int128>>(123456789, 0, 7602280935813847626));
+#endif
+
+    // 32*4=128-byte key to test the mid-size hashing path
+    CHECK(check_hash_result<cuco::xxhash3_64<large_key<32>>>(123456789, 0, 9278458725499332637));
+    // 64*4=256-byte key to test the long-input hashing loop
+    CHECK(check_hash_result<cuco::xxhash3_64<large_key<64>>>(123456789, 0, 15962532058857181731));
+  }
+
+  SECTION("Check if device-generated hash values match the reference implementation.")
+  {
+    thrust::device_vector<bool> result(20, true);
+
+    check_hash_result_kernel_xxhash3_64<<<1, 1>>>(result.begin());
+
+    CHECK(cuco::test::all_of(result.begin(), result.end(), [] __device__(bool v) { return v; }));
+  }
+}
+
+template <typename OutputIter>
+__global__ void check_hash_result_kernel_rapidhash_64(OutputIter result)
+{
+  int i = 0;
+
+  result[i++] = check_hash_result<cuco::rapidhash_64<char>>(0, 0, 3040105386354973525);
+  result[i++] = check_hash_result<cuco::rapidhash_64<char>>(42, 0, 12907148900567155274);
+  result[i++] = check_hash_result<cuco::rapidhash_64<char>>(0, 42, 7654188204808270638);
+
+  result[i++] = check_hash_result<cuco::rapidhash_64<int32_t>>(0, 0, 12490488466520542197);
+  result[i++] = check_hash_result<cuco::rapidhash_64<int32_t>>(0, 42, 12325890503451332473);
+  result[i++] = check_hash_result<cuco::rapidhash_64<int32_t>>(42, 0, 13568230169031350950);
+  result[i++] = check_hash_result<cuco::rapidhash_64<int32_t>>(123456789, 0, 14615247229148971847);
+
+  result[i++] = check_hash_result<cuco::rapidhash_64<int64_t>>(0, 0, 12495318543703920742);
+  result[i++] = check_hash_result<cuco::rapidhash_64<int64_t>>(0, 42, 3177755939109846596);
+  result[i++] = check_hash_result<cuco::rapidhash_64<int64_t>>(42, 0, 7671263869384236803);
+  result[i++] = check_hash_result<cuco::rapidhash_64<int64_t>>(123456789, 0, 15629722297699616510);
+
+#if defined(CUCO_HAS_INT128)
+  result[i++] = check_hash_result<cuco::rapidhash_64<__int128>>(123456789, 0, 16978823682595551426);
+#endif
+
+  result[i++] =
+    check_hash_result<cuco::rapidhash_64<large_key<32>>>(123456789, 0, 8604824855969089236);
+  result[i++] =
+    check_hash_result<cuco::rapidhash_64<large_key<64>>>(123456789, 0, 13677727786777777690);
+}
+
+TEST_CASE("Test cuco::rapidhash_64", "")
+{
+  // Reference hash values were computed using https://github.com/Nicoshev/rapidhash
+  SECTION("Check if host-generated hash values match the reference implementation.")
+  {
+    CHECK(check_hash_result<cuco::rapidhash_64<char>>(0, 0, 3040105386354973525));
+    CHECK(check_hash_result<cuco::rapidhash_64<char>>(42, 0, 12907148900567155274));
+    CHECK(check_hash_result<cuco::rapidhash_64<char>>(0, 42, 7654188204808270638));
+
+    CHECK(check_hash_result<cuco::rapidhash_64<int32_t>>(0, 0, 12490488466520542197));
+    CHECK(check_hash_result<cuco::rapidhash_64<int32_t>>(0, 42, 12325890503451332473));
+    CHECK(check_hash_result<cuco::rapidhash_64<int32_t>>(42, 0, 13568230169031350950));
+    CHECK(check_hash_result<cuco::rapidhash_64<int32_t>>(123456789, 0, 14615247229148971847));
+
+    CHECK(check_hash_result<cuco::rapidhash_64<int64_t>>(0, 0, 12495318543703920742));
+    CHECK(check_hash_result<cuco::rapidhash_64<int64_t>>(0, 42, 3177755939109846596));
+    CHECK(check_hash_result<cuco::rapidhash_64<int64_t>>(42, 0, 7671263869384236803));
+    CHECK(check_hash_result<cuco::rapidhash_64<int64_t>>(123456789, 0, 15629722297699616510));
+
+#if defined(CUCO_HAS_INT128)
+    CHECK(check_hash_result<cuco::rapidhash_64<__int128>>(123456789, 0, 16978823682595551426));
+#endif
+
+    // 32*4=128-byte and 64*4=256-byte keys to test the 48-byte block loop
+    CHECK(check_hash_result<cuco::rapidhash_64<large_key<32>>>(123456789, 0, 8604824855969089236));
+    CHECK(check_hash_result<cuco::rapidhash_64<large_key<64>>>(123456789, 0, 13677727786777777690));
+  }
+
+  SECTION("Check if device-generated hash values match the reference implementation.")
+  {
+    thrust::device_vector<bool> result(20, true);
+
+    check_hash_result_kernel_rapidhash_64<<<1, 1>>>(result.begin());
+
+    CHECK(cuco::test::all_of(result.begin(), result.end(), [] __device__(bool v) { return v; }));
+  }
+}
+
+template <typename OutputIter>
+__global__ void check_hash_result_kernel_murmurhash3_x64_128(OutputIter result)
+{
+  int i = 0;
+
+  result[i++] = check_hash_result<cuco::murmurhash3_x64_128<char>>(
+    0, 0, {5048724184180415669, 5864299874987029891});
+  result[i++] = check_hash_result<cuco::murmurhash3_x64_128<char>>(
+    42, 0, {16059305763964236121, 17384816157952992526});
+  result[i++] = check_hash_result<cuco::murmurhash3_x64_128<char>>(
+    0, 42, {3620611332830817736, 1638674688766493785});
+
+  result[i++] = check_hash_result<cuco::murmurhash3_x64_128<int32_t>>(
+    0, 0, {14961230494313510588, 6383328099726337777});
+  result[i++] = check_hash_result<cuco::murmurhash3_x64_128<int32_t>>(
+    0, 42, {5111656417125064774, 7107720512181644050});
+  result[i++] = check_hash_result<cuco::murmurhash3_x64_128<int32_t>>(
+    42, 0, {2913627637088662735, 16344193523890567190});
+  result[i++] = check_hash_result<cuco::murmurhash3_x64_128<int32_t>>(
+    123456789, 0, {18395048899904449764, 11395765665038728924});
+
+  result[i++] = check_hash_result<cuco::murmurhash3_x64_128<int64_t>>(
+    0, 0, {2945182322382062539, 17462001654787800658});
+  result[i++] = check_hash_result<cuco::murmurhash3_x64_128<int64_t>>(
+    0, 42, {4849139840249140547, 570576367349817801});
+  result[i++] = check_hash_result<cuco::murmurhash3_x64_128<int64_t>>(
+    42, 0, {13163110875106803192, 2646172625393561472});
+  result[i++] = check_hash_result<cuco::murmurhash3_x64_128<int64_t>>(
+    123456789, 0, {2733603999106345681, 13547817608224914640});
+
+#if defined(CUCO_HAS_INT128)
+  result[i++] = check_hash_result<cuco::murmurhash3_x64_128<__int128>>(
+    123456789, 0, {17538182871295166812, 12492340733598320124});
+#endif
+
+  result[i++] = check_hash_result<cuco::murmurhash3_x64_128<large_key<32>>>(
+    123456789, 0, {8880441029258659336, 15719866559153633586});
+  result[i++] = check_hash_result<cuco::murmurhash3_x64_128<large_key<64>>>(
+    123456789, 0, {9869771680876811450, 13099817139769626295});
+}
+
+TEST_CASE("Test cuco::murmurhash3_x64_128", "")
+{
+  // Reference hash values were computed using https://github.com/aappleby/smhasher
+  SECTION("Check if host-generated hash values match the reference implementation.")
+  {
+    CHECK(check_hash_result<cuco::murmurhash3_x64_128<char>>(
+      0, 0, {5048724184180415669, 5864299874987029891}));
+    CHECK(check_hash_result<cuco::murmurhash3_x64_128<char>>(
+      42, 0, {16059305763964236121, 17384816157952992526}));
+    CHECK(check_hash_result<cuco::murmurhash3_x64_128<char>>(
+      0, 42, {3620611332830817736, 1638674688766493785}));
+
+    CHECK(check_hash_result<cuco::murmurhash3_x64_128<int32_t>>(
+      0, 0, {14961230494313510588, 6383328099726337777}));
+    CHECK(check_hash_result<cuco::murmurhash3_x64_128<int32_t>>(
+      0, 42, {5111656417125064774, 7107720512181644050}));
+    CHECK(check_hash_result<cuco::murmurhash3_x64_128<int32_t>>(
+      42, 0, {2913627637088662735, 16344193523890567190}));
+    CHECK(check_hash_result<cuco::murmurhash3_x64_128<int32_t>>(
+      123456789, 0, {18395048899904449764, 11395765665038728924}));
+
+    CHECK(check_hash_result<cuco::murmurhash3_x64_128<int64_t>>(
+      0, 0, {2945182322382062539, 17462001654787800658}));
+    CHECK(check_hash_result<cuco::murmurhash3_x64_128<int64_t>>(
+      0, 42, {4849139840249140547, 570576367349817801}));
+    CHECK(check_hash_result<cuco::murmurhash3_x64_128<int64_t>>(
+      42, 0, {13163110875106803192, 2646172625393561472}));
+    CHECK(check_hash_result<cuco::murmurhash3_x64_128<int64_t>>(
+      123456789, 0, {2733603999106345681, 13547817608224914640}));
+
+#if defined(CUCO_HAS_INT128)
+    CHECK(check_hash_result<cuco::murmurhash3_x64_128<__int128>>(
+      123456789, 0, {17538182871295166812, 12492340733598320124}));
+#endif
+
+    // 32*4=128-byte and 64*4=256-byte keys to test the block-wise hashing loop
+    CHECK(check_hash_result<cuco::murmurhash3_x64_128<large_key<32>>>(
+      123456789, 0, {8880441029258659336, 15719866559153633586}));
+    CHECK(check_hash_result<cuco::murmurhash3_x64_128<large_key<64>>>(
+      123456789, 0, {9869771680876811450, 13099817139769626295}));
+  }
+
+  SECTION("Check if device-generated hash values match the reference implementation.")
+  {
+    thrust::device_vector<bool> result(20, true);
+
+    check_hash_result_kernel_murmurhash3_x64_128<<<1, 1>>>(result.begin());
+
+    CHECK(cuco::test::all_of(result.begin(), result.end(), [] __device__(bool v) { return v; }));
+  }
+}
+
+template <typename OutputIter>
+__global__ void check_hash_result_kernel_xxhash_128(OutputIter result)
+{
+  int i = 0;
+
+  result[i++] = check_hash_result<cuco::xxhash_128<char>>(
+    0, 0, {14144645293874801883, 12019366968424402794});
+  result[i++] = check_hash_result<cuco::xxhash_128<char>>(
+    42, 0, {8777568547874204941, 1497920308546659268});
+  result[i++] = check_hash_result<cuco::xxhash_128<char>>(
+    0, 42, {6697150685477982789, 16862835990649298218});
+
+  result[i++] = check_hash_result<cuco::xxhash_128<int32_t>>(
+    0, 0, {15845180571247577957, 3040916486473433971});
+  result[i++] = check_hash_result<cuco::xxhash_128<int32_t>>(
+    0, 42, {10984597573276123308, 16532782743564947617});
+  result[i++] = check_hash_result<cuco::xxhash_128<int32_t>>(
+    42, 0, {1932769535858151055, 11116380877631057972});
+  result[i++] = check_hash_result<cuco::xxhash_128<int32_t>>(
+    123456789, 0, {12236985229114957765, 16708601316877094708});
+
+  result[i++] = check_hash_result<cuco::xxhash_128<int64_t>>(
+    0, 0, {5027060195534464434, 3173501280862895444});
+  result[i++] = check_hash_result<cuco::xxhash_128<int64_t>>(
+    0, 42, {15439181912508745583, 3241074915469697710});
+  result[i++] = check_hash_result<cuco::xxhash_128<int64_t>>(
+    42, 0, {7044217293765171781, 11217127669921611398});
+  result[i++] = check_hash_result<cuco::xxhash_128<int64_t>>(
+    123456789, 0, {5686821628512271274, 3113600892957498625});
+
+#if defined(CUCO_HAS_INT128)
+  result[i++] = check_hash_result<cuco::xxhash_128<__int128>>(
+    123456789, 0, {11659008988222534993, 4643130342062838206});
+#endif
+
+  result[i++] = check_hash_result<cuco::xxhash_128<large_key<32>>>(
+    123456789, 0, {4197492376924200295, 11724804271630678269});
+  result[i++] = check_hash_result<cuco::xxhash_128<large_key<64>>>(
+    123456789, 0, {15962532058857181731, 18335114309281607096});
+}
+
+TEST_CASE("Test cuco::xxhash_128", "")
+{
+  // Reference hash values were computed using https://github.com/Cyan4973/xxHash
+  SECTION("Check if host-generated hash values match the reference implementation.")
+  {
+    CHECK(check_hash_result<cuco::xxhash_128<char>>(
+      0, 0, {14144645293874801883, 12019366968424402794}));
+    CHECK(check_hash_result<cuco::xxhash_128<char>>(
+      42, 0, {8777568547874204941, 1497920308546659268}));
+    CHECK(check_hash_result<cuco::xxhash_128<char>>(
+      0, 42, {6697150685477982789, 16862835990649298218}));
+
+    CHECK(check_hash_result<cuco::xxhash_128<int32_t>>(
+      0, 0, {15845180571247577957, 3040916486473433971}));
+    CHECK(check_hash_result<cuco::xxhash_128<int32_t>>(
+      0, 42, {10984597573276123308, 16532782743564947617}));
+    CHECK(check_hash_result<cuco::xxhash_128<int32_t>>(
+      42, 0, {1932769535858151055, 11116380877631057972}));
+    CHECK(check_hash_result<cuco::xxhash_128<int32_t>>(
+      123456789, 0, {12236985229114957765, 16708601316877094708}));
+
+    CHECK(check_hash_result<cuco::xxhash_128<int64_t>>(
+      0, 0, {5027060195534464434, 3173501280862895444}));
+    CHECK(check_hash_result<cuco::xxhash_128<int64_t>>(
+      0, 42, {15439181912508745583, 3241074915469697710}));
+    CHECK(check_hash_result<cuco::xxhash_128<int64_t>>(
+      42, 0, {7044217293765171781, 11217127669921611398}));
+    CHECK(check_hash_result<cuco::xxhash_128<int64_t>>(
+      123456789, 0, {5686821628512271274, 3113600892957498625}));
+
+#if defined(CUCO_HAS_INT128)
+    CHECK(check_hash_result<cuco::xxhash_128<__int128>>(
+      123456789, 0, {11659008988222534993, 4643130342062838206}));
+#endif
+
+    // 32*4=128-byte key to test the mid-size hashing path
+    CHECK(check_hash_result<cuco::xxhash_128<large_key<32>>>(
+      123456789, 0, {4197492376924200295, 11724804271630678269}));
+    // 64*4=256-byte key to test the long-input hashing loop
+    CHECK(check_hash_result<cuco::xxhash_128<large_key<64>>>(
+      123456789, 0, {15962532058857181731, 18335114309281607096}));
+  }
+
+  SECTION("Check if device-generated hash values match the reference implementation.")
+  {
+    thrust::device_vector<bool> result(20, true);
+
+    check_hash_result_kernel_xxhash_128<<<1, 1>>>(result.begin());
+
+    CHECK(cuco::test::all_of(result.begin(), result.end(), [] __device__(bool v) { return v; }));
+  }
+}
+
+template <typename OutputIter>
+__global__ void check_hash_result_kernel_crc32c_32(OutputIter result)
+{
+  int i = 0;
+
+  result[i++] = check_hash_result<cuco::crc32c_32<char>>(0, 0, 751089325);
+  result[i++] = check_hash_result<cuco::crc32c_32<char>>(42, 0, 3164912056);
+  result[i++] = check_hash_result<cuco::crc32c_32<char>>(0, 42, 2226898724);
+
+  result[i++] = check_hash_result<cuco::crc32c_32<int32_t>>(0, 0, 1241199445);
+  result[i++] = check_hash_result<cuco::crc32c_32<int32_t>>(0, 42, 2160136293);
+  result[i++] = check_hash_result<cuco::crc32c_32<int32_t>>(42, 0, 91205541);
+  result[i++] = check_hash_result<cuco::crc32c_32<int32_t>>(123456789, 0, 3044081199);
+
+  result[i++] = check_hash_result<cuco::crc32c_32<int64_t>>(0, 0, 1628473246);
+  result[i++] = check_hash_result<cuco::crc32c_32<int64_t>>(0, 42, 2414786625);
+  result[i++] = check_hash_result<cuco::crc32c_32<int64_t>>(42, 0, 3777295318);
+  result[i++] = check_hash_result<cuco::crc32c_32<int64_t>>(123456789, 0, 3014862360);
+
+#if defined(CUCO_HAS_INT128)
+  result[i++] = check_hash_result<cuco::crc32c_32<__int128>>(123456789, 0, 3111738911);
+#endif
+
+  result[i++] = check_hash_result<cuco::crc32c_32<large_key<32>>>(123456789, 0, 184783881);
+}
+
+TEST_CASE("Test cuco::crc32c_32", "")
+{
+  // Reference hash values were computed using a bitwise implementation of CRC-32C (RFC 3720)
+  // followed by the MurmurHash3 32-bit finalizer
+  SECTION("Check if host-generated hash values match the reference implementation.")
+  {
+    CHECK(check_hash_result<cuco::crc32c_32<char>>(0, 0, 751089325));
+    CHECK(check_hash_result<cuco::crc32c_32<char>>(42, 0, 3164912056));
+    CHECK(check_hash_result<cuco::crc32c_32<char>>(0, 42, 2226898724));
+
+    CHECK(check_hash_result<cuco::crc32c_32<int32_t>>(0, 0, 1241199445));
+    CHECK(check_hash_result<cuco::crc32c_32<int32_t>>(0, 42, 2160136293));
+    CHECK(check_hash_result<cuco::crc32c_32<int32_t>>(42, 0, 91205541));
+    CHECK(check_hash_result<cuco::crc32c_32<int32_t>>(123456789, 0, 3044081199));
+
+    CHECK(check_hash_result<cuco::crc32c_32<int64_t>>(0, 0, 1628473246));
+    CHECK(check_hash_result<cuco::crc32c_32<int64_t>>(0, 42, 2414786625));
+    CHECK(check_hash_result<cuco::crc32c_32<int64_t>>(42, 0, 3777295318));
+    CHECK(check_hash_result<cuco::crc32c_32<int64_t>>(123456789, 0, 3014862360));
+
+#if defined(CUCO_HAS_INT128)
+    CHECK(check_hash_result<cuco::crc32c_32<__int128>>(123456789, 0, 3111738911));
+#endif
+
+    // 32*4=128-byte key to test the 8-byte chunk loop
+    CHECK(check_hash_result<cuco::crc32c_32<large_key<32>>>(123456789, 0, 184783881));
+  }
+
+  SECTION("Check if the standard check value of CRC-32C is met.")
+  {
+    char const input[] = "123456789";
+    auto const bytes = reinterpret_cast<std::byte const*>(input);
+    CHECK(cuco::detail::crc32c(bytes, std::size_t{9}) == 0xe3069283);
+  }
+
+  SECTION("Check if device-generated hash values match the reference implementation.")
+  {
+    thrust::device_vector<bool> result(20, true);
+
+    check_hash_result_kernel_crc32c_32<<<1, 1>>>(result.begin());
+
+    CHECK(cuco::test::all_of(result.begin(), result.end(), [] __device__(bool v) { return v; }));
+  }
+}
+
+template <typename OutputIter>
+__global__ void check_hash_result_kernel_multiply_shift(OutputIter result)
+{
+  int i = 0;
+
+  result[i++] = check_hash_result<cuco::multiply_shift<int32_t>>(0, 0, 0);
+  result[i++] = check_hash_result<cuco::multiply_shift<int32_t>>(0, 42, 7650517016761133119);
+  result[i++] = check_hash_result<cuco::multiply_shift<int32_t>>(42, 0, 7240583028055345045);
+  result[i++] =
+    check_hash_result<cuco::multiply_shift<int32_t>>(123456789, 0, 14052290477299400260);
+  result[i++] = check_hash_result<cuco::multiply_shift<int32_t>>(-1, 0, 16059610101391729687);
+
+  result[i++] = check_hash_result<cuco::multiply_shift<int64_t>>(0, 0, 0);
+  result[i++] = check_hash_result<cuco::multiply_shift<int64_t>>(0, 42, 7650517016761133119);
+  result[i++] = check_hash_result<cuco::multiply_shift<int64_t>>(42, 0, 7240583028055345045);
+  result[i++] =
+    check_hash_result<cuco::multiply_shift<int64_t>>(123456789, 0, 14052290477299400260);
+}
+
+TEST_CASE("Test cuco::multiply_shift", "")
+{
+  // Reference hash values were computed with arbitrary-precision integer arithmetic
+  SECTION("Check if host-generated hash values match the reference implementation.")
+  {
+    CHECK(check_hash_result<cuco::multiply_shift<int32_t>>(0, 0, 0));
+    CHECK(check_hash_result<cuco::multiply_shift<int32_t>>(0, 42, 7650517016761133119));
+    CHECK(check_hash_result<cuco::multiply_shift<int32_t>>(42, 0, 7240583028055345045));
+    CHECK(check_hash_result<cuco::multiply_shift<int32_t>>(123456789, 0, 14052290477299400260));
+    CHECK(check_hash_result<cuco::multiply_shift<int32_t>>(-1, 0, 16059610101391729687));
+
+    CHECK(check_hash_result<cuco::multiply_shift<int64_t>>(0, 0, 0));
+    CHECK(check_hash_result<cuco::multiply_shift<int64_t>>(0, 42, 7650517016761133119));
+    CHECK(check_hash_result<cuco::multiply_shift<int64_t>>(42, 0, 7240583028055345045));
+    CHECK(check_hash_result<cuco::multiply_shift<int64_t>>(123456789, 0, 14052290477299400260));
+  }
+
+  SECTION("Check if device-generated hash values match the reference implementation.")
+  {
+    thrust::device_vector<bool> result(20, true);
+
+    check_hash_result_kernel_multiply_shift<<<1, 1>>>(result.begin());
+
+    CHECK(cuco::test::all_of(result.begin(), result.end(), [] __device__(bool v) { return v; }));
+  }
+}
+
+template <typename OutputIter>
+__global__ void check_hash_result_kernel_tabulation_32(OutputIter result)
+{
+  int i = 0;
+
+  result[i++] = check_hash_result<cuco::tabulation_32<int32_t>>(0, 0, 3804097363);
+  result[i++] = check_hash_result<cuco::tabulation_32<int32_t>>(0, 42, 3660680762);
+  result[i++] = check_hash_result<cuco::tabulation_32<int32_t>>(42, 0, 1472180949);
+  result[i++] = check_hash_result<cuco::tabulation_32<int32_t>>(123456789, 0, 691278902);
+  result[i++] = check_hash_result<cuco::tabulation_32<int32_t>>(-1, 0, 467486277);
+
+  result[i++] = check_hash_result<cuco::tabulation_32<int64_t>>(0, 0, 344904120);
+  result[i++] = check_hash_result<cuco::tabulation_32<int64_t>>(0, 42, 1323520571);
+  result[i++] = check_hash_result<cuco::tabulation_32<int64_t>>(42, 0, 2150689586);
+  result[i++] = check_hash_result<cuco::tabulation_32<int64_t>>(123456789, 42, 4070586045);
+}
+
+TEST_CASE("Test cuco::tabulation_32", "")
+{
+  // Reference hash values were computed with an independent Python implementation of the table
+  // generation and lookup
+  SECTION("Check if host-generated hash values match the reference implementation.")
+  {
+    CHECK(check_hash_result<cuco::tabulation_32<int32_t>>(0, 0, 3804097363));
+    CHECK(check_hash_result<cuco::tabulation_32<int32_t>>(0, 42, 3660680762));
+    CHECK(check_hash_result<cuco::tabulation_32<int32_t>>(42, 0, 1472180949));
+    CHECK(check_hash_result<cuco::tabulation_32<int32_t>>(123456789, 0, 691278902));
+    CHECK(check_hash_result<cuco::tabulation_32<int32_t>>(-1, 0, 467486277));
+
+    CHECK(check_hash_result<cuco::tabulation_32<int64_t>>(0, 0, 344904120));
+    CHECK(check_hash_result<cuco::tabulation_32<int64_t>>(0, 42, 1323520571));
+    CHECK(check_hash_result<cuco::tabulation_32<int64_t>>(42, 0, 2150689586));
+    CHECK(check_hash_result<cuco::tabulation_32<int64_t>>(123456789, 42, 4070586045));
+  }
+
+  SECTION("Check if device-generated hash values match the reference implementation.")
+  {
+    thrust::device_vector<bool> result(20, true);
+
+    check_hash_result_kernel_tabulation_32<<<1, 1>>>(result.begin());
+
+    CHECK(cuco::test::all_of(result.begin(), result.end(), [] __device__(bool v) { return v; }));
+  }
+}
+
 TEMPLATE_TEST_CASE_SIG("Static vs. dynamic key hash test",
                        "",
                        ((typename Hash), Hash),
@@ -183,7 +675,18 @@ TEMPLATE_TEST_CASE_SIG("Static vs. dynamic key hash test",
                        (cuco::xxhash_32<char>),
                        (cuco::xxhash_32<int32_t>),
                        (cuco::xxhash_64<char>),
-                       (cuco::xxhash_64<int32_t>))
+                       (cuco::xxhash_64<int32_t>),
+                       (cuco::xxhash3_64<char>),
+                       (cuco::xxhash3_64<int32_t>),
+                       (cuco::rapidhash_64<char>),
+                       (cuco::rapidhash_64<int32_t>),
+                       (cuco::xxhash_128<char>),
+                       (cuco::xxhash_128<int32_t>),
+                       (cuco::murmurhash3_x64_128<char>),
+                       (cuco::murmurhash3_x64_128<int32_t>),
+                       (cuco::crc32c_32<char>),
+                       (cuco::crc32c_32<int32_t>),
+                       (cuco::crc32c_32<int64_t>))
 {
   using key_type = typename Hash::argument_type;
 
@@ -195,4 +698,117 @@ TEMPLATE_TEST_CASE_SIG("Static vs. dynamic key hash test",
     CHECK(hash(key) ==
           hash.compute_hash(reinterpret_cast<std::byte const*>(&key), sizeof(key_type)));
   }
-}
\ No newline at end of file
+}
+
+TEMPLATE_TEST_CASE_SIG("Floating-point key hash test",
+                       "",
+                       ((typename Hash), Hash),
+                       (cuco::murmurhash3_32<float>),
+                       (cuco::murmurhash3_32<double>),
+                       (cuco::xxhash_32<float>),
+                       (cuco::xxhash_64<double>),
+                       (cuco::xxhash3_64<double>),
+                       (cuco::rapidhash_64<float>),
+                       (cuco::crc32c_32<double>),
+                       (cuco::tabulation_32<float>))
+{
+  using key_type  = typename Hash::argument_type;
+  using bits_type = std::conditional_t<sizeof(key_type) == 4, std::uint32_t, std::uint64_t>;
+
+  Hash hash;
+
+  SECTION("Positive and negative zeros should have the same hash value.")
+  {
+    CHECK(hash(key_type{0}) == hash(-key_type{0}));
+    CHECK(hash(key_type{1}) != hash(-key_type{1}));
+  }
+
+  SECTION("All NaNs should have the same hash value.")
+  {
+    key_type const nan = std::numeric_limits<key_type>::quiet_NaN();
+    bits_type bits;
+    std::memcpy(&bits, &nan, sizeof(key_type));
+    // flip the sign bit and set a payload
+    bits ^= bits_type{1} << (sizeof(key_type) * CHAR_BIT - 1);
+    bits |= bits_type{0x1234};
+    key_type other_nan;
+    std::memcpy(&other_nan, &bits, sizeof(key_type));
+
+    CHECK(hash(nan) == hash(other_nan));
+    CHECK(hash(nan) == hash(-std::numeric_limits<key_type>::signaling_NaN()));
+  }
+}
+
+TEMPLATE_TEST_CASE_SIG("Hash avalanche test",
+                       "",
+                       ((typename Hash), Hash),
+                       (cuco::murmurhash3_32<std::uint64_t>),
+                       (cuco::xxhash_32<std::uint64_t>),
+                       (cuco::xxhash_64<std::uint64_t>),
+                       (cuco::xxhash3_64<std::uint64_t>),
+                       (cuco::rapidhash_64<std::uint64_t>))
+{
+  using key_type    = typename Hash::argument_type;
+  using result_type = typename Hash::result_type;
+
+  constexpr std::uint64_t num_keys  = 1'000;
+  constexpr std::size_t input_bits  = CHAR_BIT * sizeof(key_type);
+  constexpr std::size_t output_bits = CHAR_BIT * sizeof(result_type);
+  constexpr double max_bias         = 0.02;
+
+  Hash hash;
+
+  SECTION("Flipping any input bit of small integer keys should flip half of the output bits.")
+  {
+    for (std::size_t bit = 0; bit < input_bits; ++bit) {
+      std::size_t num_flips = 0;
+      for (key_type key = 0; key < num_keys; ++key) {
+        auto const diff = hash(key) ^ hash(key ^ (key_type{1} << bit));
+        num_flips += std::bitset<output_bits>(diff).count();
+      }
+      auto const flip_ratio = static_cast<double>(num_flips) / (num_keys * output_bits);
+      CHECK(std::abs(flip_ratio - 0.5) < max_bias);
+    }
+  }
+}
+
+TEMPLATE_TEST_CASE_SIG("Hash bucket distribution test",
+                       "",
+                       ((typename Hash), Hash),
+                       (cuco::crc32c_32<std::uint32_t>),
+                       (cuco::crc32c_32<std::uint64_t>),
+                       (cuco::multiply_shift<std::uint32_t>),
+                       (cuco::multiply_shift<std::uint64_t>),
+                       (cuco::tabulation_32<std::uint32_t>),
+                       (cuco::tabulation_32<std::uint64_t>),
+                       (cuco::murmurhash3_32<std::uint64_t>),
+                       (cuco::xxhash_64<std::uint64_t>))
+{
+  using key_type = typename Hash::argument_type;
+
+  // Open addressing containers reduce hash values modulo a prime capacity
+  constexpr std::size_t num_buckets = 10'007;
+  constexpr std::size_t num_keys    = 10 * num_buckets;
+  // Largest accepted ratio between the chi-square statistic of the bucket sizes and its expected
+  // value for a uniform random hash function
+  constexpr double max_ratio = 1.1;
+
+  Hash hash;
+
+  SECTION("Dense and strided integer keys should be spread uniformly over the buckets.")
+  {
+    for (auto const stride : {key_type{1}, key_type{1} << 7, key_type{1} << 12}) {
+      std::vector<std::size_t> counts(num_buckets, 0);
+      for (std::size_t i = 0; i < num_keys; ++i) {
+        ++counts[hash(static_cast<key_type>(i) * stride) % num_buckets];
+      }
+
+      auto const expected = static_cast<double>(num_keys) / num_buckets;
+      double chi_square   = 0.;
+      for (auto const count : counts) {
+        chi_square += (count - expected) * (count - expected) / expected;
+      }
+      CHECK(chi_square / (num_buckets - 1) < max_ratio);
+    }
+  }
+}
@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utils.hpp>
+
+#include <cuco/hash_functions.cuh>
+#include <cuco/pair.cuh>
+
+#include <thrust/device_vector.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/transform.h>
+#include <thrust/tuple.h>
+
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+template <int32_t Words>
+struct word_sequence {
+  constexpr __host__ __device__ word_sequence(int32_t value) noexcept
+  {
+    for (int32_t i = 0; i < Words; ++i) {
+      data_[i] = value + i;
+    }
+  }
+
+ private:
+  int32_t data_[Words];
+};
+
+template <typename Hasher, typename Hash>
+__host__ __device__ bool check_incremental_hash_result(std::byte const* bytes,
+                                                       std::size_t size,
+                                                       std::size_t chunk_size) noexcept
+{
+  Hasher hasher{42};
+  for (std::size_t offset = 0; offset < size; offset += chunk_size) {
+    hasher.update(bytes + offset, chunk_size < size - offset ? chunk_size : size - offset);
+  }
+  return hasher.digest() == Hash{42}.compute_hash(bytes, size);
+}
+
+template <typename Hasher, typename Hash, typename Key, typename OutputIter>
+__global__ void check_incremental_hash_result_kernel(Key key, OutputIter result)
+{
+  auto const bytes = reinterpret_cast<std::byte const*>(&key);
+  int i            = 0;
+  for (std::size_t chunk_size : {1, 3, 7, 16, 33, 64}) {
+    result[i++] = check_incremental_hash_result<Hasher, Hash>(bytes, sizeof(Key), chunk_size);
+  }
+}
+
+TEMPLATE_TEST_CASE_SIG("Incremental hash test",
+                       "",
+                       ((typename Hasher, typename Hash), Hasher, Hash),
+                       (cuco::incremental_xxhash_32, cuco::xxhash_32<char>),
+                       (cuco::incremental_xxhash_64, cuco::xxhash_64<char>),
+                       (cuco::incremental_murmurhash3_32, cuco::murmurhash3_32<char>))
+{
+  // 37*4=148 bytes, i.e., full stripes followed by a tail of every block size
+  word_sequence<37> const key{123456789};
+  auto const bytes = reinterpret_cast<std::byte const*>(&key);
+
+  SECTION("Appending a key in chunks of any size should produce its one-shot hash value.")
+  {
+    for (std::size_t chunk_size : {1, 3, 7, 16, 33, 64, 148}) {
+      for (std::size_t size : {0, 1, 5, 16, 31, 32, 100, 148}) {
+        CHECK(check_incremental_hash_result<Hasher, Hash>(bytes, size, chunk_size));
+      }
+    }
+  }
+
+  SECTION("Appending values should hash their packed object representations.")
+  {
+    int32_t const a = 7;
+    int64_t const b = 9;
+    char const c    = 'c';
+
+    std::byte packed[sizeof(a) + sizeof(b) + sizeof(c)];
+    std::memcpy(packed, &a, sizeof(a));
+    std::memcpy(packed + sizeof(a), &b, sizeof(b));
+    std::memcpy(packed + sizeof(a) + sizeof(b), &c, sizeof(c));
+
+    Hasher hasher{42};
+    hasher.update(a);
+    hasher.update(b);
+    hasher.update(c);
+    CHECK(hasher.digest() == Hash{42}.compute_hash(packed, sizeof(packed)));
+  }
+
+  SECTION("Digesting should not prevent appending further input.")
+  {
+    Hasher hasher{42};
+    hasher.update(bytes, 20);
+    [[maybe_unused]] auto const partial = hasher.digest();
+    hasher.update(bytes + 20, sizeof(key) - 20);
+    CHECK(hasher.digest() == Hash{42}.compute_hash(bytes, sizeof(key)));
+  }
+
+  SECTION("Device-generated hash values should match the one-shot hash values.")
+  {
+    thrust::device_vector<bool> result(6, false);
+
+    check_incremental_hash_result_kernel<Hasher, Hash><<<1, 1>>>(key, result.begin());
+
+    CHECK(cuco::test::all_of(result.begin(), result.end(), [] __device__(bool v) { return v; }));
+  }
+}
+
+TEST_CASE("Tuple hash test", "")
+{
+  using hasher_type = cuco::incremental_xxhash_32;
+  using row_type    = thrust::tuple<int32_t, int64_t>;
+
+  cuco::tuple_hash<hasher_type> const hash{hasher_type{42}};
+
+  auto const packed_hash = [](int32_t a, int64_t b) {
+    std::byte packed[sizeof(a) + sizeof(b)];
+    std::memcpy(packed, &a, sizeof(a));
+    std::memcpy(packed + sizeof(a), &b, sizeof(b));
+    return cuco::xxhash_32<char>{42}.compute_hash(packed, sizeof(packed));
+  };
+
+  SECTION("Tuples and pairs should hash the packed concatenation of their elements.")
+  {
+    CHECK(hash(row_type{7, 9}) == packed_hash(7, 9));
+    CHECK(hash(cuco::pair<int32_t, int64_t>{7, 9}) == packed_hash(7, 9));
+    CHECK(hash(row_type{7, 9}) != hash(row_type{9, 7}));
+  }
+
+  SECTION("Multi-column rows should be hashed in a single pass on device.")
+  {
+    constexpr std::size_t num_rows = 100;
+
+    std::vector<int32_t> h_first(num_rows);
+    std::vector<int64_t> h_second(num_rows);
+    std::vector<std::uint32_t> h_expected(num_rows);
+    for (std::size_t i = 0; i < num_rows; ++i) {
+      h_first[i]    = static_cast<int32_t>(i);
+      h_second[i]   = static_cast<int64_t>(i) << 40;
+      h_expected[i] = packed_hash(h_first[i], h_second[i]);
+    }
+
+    thrust::device_vector<int32_t> first(h_first);
+    thrust::device_vector<int64_t> second(h_second);
+    thrust::device_vector<std::uint32_t> expected(h_expected);
+    thrust::device_vector<std::uint32_t> hashes(num_rows);
+
+    auto const rows = thrust::make_zip_iterator(thrust::make_tuple(first.begin(), second.begin()));
+    thrust::transform(rows,
+                      rows + num_rows,
+                      hashes.begin(),
+                      [hash] __device__(row_type const& row) { return hash(row); });
+
+    CHECK(cuco::test::equal(hashes.begin(),
+                            hashes.end(),
+                            expected.begin(),
+                            [] __device__(std::uint32_t lhs, std::uint32_t rhs) {
+                              return lhs == rhs;
+                            }));
+  }
+}
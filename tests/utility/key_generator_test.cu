@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utils.hpp>
+
+#include <cuco/utility/key_generator.hpp>
+
+#include <thrust/device_vector.h>
+#include <thrust/execution_policy.h>
+
+#include <catch2/catch_template_test_macros.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+TEMPLATE_TEST_CASE_SIG("Skewed key distributions", "", ((typename Key), Key), (int32_t), (int64_t))
+{
+  constexpr std::size_t num_keys{100'000};
+  constexpr Key hot_size{1'000};
+
+  cuco::utility::key_generator gen{42};
+
+  SECTION("Zipfian keys are in range and skewed towards the first keys.")
+  {
+    thrust::device_vector<Key> keys(num_keys);
+    gen.generate(cuco::utility::distribution::zipf{1.2}, keys.begin(), keys.end());
+
+    REQUIRE(cuco::test::all_of(keys.begin(), keys.end(), [] __device__(Key const& key) {
+      return key >= 0 and key < static_cast<Key>(num_keys);
+    }));
+    // With alpha = 1.2, the first 1% of the keys are drawn more than half of the time
+    REQUIRE(cuco::test::count_if(keys.begin(), keys.end(), [] __device__(Key const& key) {
+              return key < hot_size;
+            }) > num_keys / 2);
+  }
+
+  SECTION("Hot-set keys are drawn from the hot set with the given probability.")
+  {
+    thrust::device_vector<Key> keys(num_keys);
+    gen.generate(cuco::utility::distribution::hotset{0.01, 1.0}, keys.begin(), keys.end());
+
+    REQUIRE(cuco::test::all_of(keys.begin(), keys.end(), [] __device__(Key const& key) {
+      return key >= 0 and key < hot_size;
+    }));
+  }
+
+  SECTION("Skewed distributions are generated on the host.")
+  {
+    std::vector<Key> keys(num_keys);
+    auto const is_in_range = [](Key const& key) {
+      return key >= 0 and key < static_cast<Key>(num_keys);
+    };
+
+    gen.generate(cuco::utility::distribution::zipf{0.99}, keys.begin(), keys.end(), thrust::host);
+    REQUIRE(std::all_of(keys.begin(), keys.end(), is_in_range));
+
+    gen.generate(
+      cuco::utility::distribution::hotset{0.01, 0.0}, keys.begin(), keys.end(), thrust::host);
+    REQUIRE(std::none_of(keys.begin(), keys.end(), [](Key const& key) { return key < hot_size; }));
+    REQUIRE(std::all_of(keys.begin(), keys.end(), is_in_range));
+  }
+}
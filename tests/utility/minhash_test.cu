@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utils.hpp>
+
+#include <cuco/hash_functions.cuh>
+#include <cuco/minhash.cuh>
+
+#include <thrust/device_vector.h>
+#include <thrust/host_vector.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/sequence.h>
+
+#include <catch2/catch_template_test_macros.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+template <template <typename> class Hash, typename Key>
+void test_minhash(int32_t num_hashes)
+{
+  using result_type = typename Hash<Key>::result_type;
+
+  // Includes an empty set, sets smaller than a warp and sets spanning several warps
+  std::vector<int32_t> const h_offsets{0, 0, 1, 5, 37, 100, 100, 1100};
+  auto const num_sets = static_cast<int32_t>(h_offsets.size()) - 1;
+
+  thrust::device_vector<int32_t> d_offsets(h_offsets.begin(), h_offsets.end());
+  auto const elements_begin = thrust::make_counting_iterator<Key>(0);
+  thrust::device_vector<result_type> d_signatures(num_sets * num_hashes);
+
+  cuco::experimental::minhash<Hash>(d_offsets.begin(),
+                                    d_offsets.end(),
+                                    elements_begin,
+                                    num_hashes,
+                                    d_signatures.begin());
+
+  std::vector<result_type> h_expected(num_sets * num_hashes,
+                                      std::numeric_limits<result_type>::max());
+  for (int32_t s = 0; s < num_sets; ++s) {
+    for (int32_t i = 0; i < num_hashes; ++i) {
+      Hash<Key> const hash(static_cast<std::uint32_t>(i));
+      for (auto e = h_offsets[s]; e < h_offsets[s + 1]; ++e) {
+        auto& expected = h_expected[s * num_hashes + i];
+        expected       = std::min(expected, hash(static_cast<Key>(e)));
+      }
+    }
+  }
+
+  thrust::host_vector<result_type> const h_signatures(d_signatures);
+  REQUIRE(std::equal(h_signatures.begin(), h_signatures.end(), h_expected.begin()));
+}
+
+TEMPLATE_TEST_CASE_SIG("MinHash signatures",
+                       "",
+                       ((typename Key, int32_t NumHashes), Key, NumHashes),
+                       (int32_t, 1),
+                       (int32_t, 20),
+                       (int32_t, 128),
+                       (int64_t, 1),
+                       (int64_t, 20),
+                       (int64_t, 128))
+{
+  SECTION("xxhash_64 signatures should match the host reference.")
+  {
+    test_minhash<cuco::xxhash_64, Key>(NumHashes);
+  }
+
+  SECTION("murmurhash3_32 signatures should match the host reference.")
+  {
+    test_minhash<cuco::murmurhash3_32, Key>(NumHashes);
+  }
+}
+
+TEST_CASE("MinHash similarity", "")
+{
+  using Key = int32_t;
+
+  constexpr int32_t num_hashes{256};
+  constexpr int32_t set_size{1'000};
+
+  // Three sets: [0, 1000), [0, 1000) and [500, 1500)
+  std::vector<int32_t> const h_offsets{0, set_size, 2 * set_size, 3 * set_size};
+  thrust::device_vector<int32_t> d_offsets(h_offsets.begin(), h_offsets.end());
+
+  thrust::device_vector<Key> d_elements(3 * set_size);
+  thrust::sequence(d_elements.begin(), d_elements.begin() + set_size);
+  thrust::sequence(d_elements.begin() + set_size, d_elements.begin() + 2 * set_size);
+  thrust::sequence(d_elements.begin() + 2 * set_size, d_elements.end(), set_size / 2);
+
+  thrust::device_vector<std::uint64_t> d_signatures(3 * num_hashes);
+  cuco::experimental::minhash(
+    d_offsets.begin(), d_offsets.end(), d_elements.begin(), num_hashes, d_signatures.begin());
+
+  thrust::host_vector<std::uint64_t> const h_signatures(d_signatures);
+  auto const num_equal = [&](int32_t lhs, int32_t rhs) {
+    int32_t count = 0;
+    for (int32_t i = 0; i < num_hashes; ++i) {
+      count += h_signatures[lhs * num_hashes + i] == h_signatures[rhs * num_hashes + i];
+    }
+    return count;
+  };
+
+  // Identical sets have identical signatures
+  REQUIRE(num_equal(0, 1) == num_hashes);
+
+  // The Jaccard similarity of [0, 1000) and [500, 1500) is 1/3
+  auto const estimate = static_cast<double>(num_equal(0, 2)) / num_hashes;
+  REQUIRE(estimate > 0.2);
+  REQUIRE(estimate < 0.5);
+}
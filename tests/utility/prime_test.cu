@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cuco/detail/prime.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+TEST_CASE("Prime sequence tests", "")
+{
+  SECTION("Primality test should match trial division.")
+  {
+    for (uint64_t n = 0; n < 100'000; ++n) {
+      auto is_prime = n > 1;
+      for (uint64_t d = 2; d * d <= n and is_prime; ++d) {
+        is_prime = (n % d != 0);
+      }
+      REQUIRE(cuco::detail::is_prime(n) == is_prime);
+    }
+    // largest primes below 2^32 and 2^40
+    REQUIRE(cuco::detail::is_prime(4294967291));
+    REQUIRE(cuco::detail::is_prime(1099511627689));
+    // a strong pseudoprime to bases 2, 3, 5 and 7, and 65537^2
+    REQUIRE(not cuco::detail::is_prime(3215031751));
+    REQUIRE(not cuco::detail::is_prime(4295098369));
+  }
+
+  SECTION("Valid primes should be evaluated at compile time.")
+  {
+    STATIC_REQUIRE(cuco::detail::prime_lower_bound(0) == 2);
+    STATIC_REQUIRE(cuco::detail::prime_lower_bound(8) == 13);
+    STATIC_REQUIRE(cuco::detail::prime_lower_bound(157) == 157);
+    STATIC_REQUIRE(cuco::detail::prime_lower_bound(131072) == 131101);
+    STATIC_REQUIRE(cuco::detail::prime_lower_bound(10'000'000'000) == 10'000'042'001);
+  }
+
+  SECTION("Valid primes should match the sequence at run time.")
+  {
+    REQUIRE(cuco::detail::prime_lower_bound(1000) == 1009);
+    REQUIRE(cuco::detail::prime_lower_bound(1 << 20) == 1048703);
+    REQUIRE(cuco::detail::prime_lower_bound(uint64_t{1} << 32) == 4295050069);
+    REQUIRE(cuco::detail::prime_lower_bound(17177627054) == cuco::detail::max_prime);
+    REQUIRE(cuco::detail::prime_lower_bound(cuco::detail::max_prime) == cuco::detail::max_prime);
+  }
+
+  SECTION("Walking the sequence from each anchor should reach the next one.")
+  {
+    auto const& anchors = cuco::detail::prime_anchors;
+    for (std::size_t i = 0; i + 1 < anchors.size(); ++i) {
+      auto p = anchors[i];
+      for (auto step = 0; step < cuco::detail::prime_anchor_stride; ++step) {
+        p = cuco::detail::next_sequence_prime(p);
+      }
+      REQUIRE(p == anchors[i + 1]);
+    }
+  }
+
+  SECTION("Encoded gaps should match the primality search.")
+  {
+    int64_t p = 2;
+    for (std::size_t i = 0; p < cuco::detail::max_prime; ++i) {
+      auto const next = cuco::detail::next_sequence_prime(p);
+      REQUIRE(cuco::detail::next_sequence_prime(p, i) == next);
+      p = next;
+    }
+    REQUIRE(p == cuco::detail::max_prime);
+  }
+}
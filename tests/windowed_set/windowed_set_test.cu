@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2023, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <utils.hpp>
+
+#include <cuco/windowed_set.cuh>
+
+#include <thrust/count.h>
+#include <thrust/device_vector.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+
+#include <catch2/catch_template_test_macros.hpp>
+
+#include <cstdint>
+
+using size_type = int32_t;
+
+TEMPLATE_TEST_CASE_SIG("Windowed set generations",
+                       "",
+                       ((typename Key, int32_t CGSize), Key, CGSize),
+                       (int32_t, 1),
+                       (int32_t, 2),
+                       (int64_t, 1),
+                       (int64_t, 2))
+{
+  constexpr size_type num_keys{1'000};
+  constexpr int32_t num_generations{3};
+
+  using probe = cuco::experimental::double_hashing<CGSize, cuco::default_hash_function<Key>>;
+
+  auto set = cuco::experimental::windowed_set<Key,
+                                              num_generations,
+                                              cuco::experimental::extent<size_type>,
+                                              cuda::thread_scope_device,
+                                              thrust::equal_to<Key>,
+                                              probe>{2 * num_keys, cuco::empty_key<Key>{-1}};
+
+  // Generation `g` holds the keys `[g * num_keys, (g + 1) * num_keys)`
+  auto const generation_begin = [&](int32_t g) {
+    return thrust::make_counting_iterator<Key>(g * num_keys);
+  };
+  auto const num_contained = [&](int32_t g) {
+    thrust::device_vector<bool> d_contained(num_keys);
+    set.contains(generation_begin(g), generation_begin(g) + num_keys, d_contained.begin());
+    return thrust::count(thrust::device, d_contained.begin(), d_contained.end(), true);
+  };
+
+  for (int32_t g = 0; g < num_generations; ++g) {
+    if (g > 0) { set.advance(); }
+    REQUIRE(set.insert(generation_begin(g), generation_begin(g) + num_keys) == num_keys);
+    REQUIRE(set.size() == num_keys);
+  }
+
+  SECTION("Keys of all live generations should be contained.")
+  {
+    for (int32_t g = 0; g < num_generations; ++g) {
+      REQUIRE(num_contained(g) == num_keys);
+    }
+    REQUIRE(num_contained(num_generations) == 0);
+  }
+
+  SECTION("Advancing should retire the oldest generation only.")
+  {
+    set.advance();
+    REQUIRE(set.size() == 0);
+    REQUIRE(num_contained(0) == 0);
+    for (int32_t g = 1; g < num_generations; ++g) {
+      REQUIRE(num_contained(g) == num_keys);
+    }
+  }
+
+  SECTION("Keys inserted again should survive the retirement of their old generation.")
+  {
+    set.advance();
+    REQUIRE(set.insert(generation_begin(1), generation_begin(1) + num_keys) == num_keys);
+
+    set.advance();
+    REQUIRE(num_contained(1) == num_keys);
+    REQUIRE(num_contained(2) == num_keys);
+
+    set.advance();
+    REQUIRE(num_contained(1) == num_keys);
+    REQUIRE(num_contained(2) == 0);
+  }
+
+  SECTION("Cleared set should not contain any key.")
+  {
+    set.clear();
+    for (int32_t g = 0; g < num_generations; ++g) {
+      REQUIRE(num_contained(g) == 0);
+    }
+  }
+}